@@ -36,6 +36,13 @@
 #define MAX_OUTPUT_LAYER_DENSE ((const uint16_t) 200)
 #define MAX_HIDDEN_LAYER_NUM   ((const uint16_t) 010)
 
+/** @defgroup Incremental first layer parameters */
+#define INCREMENTAL_REFRESH_UPDATES ((const uint32_t) 1024) // Updates between two full products. (Bounds the rounding drift)
+
+/** @defgroup Depth-first batches parameters */
+#define BATCH_TILE_MIN_ROWS     ((const uint16_t) 4)            // The batched products run four rows at a time.
+#define DEFAULT_L2_CACHE_BYTES  ((const size_t) (1024 * 1024))  // The L2 cache size when the system doesn't report it.
+
 /*
 ----------------------------------------------------------------
 !-                       DEFINED STRUCTS                       -
@@ -49,6 +56,12 @@
 typedef struct 
 {
     Type_t *input_layer;
+
+    // The borrowed input, read in place of the input layer while bound. (data NULL: Not bound)
+    Tensor_View_t input_view;
+
+    // The borrowed sparse input, its active weights columns only are read. (len 0: Not bound)
+    Sparse_Vector_t input_sparse;
 }Input_Layer;
 
 /**
@@ -87,11 +100,95 @@ typedef struct
     Type_t *layers_biases;
 }Layers_Biases;
 
+/**
+ * @brief Struct for the training state: The gradients of the weights & the biases (Same shapes)
+ * 
+ */
+typedef struct
+{
+    Layer_Weights *weights_gradients;
+    Type_t *biases_gradients;
+
+    // Ping-pong back propagated errors. (max dense long)
+    Type_t *layer_deltas[2];
+
+    // The output layer before its activation: Saved by the training forward pass for the fused
+    // loss kernels. (BCE_Batch, MCCE_Batch)
+    Type_t *output_logits;
+    bool output_logits_saved;
+
+    // Training steps done. (Keys the dropout masks of each step)
+    uint64_t step;
+
+    // Back propagations accumulated since the last optimizer step. (It applies their mean)
+    uint16_t accumulated;
+}Layer_Gradients;
+
+/**
+ * @brief Struct for the incremental first layer: Its accumulator follows the changes of the input
+ * 
+ */
+typedef struct
+{
+    // The Weights[0] products (No bias, no activation) of the input below. [hidden_layer_dense]
+    Type_t *accumulator;
+    Type_t *input;   // [input_layer_dense]
+
+    // Weights[0] transposed: The weights column of input (j) is the row (j). [input_layer_dense x hidden_layer_dense]
+    Type_t *columns;
+
+    // The model version of the columns & of the accumulator. (0: No input yet)
+    uint64_t version;
+
+    // Updates since the last full product.
+    uint32_t updates;
+}Incremental_Layer;
+
+/**
+ * @brief Enum for the built in activation functions
+ *          - The forward & backward passes run their fused kernels. (Biases + activation, derivative)
+ * 
+ */
+typedef enum _Activation_t
+{
+    ACTIVATION_CUSTOM = 0, // The activation function pointer. (Not fused, no derivative: Inference only)
+    ACTIVATION_RELU,
+    ACTIVATION_ELU,        // alpha: Network_Topology_t.activation_alpha.
+    ACTIVATION_SIGMOID,
+    ACTIVATION_TANH,
+    ACTIVATION_SOFTMAX,    // Output layer only.
+    ACTIVATIONS_NUM
+}Activation_t;
+
+/**
+ * @brief Struct for the activations a network runs. (Resolved once, when it is created)
+ * 
+ */
+typedef struct
+{
+    Activation_t hidden;
+    Activation_t output;
+
+    // The ELU alpha.
+    double alpha;
+}Activation_Plan_t;
+
+/**
+ * @brief Struct for the dropout mask of a hidden layer, fused in its activation. (Training only)
+ * 
+ */
+typedef struct
+{
+    const uint32_t *randoms;    // One per neuron: Kept if below keep_threshold.
+    uint32_t keep_threshold;
+    double keep_scale;          // 1 / (1 - dropout_rate). (Inverted dropout)
+}Dropout_Mask_t;
+
 /**
  * @brief Struct for deep neural network parameters.
  * 
  */
-#pragma pack(1)
+#pragma pack(push, 1)
 typedef struct _Layer_t
 {
     Input_Layer *Input_layer;
@@ -103,8 +200,69 @@ typedef struct _Layer_t
     Layer_Weights *Layer_weights;
 
     Layers_Biases *Layers_biases;
+
+    // Ping-pong [tile x hidden_layer_dense] activations for the batched forward pass.
+    Type_t *Batch_workspace[2];
+
+    // The rows of a depth-first batch tile. (network_batch_tile or Set_Batch_Tile)
+    uint16_t Batch_tile;
+
+    // The training state. (Created on the first training step)
+    Layer_Gradients *Layer_gradients;
+
+    // The profiling counters. (NULL without ANN_ENABLE_PROFILING)
+    struct _Network_Stats_t *Network_stats;
+
+    // The memory counters of the network blocks.
+    struct _Memory_Stats_t *Memory_stats;
+
+    // The activation kernels of the passes.
+    Activation_Plan_t Activation_plan;
+
+    // Gradient checkpointing: Every k-th hidden layer owns its vector, the (k - 1) layers of a
+    // segment between two of them share the segment buffer (Hidden[i]: Checkpoint_buffers[i % k])
+    // & are recomputed once per segment by the backward pass. (1: No checkpointing, NULL)
+    uint16_t Checkpoint_interval;
+    Type_t **Checkpoint_buffers;
+
+    // The topology & config of a loaded network. (Load_Network, NULL: The caller's)
+    struct _Network_Settings_t *Owned_settings;
+
+    // The model version: A hash of the weights & the biases. (0: Changed, hashed again by Model_Version)
+    uint64_t Model_version;
+
+    // The results cache of the Predict functions. (Attach_Cache, NULL: None)
+    struct _Cache_t *Inference_cache;
+
+    // The incremental first layer. (Created by the first Predict_Incremental_Reset)
+    Incremental_Layer *Incremental_layer;
+
+    // The sparse weights & kernels of a pruned network. (Sparsify_Network, NULL: Dense kernels)
+    struct _Sparse_Weights_t *Sparse_weights;
+
+    // The low rank factors of the weights. (Factorize_Network, NULL: Dense weights)
+    struct _LowRank_Weights_t *LowRank_weights;
+
+    // The 16 bits copies of the weights. (Compress_Network, NULL: Double weights)
+    struct _Half_Weights_t *Half_weights;
 }Layer_t;
 
+/**
+ * @brief Enum for the weights initialization schemes
+ *          - fan_in: The weights matrix col, fan_out: The weights matrix row.
+ * 
+ */
+typedef enum _Init_Scheme_t
+{
+    INIT_DEFAULT = 0,    // Uniform steps: (random % range) * factor. (The library's original scheme)
+    INIT_UNIFORM,        // U(-INIT_UNIFORM_LIMIT, INIT_UNIFORM_LIMIT).
+    INIT_NORMAL,         // N(0, INIT_NORMAL_STDDEV).
+    INIT_XAVIER_UNIFORM, // U(-sqrt(6 / (fan_in + fan_out)), +sqrt(6 / (fan_in + fan_out))). (Tanh, Sigmoid)
+    INIT_XAVIER_NORMAL,  // N(0, sqrt(2 / (fan_in + fan_out))).
+    INIT_HE_UNIFORM,     // U(-sqrt(6 / fan_in), +sqrt(6 / fan_in)). (ReLU, ELU)
+    INIT_HE_NORMAL       // N(0, sqrt(2 / fan_in)).
+}Init_Scheme_t;
+
 /**
  * @brief Struct for network parameters configurations
  * 
@@ -117,14 +275,42 @@ typedef struct _Netowrk_Config_t
 
     // Active/Inactive dropout.
     const bool dropout; 
+    // Probability of dropping a hidden neuron while training. (Inverted dropout)
+    const double dropout_rate;
 
     const uint16_t epochs;
+
+    // Samples accumulated per optimizer step by Train_Network. (0, 1: One step per sample)
+    const uint16_t batch_size;
+
+    // Seed of the training random numbers. (Weights initialization & dropout masks)
+    const uint64_t seed;
+
+    // Weights initialization of the hidden layers & of the output layer. (INIT_DEFAULT: Same as the hidden layers)
+    const Init_Scheme_t weight_init;
+    const Init_Scheme_t output_weight_init;
+
+    // Gradient checkpointing: Keep the activations of every k-th hidden layer only & recompute
+    // the others while back propagating. (0, 1: Keep them all)
+    const uint16_t checkpoint_interval;
+    // Or the smallest k keeping the hidden activations under this many bytes. (0: No limit)
+    const size_t checkpoint_memory_limit;
+
+    // Depth-first batches: Tiles of this many rows run through every layer before the next tile.
+    // (0: Sized for the L2 cache, the batch size or more: Layer by layer)
+    const uint16_t batch_tile;
+
+    // The dropout masks stream of this network, keyed with the seed. (Not the thread: The same
+    // seed & stream drop the same neurons on any thread) Replicas of one seed take their own.
+    const uint64_t random_stream;
 }Network_Config_t;
 
 /**
  * @brief Struct for the network topology parameters
  * 
  */
+struct _DNN_Network;
+
 #pragma pack(1)
 typedef struct _Network_Topology_t
 {
@@ -142,16 +328,24 @@ typedef struct _Network_Topology_t
     const uint16_t hidden_layer_dense;   
 
     //===> System Parameters:
-    // The Activation Function.
+    // The Activation Function. (Used if its activation kind is ACTIVATION_CUSTOM)
+    // (The library functions (&ReLU, &ELU, ..) are recognized & run as their kind)
     double * (*activation_function) (Type_t *); // Activation function for the basic layers.
     double * (*output_activation_function) (Type_t *); // Activation function for the output layer.
 
+    // The activation kinds. (ACTIVATION_CUSTOM: The function pointers above)
+    const Activation_t activation;
+    const Activation_t output_activation;
+
+    // The ELU alpha. (0: ELU_CONST_ALPHA)
+    const double activation_alpha;
+
     // The Loss Function.
-    double * (*loss_function) (Type_t *, Type_t *);
+    double (*loss_function) (Type_t *, Type_t *);
     double * (*loss_function_array) (Type_t *);
 
-    // The Optimizer Function.
-    double * (*optimizer_function) (Type_t *);
+    // The Optimizer Function. (Applies & clears the network gradients)
+    void (*optimizer_function) (struct _DNN_Network *);
 
 }Network_Topology_t;
 
@@ -166,6 +360,7 @@ typedef struct _DNN_Network
     Network_Topology_t *network_topology;
     Layer_t            *network_layers;
 }DNN_Network;
+#pragma pack(pop)
 
 /*
 ----------------------------------------------------------------
@@ -176,6 +371,25 @@ typedef struct _DNN_Network
 /** @defgroup Deep Neural Network Activation Functions Main Functions */
 void network_topology_validity(Network_Topology_t *);
 DNN_Network *Create_Network(Network_Topology_t *, Network_Config_t *);
+void Free_Network(DNN_Network *);
+
+/** @defgroup Deep Neural Network Checked Functions (Return a status, never exit) */
+ANN_Status_t Create_Network_Checked(Network_Topology_t *, Network_Config_t *, DNN_Network **);
+ANN_Status_t Check_Network_Topology(Network_Topology_t *);
+ANN_Status_t Check_Network_Config(Network_Config_t *);
+ANN_Status_t Check_Network(DNN_Network *);
+ANN_Status_t Check_Network_Training(DNN_Network *);
+ANN_Status_t Predict_Network(DNN_Network *, const double *, uint16_t, double *, uint16_t);
+ANN_Status_t Predict_Batch_Network(DNN_Network *, Type_t *, Type_t *, uint16_t);
+ANN_Status_t Predict_Incremental_Reset(DNN_Network *, const double *, uint16_t, double *, uint16_t);
+ANN_Status_t Predict_Incremental(DNN_Network *, const uint16_t *, const double *, uint16_t, double *, uint16_t);
+ANN_Status_t Bind_Input(DNN_Network *, const Tensor_View_t *);
+ANN_Status_t Bind_Sparse_Input(DNN_Network *, const Sparse_Vector_t *);
+ANN_Status_t Predict_Sparse_Network(DNN_Network *, const Sparse_Vector_t *, double *, uint16_t);
+ANN_Status_t Attach_Cache(DNN_Network *, struct _Cache_t *);
+ANN_Status_t Set_Batch_Tile(DNN_Network *, uint16_t);
+uint64_t Model_Version(DNN_Network *);
+void Weights_Changed(DNN_Network *);
 
 void Set_Input(DNN_Network * ,Type_t *);
 void Set_Output(DNN_Network * ,Type_t *);
@@ -185,7 +399,10 @@ void Set_Output(DNN_Network * ,Type_t *);
 
 /** @defgroup Deep Neural Network Functions */
 void forward_propagation(DNN_Network *);
-void back_propgation(DNN_Network *);
+void forward_propagation_train(DNN_Network *);
+void forward_propagation_batch(DNN_Network *, Type_t *, Type_t *, uint16_t);
+double back_propagation(DNN_Network *, Type_t *);
+double Train_Network(DNN_Network *, Type_t *, Type_t *, uint16_t);
 
 /** @defgroup Deep Neural Network Activation Functions - Hidden Layer */
 double *ReLU(Type_t *);
@@ -203,15 +420,22 @@ double *Tanh_D(Type_t *);
 double *SoftMax(Type_t *);
 
 /** @defgroup  Deep Neural Network Loss Functions */
-double *MSE(Type_t *, Type_t *);         // Mean Square Error.
-double *MAE(Type_t *, Type_t *);        // Mean Absolute Error.
-//double *BC(Type_t *, Type_t *);      // Binary Classification Error.
-//double *BCE(Type_t *, Type_t *);    // Binary Cross Entropy Error.
-//double *MCC(Type_t *, Type_t *);   // Multi Class Classification Error.
-//double *MCCE(Type_t *, Type_t *); // Multi Class Cross Entropy Error.
+double MSE(Type_t *, Type_t *);         // Mean Square Error.
+double MAE(Type_t *, Type_t *);        // Mean Absolute Error.
+double BC(Type_t *, Type_t *);        // Binary Classification Error.
+double BCE(Type_t *, Type_t *);      // Binary Cross Entropy Error.
+double MCC(Type_t *, Type_t *);     // Multi Class Classification Error.
+double MCCE(Type_t *, Type_t *);   // Multi Class Cross Entropy Error.
+
+/** @defgroup  Deep Neural Network Loss Functions - Fused Batch (Logits in, mean loss & gradient out) */
+double BCE_Batch(Type_t *, Type_t *, Type_t *, uint16_t);   // Sigmoid + Binary Cross Entropy.
+double MCCE_Batch(Type_t *, Type_t *, Type_t *, uint16_t); // SoftMax + Multi Class Cross Entropy.
 
 /** @defgroup Deep Nueral Network Optimization Functions*/
-double *GradientDescent(Type_t *);
+void GradientDescent(DNN_Network *);
+
+/** @defgroup Deep Neural Network Regularization Functions */
+void Dropout_Apply(Type_t *, double, uint64_t, uint64_t);
 
 /** @defgroup Deep Neural Network Sub Functions */
 void print_network(DNN_Network *);
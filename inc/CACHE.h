@@ -0,0 +1,137 @@
+/**
+ * @file CACHE.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Inference results cache header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _CACHE_H
+#define _CACHE_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Cache parameters */
+#define CACHE_SHARDS      ((const uint16_t) 16)   // Independently locked parts of a cache. (Power of 2)
+#define CACHE_NO_ENTRY    ((const int32_t) -1)    // End of the LRU lists & of the buckets chains.
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for one cached result
+ *
+ */
+typedef struct _Cache_Entry_t
+{
+    uint64_t hash;      // Of the input & of the model version.
+    uint64_t version;
+
+    // The LRU list. (prev: More recent)
+    int32_t lru_prev;
+    int32_t lru_next;
+
+    // The next entry of the same bucket.
+    int32_t chain_next;
+}Cache_Entry_t;
+
+/**
+ * @brief Struct for one shard: A bounded LRU hash table under its own lock
+ *
+ */
+typedef struct _Cache_Shard_t
+{
+    pthread_mutex_t lock;
+
+    Cache_Entry_t *entries;   // [capacity]
+    double *values;           // [capacity x (input_dense + output_dense)] The inputs & their outputs.
+    int32_t *buckets;         // [buckets_mask + 1] First entry of each bucket.
+    uint32_t buckets_mask;
+    uint32_t used;
+
+    int32_t lru_head;         // The most recent entry.
+    int32_t lru_tail;         // The next one to evict.
+
+    // The counters. (Under the lock)
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+    uint64_t evictions;
+}Cache_Shard_t;
+
+/**
+ * @brief Struct for a results cache. (Shared by any number of threads & networks of the same shapes)
+ *
+ */
+typedef struct _Cache_t
+{
+    uint16_t input_dense;
+    uint16_t output_dense;
+
+    // Entries per shard.
+    uint32_t capacity;
+
+    Cache_Shard_t shards[CACHE_SHARDS];
+}Cache_t;
+
+/**
+ * @brief Struct for a snapshot of the cache counters
+ *
+ */
+typedef struct _Cache_Report_t
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+    uint64_t evictions;
+    uint64_t entries;     // Entries held now.
+    uint64_t capacity;
+
+    double hit_rate;      // hits / (hits + misses).
+}Cache_Report_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Cache Main Functions */
+Cache_t *Cache_Create(uint32_t, uint16_t, uint16_t);
+void Cache_Free(Cache_t *);
+bool Cache_Lookup(Cache_t *, uint64_t, const double *, double *);
+void Cache_Insert(Cache_t *, uint64_t, const double *, const double *);
+void Cache_Clear(Cache_t *);
+
+/** @defgroup Cache Sub Functions */
+uint64_t Cache_Hash(const double *, uint16_t, uint64_t);
+void Cache_Get_Report(Cache_t *, Cache_Report_t *);
+void print_cache_report(Cache_t *);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_CACHE_H
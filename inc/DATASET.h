@@ -0,0 +1,220 @@
+/**
+ * @file DATASET.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Training dataset streaming header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _DATASET_H
+#define _DATASET_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Dataset streaming parameters */
+#define DATASET_CHUNK_SIZE     ((const uint32_t) (1u << 20)) // Bytes read from the disk per chunk.
+#define DATASET_LINE_MAX       ((const uint32_t) 16384)      // Longest accepted CSV line.
+#define DATASET_BINARY_VERSION ((const uint16_t) 1)
+#define DATASET_ROW_ALIGN      ((const uint16_t) 8)          // Doubles per cache line. (Aligned rows)
+
+// The binary dataset file magic. ("ANND")
+#define DATASET_BINARY_MAGIC "ANND"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Enum for the supported dataset file formats
+ *
+ */
+typedef enum _Dataset_Format_t
+{
+    DATASET_FORMAT_CSV = 0,
+    DATASET_FORMAT_BINARY
+}Dataset_Format_t;
+
+/**
+ * @brief Struct for the binary dataset file header.
+ *          - File visual view:
+                [Header (64 bytes)]
+                [Sample 0] => [input_0 .. input_n][output_0 .. output_m][padding]
+                [Sample 1] => [input_0 .. input_n][output_0 .. output_m][padding]
+                .
+                [Sample s] => ...
+            - Every value is a native double, every row is (row_stride) doubles.
+ *
+ */
+#pragma pack(push, 1)
+typedef struct _Dataset_Header_t
+{
+    char     magic[4];
+    uint16_t version;
+    uint16_t input_dense;
+    uint16_t output_dense;
+    uint16_t row_stride;
+
+    uint64_t samples;
+
+    uint8_t  reserved[44];
+}Dataset_Header_t;
+#pragma pack(pop)
+
+/**
+ * @brief Struct for one batch of training samples
+ *
+ */
+typedef struct _Dataset_Batch_t
+{
+    // [batch_size x input_dense] matrix.
+    Type_t *inputs;
+    // [batch_size x output_dense] matrix.
+    Type_t *outputs;
+
+    // Number of valid rows in this batch. (The last batch may be short)
+    uint16_t size;
+}Dataset_Batch_t;
+
+/**
+ * @brief Struct for a streaming dataset with double buffered prefetch.
+ *          - Prefetch visual view:
+                [I/O Thread]  => fills  batches[fill_idx]
+                [Train Loop]  => trains batches[consume_idx]
+                Both sides swap the index when they are done with a buffer.
+ *
+ */
+typedef struct _Dataset_Stream_t
+{
+    //===> File Parameters:
+    FILE *file;
+    Dataset_Format_t format;
+    long data_offset;
+
+    uint16_t input_dense;
+    uint16_t output_dense;
+    uint16_t row_stride;
+    uint16_t batch_size;
+
+    // The stdio chunk buffer & the binary staging buffer.
+    char   *chunk_buffer;
+    double *staging_buffer;
+    char   *line_buffer;
+
+    //===> Prefetch Parameters:
+    Dataset_Batch_t batches[2];
+    bool filled[2];
+
+    uint8_t fill_idx;
+    uint8_t consume_idx;
+
+    // The batch currently handed to the training loop.
+    bool    holding;
+    uint8_t held_idx;
+
+    bool eof;
+    bool stop;
+    bool rewind;
+
+    // The error that ended the stream early. (ANN_OK: None, set by the I/O thread)
+    ANN_Status_t status;
+
+    pthread_t       worker;
+    pthread_mutex_t lock;
+    pthread_cond_t  filled_cond;
+    pthread_cond_t  empty_cond;
+}Dataset_Stream_t;
+
+/**
+ * @brief Struct for a memory mapped (out-of-core) binary dataset.
+ *          - Batch visual view:
+                order[]   => [7][2][9][0] ..  (Shuffled sample indices)
+                Batch row => pointer to mapping[order[cursor + r]] (No copy)
+            - The batches are read only views into the mapping. The pages are shared
+              with every other process mapping the same file.
+ *
+ */
+typedef struct _Dataset_Map_t
+{
+    //===> Mapping Parameters:
+    void  *mapping;
+    size_t mapping_size;
+#ifdef _WIN32
+    HANDLE file_handle;
+    HANDLE mapping_handle;
+#else
+    int file_descriptor;
+#endif
+
+    const double *samples;
+    uint64_t samples_num;
+
+    uint16_t input_dense;
+    uint16_t output_dense;
+    uint16_t row_stride;
+    uint16_t batch_size;
+
+    //===> Batch Parameters:
+    // Sample visiting order. (Shuffling only permutes this array)
+    uint32_t *order;
+    uint64_t  cursor;
+    bool      shuffled;
+
+    // The batch row pointers into the mapping.
+    double **input_rows;
+    double **output_rows;
+
+    Type_t input_view;
+    Type_t output_view;
+    Dataset_Batch_t batch;
+}Dataset_Map_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Dataset Main Functions */
+Dataset_Stream_t *Dataset_Open_Stream(const char *, Dataset_Format_t, uint16_t, uint16_t, uint16_t);
+Dataset_Batch_t  *Dataset_Next_Batch(Dataset_Stream_t *);
+ANN_Status_t Dataset_Next_Batch_Checked(Dataset_Stream_t *, Dataset_Batch_t **);
+void Dataset_Rewind(Dataset_Stream_t *);
+void Dataset_Close_Stream(Dataset_Stream_t *);
+
+Dataset_Map_t   *Dataset_Open_Map(const char *, uint16_t);
+Dataset_Batch_t *Dataset_Map_Next_Batch(Dataset_Map_t *);
+void Dataset_Shuffle(Dataset_Map_t *, uint64_t);
+void Dataset_Map_Rewind(Dataset_Map_t *);
+void Dataset_Close_Map(Dataset_Map_t *);
+
+void Dataset_CSV_To_Binary(const char *, const char *, uint16_t, uint16_t, bool);
+
+/** @defgroup Dataset Sub Functions */
+bool dataset_parse_csv_line(char *, double *, uint16_t);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_DATASET_H
@@ -28,15 +28,37 @@
 #include <stdbool.h>
 #include <math.h>
 #include <string.h>
-#include <windows.h>
-#include <conio.h>
 #include <assert.h>
 #include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <conio.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 //#include <crtdbg>
 
 //====> Made Headers.
 #include "MATRIX.h"
 #include "ANN.h"
+#include "DATASET.h"
+#include "RANDOM.h"
+#include "INIT.h"
+#include "PROFILE.h"
+#include "TRACE.h"
+#include "MEMORY.h"
+#include "POOL.h"
+#include "MODEL.h"
+#include "CACHE.h"
+#include "PRUNE.h"
+#include "LOWRANK.h"
+#include "HALF.h"
+#include "TUNE.h"
 
 /*
 ----------------------------------------------------------------
@@ -60,6 +82,9 @@ typedef struct _Private_t
     // const uint16_t x, y, z; // For general purpose using.
 }Privates_t;
 
+// The private variables. (Defined in Global.c)
+extern Privates_t private;
+
 /*
 ----------------------------------------------------------------
 !-                       DEFINED VARIABLES                     -
@@ -75,6 +100,22 @@ typedef struct _Private_t
                           __FILE__,__func__,__LINE__,ERROR_TYPE); \
                           exit(-1);}) 
 
+/**
+ * @brief Standard macro function for the checks of the unchecked (hot path) functions.
+ *          - Their inputs are validated once, when the network is built. Built with
+ *            ANN_DEBUG_CHECKS (CMake Debug builds), every call checks them again.
+ * 
+ */
+#ifdef ANN_DEBUG_CHECKS
+    #define ANN_ASSERT(CONDITION, ERROR_TYPE) \
+        do { \
+            if(!(CONDITION)) \
+                error_exit(CURRENT_C, ERROR_TYPE); \
+        } while(0)
+#else
+    #define ANN_ASSERT(CONDITION, ERROR_TYPE) ((void) 0)
+#endif
+
 /**
  * @brief Standard macro function for unimplemented functions
  * 
@@ -104,6 +145,11 @@ Type_t *create_matrix(const uint16_t , const uint16_t, bool );
 void free_vector(Type_t *);
 void free_matrix(Type_t *);
 
+uint16_t get_threads_num(void);
+size_t get_l2_cache_bytes(void);
+void get_cpu_name(char *, size_t);
+const char *ANN_Status_Name(ANN_Status_t);
+
 //uint16_t get_vector_length(double *);
 
 //void mallocValidity(void *);
@@ -0,0 +1,100 @@
+/**
+ * @file HALF.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief 16 bits weights storage header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _HALF_H
+#define _HALF_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define HALF_FP16_MAX ((const double) 65504.0)   // The largest finite IEEE half.
+
+/** @defgroup Kernel selection parameters (The runs & rounds of PRUNE_TIMING_RUNS, PRUNE_TIMING_ROUNDS) */
+#define HALF_TIMING_ROWS ((const uint16_t) 32)   // The batch rows of the timed batched products.
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for the 16 bits weights of one layer
+ *
+ */
+typedef struct _Half_Layer_t
+{
+    Half_Matrix_t *weights;
+
+    // The 16 bits kernel runs where it was measured faster. (The double weights otherwise)
+    bool single_half;        // One sample. (VxHM_DotProduct_Unchecked)
+    bool batch_half;         // The batched passes. (BxHM_DotProduct_Unchecked)
+
+    // The measured product times. (Fastest round / PRUNE_TIMING_RUNS, batch: HALF_TIMING_ROWS rows)
+    double single_double_ns;
+    double single_half_ns;
+    double batch_double_ns;
+    double batch_half_ns;
+
+    // The rounding of the original weights.
+    double max_error;        // The largest |weight - half(weight)|.
+    double relative_error;   // ||Weights - Half(Weights)|| / ||Weights||. (Frobenius)
+}Half_Layer_t;
+
+/**
+ * @brief Struct for the 16 bits weights of a network. (Compress_Network)
+ *
+ */
+typedef struct _Half_Weights_t
+{
+    // The model version they were built from. (Another version: The double weights run)
+    uint64_t version;
+
+    Half_Format_t format;
+
+    uint16_t layers_num;
+    Half_Layer_t *layers;   // [layers_num]
+}Half_Weights_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Half Main Functions */
+ANN_Status_t Compress_Network(DNN_Network *, Half_Format_t);
+void Free_Half_Weights(Half_Weights_t *);
+
+/** @defgroup Half Sub Functions */
+const char *Half_Format_Name(Half_Format_t);
+void print_half_report(DNN_Network *);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_HALF_H
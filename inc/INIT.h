@@ -0,0 +1,60 @@
+/**
+ * @file INIT.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Weights initialization header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _INIT_H
+#define _INIT_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Initialization parameters */
+#define INIT_UNIFORM_LIMIT  ((const double) 0.05)
+#define INIT_NORMAL_STDDEV  ((const double) 0.05)
+#define INIT_PARALLEL_MIN   ((const uint32_t) 16384) // Elements before splitting a matrix between threads.
+#define INIT_MAX_THREADS    ((const uint8_t) 16)
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Initialization Main Functions */
+void Init_Matrix(Type_t *, Init_Scheme_t, uint64_t, uint64_t);
+void Init_Vector(Type_t *, Init_Scheme_t, uint64_t, uint64_t);
+void Init_Network(DNN_Network *, const Init_Scheme_t *, uint64_t);
+
+/** @defgroup Initialization Sub Functions */
+void Init_Set_Seed(uint64_t);
+void Init_Set_Stream(uint64_t);
+uint64_t Init_Get_Seed(void);
+uint64_t Init_Next_Stream(void);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_INIT_H
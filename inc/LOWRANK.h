@@ -0,0 +1,107 @@
+/**
+ * @file LOWRANK.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Low rank factorized layers header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _LOWRANK_H
+#define _LOWRANK_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Enum for the rank choice of the factorized layers
+ *
+ */
+typedef enum _LowRank_Target_t
+{
+    LOWRANK_TARGET_ERROR = 0,  // The smallest rank under a relative (Frobenius) error of the weights. (0, 1)
+    LOWRANK_TARGET_SPEEDUP     // The largest rank over a products flops speedup. (> 1)
+}LowRank_Target_t;
+
+/**
+ * @brief Struct for one factorized layer: Weights ~ Up x Down
+ *
+ */
+typedef struct _LowRank_Layer_t
+{
+    // (0: Not factorized, the rank for this target saves nothing)
+    uint16_t rank;
+
+    // ||Weights - Up x Down|| / ||Weights||. (Of the weights before Factorize_Network)
+    double error;
+
+    Type_t *down;   // [rank x in]  The singular values x the right singular vectors.
+    Type_t *up;     // [out x rank] The left singular vectors.
+}LowRank_Layer_t;
+
+/**
+ * @brief Struct for the factorized layers of a network. (Factorize_Network)
+ *
+ */
+typedef struct _LowRank_Weights_t
+{
+    // The model version they were built from. (Another version: The dense weights run)
+    uint64_t version;
+
+    uint16_t layers_num;
+    LowRank_Layer_t *layers;   // [layers_num]
+
+    // The products between the two factors. (NULL: No factorized layer)
+    uint16_t max_rank;
+    Type_t *rank_vector;       // [max_rank]
+    Type_t *batch_workspace;   // [batch x max_rank] (Created by the batched forward pass)
+}LowRank_Weights_t;
+
+/**
+ * @brief Struct for the outputs drift of a factorized network against the original one
+ *
+ */
+typedef struct _LowRank_Drift_t
+{
+    uint16_t samples;
+
+    double max_abs;            // The largest |factorized - original| output.
+    double mean_abs;           // The mean |factorized - original| output.
+    double argmax_agreement;   // The samples of the same largest output / samples.
+}LowRank_Drift_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup LowRank Main Functions */
+ANN_Status_t Factorize_Network(DNN_Network *, LowRank_Target_t, double, Type_t *, uint16_t, LowRank_Drift_t *);
+void Free_LowRank_Weights(LowRank_Weights_t *);
+
+/** @defgroup LowRank Sub Functions */
+void print_lowrank_report(DNN_Network *, LowRank_Drift_t *);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_LOWRANK_H
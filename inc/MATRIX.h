@@ -35,6 +35,13 @@
 #define MAX_MATRIX_ROW ((const uint8_t) 200)
 #define MAX_MATRIX_COL ((const uint8_t) 200)
 
+// One sided Jacobi SVD: Sweeps limit & the orthogonality reached. (Matrix_SVD)
+#define SVD_MAX_SWEEPS ((const uint8_t) 40)
+#define SVD_TOLERANCE  ((const double) 1e-15)
+
+// Contiguous columns of a block of a BSR matrix. (One SIMD register of doubles)
+#define SPARSE_BLOCK_COLS ((const uint8_t) 4)
+
 /*
 ----------------------------------------------------------------
 !-                       DEFINED STRUCTS                       -
@@ -68,6 +75,107 @@ typedef union _Type_t
     
 }Type_t; // End Union. (Type_t)
 
+/**
+ * @brief Struct for a borrowed (non owning) vector: (data, len, stride)
+ *          - Reads data[i * stride] for i in [0, len). The library never frees nor writes it.
+ *          - Rows of a mmap'd file, a receive buffer or a column of a row major array.
+ * 
+ */
+typedef struct _Tensor_View_t
+{
+    const double *data;
+    uint16_t len;
+
+    // Elements between two consecutive values. (0, 1: Contiguous)
+    uint32_t stride;
+}Tensor_View_t;
+
+/**
+ * @brief Struct for a borrowed sparse vector: The (indices[k], values[k]) non zero elements of a len long vector
+ *          - One-hot & bag of features inputs: values NULL means every value is 1.0.
+ *          - The indices may come in any order. A repeated index adds its values.
+ * 
+ */
+typedef struct _Sparse_Vector_t
+{
+    const uint16_t *indices;
+    const double *values;
+
+    uint16_t nnz;   // Non zero elements.
+    uint16_t len;   // The dense length. (0: No vector)
+}Sparse_Vector_t;
+
+/**
+ * @brief Enum for the storage formats of a sparse matrix
+ * 
+ */
+typedef enum _Sparse_Format_t
+{
+    SPARSE_FORMAT_CSR = 0,  // Compressed rows: One (column, value) per non zero element.
+    SPARSE_FORMAT_BSR       // Block compressed rows: One (first column, SPARSE_BLOCK_COLS values) per non zero block.
+}Sparse_Format_t;
+
+/**
+ * @brief Struct for an owned sparse copy of a [row x col] matrix
+ *          - Row i stores the elements [row_start[i], row_start[i + 1]) in increasing columns.
+ *          - BSR blocks start at multiples of SPARSE_BLOCK_COLS. (Zero padded past col)
+ * 
+ */
+typedef struct _Sparse_Matrix_t
+{
+    Sparse_Format_t format;
+
+    uint16_t row;
+    uint16_t col;
+
+    uint32_t stored;      // Stored elements: Non zero values (CSR) or blocks (BSR).
+    uint32_t nnz;         // Non zero values of the dense matrix.
+
+    uint32_t *row_start;  // [row + 1]
+    uint16_t *columns;    // [stored] The column (CSR) or the first column (BSR).
+    double *values;       // [stored] (CSR) or [stored x SPARSE_BLOCK_COLS] (BSR)
+}Sparse_Matrix_t;
+
+/**
+ * @brief Enum for the 16 bits floating point formats of the weights
+ * 
+ */
+typedef enum _Half_Format_t
+{
+    HALF_FORMAT_BF16 = 0,  // bfloat16: 8 exponent & 7 mantissa bits. (The float range, ~3 significant digits)
+    HALF_FORMAT_FP16       // IEEE half: 5 exponent & 10 mantissa bits. (|x| <= 65504, ~4 significant digits)
+}Half_Format_t;
+
+/**
+ * @brief Struct for an owned 16 bits copy of a [row x col] matrix
+ *          - Row major in one contiguous block: A quarter of the bytes of the double rows.
+ * 
+ */
+typedef struct _Half_Matrix_t
+{
+    Half_Format_t format;
+
+    uint16_t row;
+    uint16_t col;
+
+    uint16_t *values;   // [row x col]
+}Half_Matrix_t;
+
+/**
+ * @brief Enum for the status codes of the checked functions
+ *          - The checked functions return them instead of exiting. (Serving processes)
+ * 
+ */
+typedef enum _ANN_Status_t
+{
+    ANN_OK = 0,
+    ANN_ERROR_NULL,     // A NULL network, tensor, data or function.
+    ANN_ERROR_INVALID,  // A zero size or an out of range parameter.
+    ANN_ERROR_LIMIT,    // A size above its MAX limit.
+    ANN_ERROR_SHAPE,    // Sizes that don't match each other.
+    ANN_ERROR_IO        // A file that can't be opened, read or written.
+}ANN_Status_t;
+
 /*
 ----------------------------------------------------------------
 !-                       DEFINED FUNCTIONS                     -
@@ -75,12 +183,47 @@ typedef union _Type_t
 */
 
 /** @defgroup Matrix Main Functions */
-double *VxM_DotProduct(Type_t *, Type_t *);
+double *VxM_DotProduct(Type_t *, Type_t *);   // (malloc: Free the result with free)
+void VxM_DotProduct_Into(Type_t *, Type_t *, double *);
+void BxM_DotProduct(Type_t *, Type_t *, Type_t *, uint16_t);
+
+/** @defgroup Matrix Unchecked Functions (Shapes validated once by the caller) */
+void VxM_DotProduct_Unchecked(Type_t *, Type_t *, double *);
+void BxM_DotProduct_Unchecked(Type_t *, Type_t *, Type_t *, uint16_t);
+void ViewxM_DotProduct_Unchecked(const Tensor_View_t *, Type_t *, double *);
+void SparsexM_DotProduct_Unchecked(const Sparse_Vector_t *, Type_t *, double *);
+void VxSM_DotProduct_Unchecked(const double *, const Sparse_Matrix_t *, double *);
+void BxSM_DotProduct_Unchecked(Type_t *, const Sparse_Matrix_t *, Type_t *, uint16_t);
+void VxHM_DotProduct_Unchecked(const double *, const Half_Matrix_t *, double *);
+void BxHM_DotProduct_Unchecked(Type_t *, const Half_Matrix_t *, Type_t *, uint16_t);
 // void matrix_inverse(Type_t *);
 // void vector_inverse(Type_t *);
 
 /** @defgroup Matrix Sub Functions */
 void dotProduct_Validity(Type_t *, Type_t *);
+ANN_Status_t dotProduct_Check(Type_t *, Type_t *);
+ANN_Status_t BxM_DotProduct_Check(Type_t *, Type_t *, Type_t *, uint16_t);
+ANN_Status_t Tensor_View_Check(const Tensor_View_t *);
+ANN_Status_t Sparse_Vector_Check(const Sparse_Vector_t *);
+
+/** @defgroup Tensor View Functions */
+Tensor_View_t Tensor_View(const double *, uint16_t, uint32_t);
+Tensor_View_t Tensor_View_Row(Type_t *, uint16_t);
+Sparse_Vector_t Sparse_Vector(const uint16_t *, const double *, uint16_t, uint16_t);
+
+/** @defgroup Sparse Matrix Functions */
+Sparse_Matrix_t *Sparse_Matrix_Create(Type_t *, Sparse_Format_t);
+void Sparse_Matrix_Free(Sparse_Matrix_t *);
+size_t Sparse_Matrix_Bytes(const Sparse_Matrix_t *);
+
+/** @defgroup Half Matrix Functions */
+Half_Matrix_t *Half_Matrix_Create(Type_t *, Half_Format_t);
+void Half_Matrix_Free(Half_Matrix_t *);
+uint16_t Half_Encode(double, Half_Format_t);
+double Half_Decode(uint16_t, Half_Format_t);
+
+/** @defgroup Matrix Decomposition Functions */
+ANN_Status_t Matrix_SVD(Type_t *, Type_t *, double *, Type_t *);
 
 #ifdef __cplusplus
     }
@@ -0,0 +1,129 @@
+/**
+ * @file MEMORY.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Memory accounting header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _MEMORY_H
+#define _MEMORY_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Memory accounting parameters */
+#define MEMORY_HEADER_SIZE ((const size_t) 32)          // Bytes before every block. (User bytes stay 32 bytes aligned)
+#define MEMORY_BLOCK_MAGIC ((const uint32_t) 0x4D454D42u) // ("MEMB") Marks the blocks of Memory_Alloc.
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Enum for the allocation categories
+ *
+ */
+typedef enum _Memory_Category_t
+{
+    MEMORY_OTHER = 0,    // Network structures & user tensors.
+    MEMORY_WEIGHTS,      // The weights & the biases.
+    MEMORY_ACTIVATIONS,  // The layers vectors & the batch workspaces.
+    MEMORY_GRADIENTS,    // The training gradients & errors.
+    MEMORY_OPTIMIZER,    // The optimizer state.
+    MEMORY_TEMPORARY,    // Results handed to the caller. (VxM_DotProduct)
+    MEMORY_DATASET,      // The dataset readers buffers.
+    MEMORY_CATEGORIES_NUM
+}Memory_Category_t;
+
+/**
+ * @brief Struct for the live allocation counters of a network or of the process
+ *
+ */
+typedef struct _Memory_Stats_t
+{
+    atomic_int_fast64_t current[MEMORY_CATEGORIES_NUM];
+    atomic_int_fast64_t peak[MEMORY_CATEGORIES_NUM];
+
+    atomic_int_fast64_t total_current;
+    atomic_int_fast64_t total_peak;
+
+    atomic_uint_fast64_t allocations;
+    atomic_uint_fast64_t frees;
+}Memory_Stats_t;
+
+/**
+ * @brief Struct for a snapshot of the counters (Bytes)
+ *
+ */
+typedef struct _Memory_Report_t
+{
+    int64_t current[MEMORY_CATEGORIES_NUM];
+    int64_t peak[MEMORY_CATEGORIES_NUM];
+
+    int64_t total_current;
+    int64_t total_peak;
+
+    uint64_t allocations;
+    uint64_t frees;
+}Memory_Report_t;
+
+/**
+ * @brief Struct for the allocation context of a thread
+ *          - create_vector & create_matrix charge their blocks to it.
+ *
+ */
+typedef struct _Memory_Context_t
+{
+    Memory_Stats_t *owner; // (NULL: The process only)
+    Memory_Category_t category;
+}Memory_Context_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Memory Main Functions */
+void *Memory_Alloc(size_t, Memory_Category_t);
+void *Memory_Calloc(size_t, Memory_Category_t);
+void Memory_Free(void *);
+
+void Memory_Get_Process_Report(Memory_Report_t *);
+void Memory_Get_Network_Report(DNN_Network *, Memory_Report_t *);
+void print_memory_report(DNN_Network *);
+
+/** @defgroup Memory Sub Functions */
+Memory_Context_t Memory_Enter(Memory_Stats_t *, Memory_Category_t);
+void Memory_Leave(Memory_Context_t);
+Memory_Category_t Memory_Current_Category(void);
+Memory_Stats_t *Memory_Create_Stats(void);
+uint64_t Memory_Allocations(void);
+const char *Memory_Category_Name(Memory_Category_t);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_MEMORY_H
@@ -0,0 +1,102 @@
+/**
+ * @file MODEL.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Model files (save & load trained networks) header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _MODEL_H
+#define _MODEL_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Model file parameters */
+#define MODEL_FILE_MAGIC   "ANNM"
+#define MODEL_FILE_VERSION ((const uint16_t) 1)
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for the model file header.
+ *          - File visual view:
+                [Header (64 bytes)]
+                [Weights 0]   => [row 0: col doubles] .. [row r]
+                .
+                [Weights n]   => (n = hidden_layer_num)
+                [Biases]      => (hidden_layer_num + 1) doubles
+            - Every value is a native double.
+            - The functions are saved as their kinds. (Custom activations & losses can't be saved)
+ *
+ */
+#pragma pack(push, 1)
+typedef struct _Model_Header_t
+{
+    char     magic[4];
+    uint16_t version;
+    uint16_t input_dense;
+    uint16_t output_dense;
+    uint16_t hidden_layer_num;
+    uint16_t hidden_layer_dense;
+
+    uint8_t  activation;
+    uint8_t  output_activation;
+    uint8_t  loss;
+    uint8_t  optimizer;
+
+    double   activation_alpha;
+    double   learning_rate;
+    uint64_t seed;
+
+    uint8_t  reserved[22];
+}Model_Header_t;
+#pragma pack(pop)
+
+/**
+ * @brief Struct for the topology & config of a loaded network. (Owned & freed by the network)
+ *
+ */
+typedef struct _Network_Settings_t
+{
+    Network_Topology_t network_topology;
+    Network_Config_t   network_config;
+}Network_Settings_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Model Main Functions */
+ANN_Status_t Save_Network(DNN_Network *, const char *);
+ANN_Status_t Load_Network(const char *, DNN_Network **);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_MODEL_H
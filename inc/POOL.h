@@ -0,0 +1,77 @@
+/**
+ * @file POOL.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Thread local size classes pool header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _POOL_H
+#define _POOL_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Pool parameters */
+#define POOL_ALIGNMENT         ((const size_t) 64)          // Alignment of the pooled blocks. (Cache line)
+#define POOL_MIN_CLASS_SHIFT   ((const uint8_t) 6)          // Smallest class: 64 bytes.
+#define POOL_CLASSES_NUM       ((const uint8_t) 8)          // 64, 128, .. 8192 bytes.
+#define POOL_MAX_CACHED_BYTES  ((const size_t) (1u << 20))  // Free bytes kept per class & per thread.
+#define POOL_NO_CLASS          ((const uint8_t) 0xFF)       // Blocks bigger than the last class. (Heap)
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for the pool counters of a thread
+ *
+ */
+typedef struct _Pool_Stats_t
+{
+    uint64_t hits;          // Blocks taken from the thread cache.
+    uint64_t misses;        // Blocks taken from the heap.
+    uint64_t cached_blocks; // Free blocks kept by the thread.
+    uint64_t cached_bytes;
+}Pool_Stats_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Pool Main Functions */
+void *Pool_Get(size_t, uint8_t *);
+void Pool_Put(void *, uint8_t);
+void Pool_Trim(void);
+
+/** @defgroup Pool Sub Functions */
+void Pool_Get_Stats(Pool_Stats_t *);
+size_t Pool_Class_Size(uint8_t);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_POOL_H
@@ -0,0 +1,178 @@
+/**
+ * @file PROFILE.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Per layer profiling counters header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _PROFILE_H
+#define _PROFILE_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+#ifdef ANN_ENABLE_PROFILING
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Enum for the profiled phases of a layer
+ *          - forward_propagation: GEMM, BIAS, ACTIVATION, DROPOUT.
+ *          - back_propagation:    LOSS, GRADIENT, DELTA.
+ *          - optimizer:           OPTIMIZER.
+ *
+ */
+typedef enum _Profile_Phase_t
+{
+    PROFILE_PHASE_GEMM = 0,    // Weights (dot product) inputs.
+    PROFILE_PHASE_BIAS,        // Adding the biases.
+    PROFILE_PHASE_ACTIVATION,  // The activation function.
+    PROFILE_PHASE_DROPOUT,     // The dropout mask random numbers. (Training only, applied in the activation)
+    PROFILE_PHASE_LOSS,        // The loss & the output error. (Output layer)
+    PROFILE_PHASE_GRADIENT,    // dE/dWeights & dE/dBias.
+    PROFILE_PHASE_DELTA,       // The error of the previous layer.
+    PROFILE_PHASE_OPTIMIZER,   // The weights update.
+    PROFILE_PHASES_NUM
+}Profile_Phase_t;
+
+/**
+ * @brief Struct for the counters of one (layer, phase)
+ *
+ */
+typedef struct _Profile_Counter_t
+{
+    uint64_t calls;
+    uint64_t ticks;
+
+    double flops;
+    double bytes; // Bytes touched. (Read & written once)
+}Profile_Counter_t;
+
+/**
+ * @brief Struct for the profiling counters of a network
+ *          - counters[layer]: The weights layer index. (Output layer = hidden_layer_num)
+ *
+ */
+typedef struct _Network_Stats_t
+{
+    // False if the library was built without ANN_ENABLE_PROFILING.
+    bool enabled;
+
+    uint16_t layers_num;
+
+    // Converts the ticks to nanoseconds.
+    double ticks_per_ns;
+
+    Profile_Counter_t counters[MAX_HIDDEN_LAYER_NUM + 1][PROFILE_PHASES_NUM];
+}Network_Stats_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Profile Main Functions */
+void Get_Network_Stats(DNN_Network *, Network_Stats_t *);
+void Reset_Network_Stats(DNN_Network *);
+void print_network_stats(DNN_Network *);
+
+/** @defgroup Profile Sub Functions */
+Network_Stats_t *Profile_Create_Stats(uint16_t);
+const char *Profile_Phase_Name(Profile_Phase_t);
+double Profile_Ticks_Per_Ns(void);
+uint64_t Profile_Now_Ns(void);
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#ifdef ANN_ENABLE_PROFILING
+
+/**
+ * @brief Function to read the time stamp counter. (Monotonic nanoseconds if there is none)
+ *
+ * @return uint64_t
+ */
+static inline uint64_t Profile_Ticks(void)
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+    return (uint64_t) __rdtsc();
+#else
+    return Profile_Now_Ns();
+#endif
+}//end Profile_Ticks.
+
+/**
+ * @brief Function to add one measurement to a (layer, phase) counter.
+ *
+ * @param stats
+ * @param layer
+ * @param phase
+ * @param ticks
+ * @param flops
+ * @param bytes
+ */
+static inline void Profile_Record(Network_Stats_t *stats, uint16_t layer, Profile_Phase_t phase,
+                                  uint64_t ticks, double flops, double bytes)
+{
+    Profile_Counter_t *counter = &stats->counters[layer][phase];
+
+    counter->calls++;
+    counter->ticks += ticks;
+    counter->flops += flops;
+    counter->bytes += bytes;
+
+    return;
+}//end Profile_Record.
+
+/**
+ * @brief Standard macro functions to time a phase of a layer. (Compiled out by default)
+ *          PROFILE_BEGIN(start); ... PROFILE_END(network, layer, phase, start, flops, bytes);
+ *
+ */
+#define PROFILE_BEGIN(START) \
+    const uint64_t START = Profile_Ticks()
+
+#define PROFILE_END(NETWORK, LAYER, PHASE, START, FLOPS, BYTES) \
+    Profile_Record((NETWORK)->network_layers->Network_stats, (LAYER), (PHASE), \
+                   Profile_Ticks() - (START), (double) (FLOPS), (double) (BYTES))
+
+#else
+
+#define PROFILE_BEGIN(START)
+// (The work arguments are still referenced, so their variables aren't reported as unused)
+#define PROFILE_END(NETWORK, LAYER, PHASE, START, FLOPS, BYTES) ((void) (FLOPS), (void) (BYTES))
+
+#endif //ANN_ENABLE_PROFILING
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_PROFILE_H
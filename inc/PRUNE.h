@@ -0,0 +1,113 @@
+/**
+ * @file PRUNE.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Weights pruning & sparse inference header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _PRUNE_H
+#define _PRUNE_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Kernel selection parameters */
+#define PRUNE_TIMING_RUNS    ((const uint16_t) 32)   // Products per timed round.
+#define PRUNE_TIMING_ROUNDS  ((const uint8_t) 5)     // Rounds per kernel. (The fastest one counts)
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Enum for the pruning methods
+ *
+ */
+typedef enum _Prune_Method_t
+{
+    PRUNE_MAGNITUDE = 0,  // The smallest |weights| of each layer. (CSR friendly)
+    PRUNE_BLOCK           // The SPARSE_BLOCK_COLS wide row blocks of the smallest L2 norm. (BSR friendly)
+}Prune_Method_t;
+
+/**
+ * @brief Enum for the product kernels of a weights layer
+ *
+ */
+typedef enum _Sparse_Kernel_t
+{
+    SPARSE_KERNEL_DENSE = 0,  // VxM_DotProduct_Unchecked on the dense weights.
+    SPARSE_KERNEL_CSR,
+    SPARSE_KERNEL_BSR
+}Sparse_Kernel_t;
+
+/**
+ * @brief Struct for the sparse weights of one layer
+ *
+ */
+typedef struct _Sparse_Layer_t
+{
+    Sparse_Kernel_t kernel;     // The fastest measured kernel.
+    Sparse_Matrix_t *weights;   // Its sparse weights. (NULL: SPARSE_KERNEL_DENSE)
+
+    double density;             // Non zero weights / weights.
+
+    // The measured product times. (Fastest round / PRUNE_TIMING_RUNS)
+    double dense_ns;
+    double csr_ns;
+    double bsr_ns;
+}Sparse_Layer_t;
+
+/**
+ * @brief Struct for the sparse weights of a network. (Sparsify_Network)
+ *
+ */
+typedef struct _Sparse_Weights_t
+{
+    // The model version they were built from. (Another version: The dense kernels run)
+    uint64_t version;
+
+    uint16_t layers_num;
+    Sparse_Layer_t *layers;   // [layers_num]
+}Sparse_Weights_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Prune Main Functions */
+ANN_Status_t Prune_Network(DNN_Network *, double, Prune_Method_t);
+ANN_Status_t Sparsify_Network(DNN_Network *);
+void Free_Sparse_Weights(Sparse_Weights_t *);
+
+/** @defgroup Prune Sub Functions */
+const char *Sparse_Kernel_Name(Sparse_Kernel_t);
+void print_sparse_report(DNN_Network *);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_PRUNE_H
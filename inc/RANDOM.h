@@ -0,0 +1,74 @@
+/**
+ * @file RANDOM.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Counter based random numbers header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _RANDOM_H
+#define _RANDOM_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Random generator parameters */
+#define RANDOM_PHILOX_ROUNDS ((const uint8_t) 10)
+#define RANDOM_LANES         ((const uint8_t) 8) // Blocks generated side by side. (SIMD width)
+
+// Converts a random 32 bits number to a double in [0, 1).
+#define RANDOM_TO_UNIT(U32) ((double) (U32) * (1.0 / 4294967296.0))
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for one Philox4x32 output block. (Four random 32 bits numbers)
+ *
+ */
+typedef struct _Random_Block_t
+{
+    uint32_t value[4];
+}Random_Block_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Random Main Functions */
+Random_Block_t Random_Philox(uint64_t, uint64_t, uint64_t);
+void Random_Fill_U32(uint64_t, uint64_t, uint64_t, uint32_t *, uint32_t);
+uint64_t Random_U64(uint64_t, uint64_t);
+
+/** @defgroup Random Sub Functions */
+uint64_t Random_Key(uint64_t, uint64_t);
+uint32_t Random_Thread_Id(void);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_RANDOM_H
@@ -0,0 +1,127 @@
+/**
+ * @file TRACE.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Chrome trace events timeline header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _TRACE_H
+#define _TRACE_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Trace parameters */
+#define TRACE_RING_SIZE         ((const uint32_t) (1u << 15)) // Events per thread buffer. (Power of 2)
+#define TRACE_FLUSH_INTERVAL_MS ((const uint32_t) 2)          // Sleep of the flush thread between two drains.
+
+/** @defgroup Trace categories */
+#define TRACE_CAT_TRAIN     "train"
+#define TRACE_CAT_INFERENCE "inference"
+#define TRACE_CAT_LAYER     "layer"
+#define TRACE_CAT_DATA      "data"
+#define TRACE_CAT_OPTIMIZER "optimizer"
+#define TRACE_CAT_SYNC      "sync"      // Reductions & barriers between workers.
+
+// True while a trace is recorded. (Defined in TRACE.c)
+extern atomic_bool trace_enabled;
+
+/**
+ * @brief Standard macro functions to record the begin & the end of a traced span.
+ *          - NAME & CATEGORY must be static strings. (Only their pointers are stored)
+ *          - One relaxed atomic load when no trace is recorded.
+ *
+ */
+#define TRACE_BEGIN(NAME, CATEGORY) \
+    do { \
+        if(atomic_load_explicit(&trace_enabled, memory_order_relaxed)) \
+            Trace_Record((NAME), (CATEGORY), 'B'); \
+    } while(0)
+
+#define TRACE_END(NAME, CATEGORY) \
+    do { \
+        if(atomic_load_explicit(&trace_enabled, memory_order_relaxed)) \
+            Trace_Record((NAME), (CATEGORY), 'E'); \
+    } while(0)
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for one trace event
+ *
+ */
+typedef struct _Trace_Event_t
+{
+    const char *name;
+    const char *category;
+
+    uint64_t timestamp_ns;
+
+    // 'B': Begin, 'E': End.
+    char phase;
+}Trace_Event_t;
+
+/**
+ * @brief Struct for the events buffer of one thread. (Single producer, single consumer ring)
+ *          - The owning thread only writes (head), the flush thread only writes (tail).
+ *
+ */
+typedef struct _Trace_Ring_t
+{
+    Trace_Event_t events[TRACE_RING_SIZE];
+
+    atomic_uint_fast64_t head;
+    atomic_uint_fast64_t tail;
+
+    uint32_t thread_id;
+    const char *_Atomic thread_name;
+    bool thread_name_written;
+
+    // The next thread buffer. (All the buffers, in a lock free list)
+    struct _Trace_Ring_t *next;
+}Trace_Ring_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Trace Main Functions */
+void Trace_Start(const char *);
+void Trace_Stop(void);
+void Trace_Record(const char *, const char *, char);
+
+/** @defgroup Trace Sub Functions */
+void Trace_Thread_Name(const char *);
+const char *Trace_Layer_Name(uint16_t);
+uint64_t Trace_Dropped(void);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_TRACE_H
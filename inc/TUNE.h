@@ -0,0 +1,103 @@
+/**
+ * @file TUNE.h
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Batched passes autotuning header file.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#ifndef _TUNE_H
+#define _TUNE_H
+
+#ifdef _cplusplus
+    extern "C"{
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       INCLUDED HEADERS                      -
+----------------------------------------------------------------
+*/
+
+#include "Global.h"
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Tuning parameters */
+#define TUNE_TIMING_ROUNDS      ((const uint8_t) 3)      // Timed batched passes per tile. (The fastest one counts)
+#define TUNE_INPUTS_SEED        ((const uint64_t) 7)     // Seed of the timed inputs. (Any: The values don't change the timings)
+#define TUNE_MAX_TILES          ((const uint16_t) 8)     // The candidate tiles: 4, 8, .. 128 & MAX_MATRIX_ROW.
+#define TUNE_CACHE_MAX_ENTRIES  ((const uint16_t) 256)   // Entries kept by a tuning cache file. (The oldest go first)
+#define TUNE_CPU_NAME_LEN       ((const uint16_t) 96)
+#define TUNE_WEIGHTS_NAME_LEN   ((const uint16_t) 8)
+#define TUNE_LINE_LEN           ((const uint16_t) 512)
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for what a tuning depends on: The machine, the shapes & the weights kernels
+ *
+ */
+typedef struct _Tune_Key_t
+{
+    char cpu_name[TUNE_CPU_NAME_LEN];   // (get_cpu_name)
+
+    uint16_t input_dense;
+    uint16_t hidden_dense;
+    uint16_t hidden_num;
+    uint16_t output_dense;
+    uint16_t batch_size;
+
+    // The kernels of the weights: dense, pruned, lowrank, bf16 or fp16.
+    char weights[TUNE_WEIGHTS_NAME_LEN];
+}Tune_Key_t;
+
+/**
+ * @brief Struct for the result of Tune_Network. (Also one line of a tuning cache file)
+ *
+ */
+typedef struct _Tune_Result_t
+{
+    Tune_Key_t key;
+
+    // Read from the tuning cache: Nothing was timed. (Only the winner's times)
+    bool cached;
+
+    uint16_t batch_tile;    // The fastest tile. (Set_Batch_Tile, MAX_MATRIX_ROW: Layer by layer)
+    double tile_ns;         // Its batched pass.
+    double layerwise_ns;    // The layer by layer batched pass.
+
+    // The timed candidates. (0: Cached)
+    uint16_t tiles_num;
+    uint16_t tiles[TUNE_MAX_TILES];
+    double tiles_ns[TUNE_MAX_TILES];
+}Tune_Result_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED FUNCTIONS                     -
+----------------------------------------------------------------
+*/
+
+/** @defgroup Tune Main Functions */
+ANN_Status_t Tune_Network(DNN_Network *, uint16_t, const char *, Tune_Result_t *);
+
+/** @defgroup Tune Sub Functions */
+void print_tune_report(const Tune_Result_t *);
+
+#ifdef __cplusplus
+    }
+#endif
+//!=============================> .END
+#endif //_TUNE_H
@@ -47,6 +47,1065 @@ Network_Config_t general_network_config = {.learning_rate = 0.2549, .dropout = f
 */
 
 #define ELU_CONST_ALPHA ((const double) 1.0f)
+#define LOSS_EPSILON    ((const double) 1e-12) // Keeps the log() of the losses finite.
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the vector a weights layer reads.
+ *          - Weights[0] reads the input layer, Weights[n] reads Hidden[n-1].
+ * 
+ * @param dnn_network 
+ * @param layer The weights layer index.
+ * @return Type_t* 
+ */
+static inline Type_t *network_layer_input(DNN_Network *dnn_network, uint16_t layer)
+{
+    return (layer == 0) ? 
+           (dnn_network->network_layers->Input_layer->input_layer) : 
+           (dnn_network->network_layers->Hidden_layer[layer - 1].hidden_layer);
+}//end network_layer_input.
+
+/**
+ * @brief Function to get the vector a weights layer writes.
+ *          - Weights[n] writes Hidden[n], the last weights write the output layer.
+ * 
+ * @param dnn_network 
+ * @param layer The weights layer index.
+ * @return Type_t* 
+ */
+static inline Type_t *network_layer_output(DNN_Network *dnn_network, uint16_t layer)
+{
+    return (layer == dnn_network->network_topology->hidden_layer_num) ? 
+           (dnn_network->network_layers->Output_layer->output_layer) : 
+           (dnn_network->network_layers->Hidden_layer[layer].hidden_layer);
+}//end network_layer_output.
+
+/**
+ * @brief Function to get the dropout random stream of a hidden layer at a training step.
+ *          - The backward pass regenerates the same masks from it instead of storing them.
+ * 
+ * @param step 
+ * @param layer 
+ * @return uint64_t 
+ */
+static inline uint64_t network_dropout_stream(uint64_t step, uint16_t layer)
+{
+    return (step << 16) | layer;
+}//end network_dropout_stream.
+
+/**
+ * @brief Function to get the dropout key of a network. (The seed & the random stream of its config)
+ * 
+ * @param dnn_network 
+ * @return uint64_t 
+ */
+static inline uint64_t network_dropout_key(DNN_Network *dnn_network)
+{
+    return Random_Key(dnn_network->network_config->seed, dnn_network->network_config->random_stream);
+}//end network_dropout_key.
+
+/**
+ * @brief Function to get the keep threshold of 32 bits random numbers for a dropout rate.
+ * 
+ * @param dropout_rate 
+ * @return uint32_t A neuron is kept if its random number is below the threshold.
+ */
+static inline uint32_t network_dropout_threshold(double dropout_rate)
+{
+    return (uint32_t) fmin((1.0 - dropout_rate) * 4294967296.0, 4294967295.0);
+}//end network_dropout_threshold.
+
+/**
+ * @brief Function to check if a network trains with dropout.
+ * 
+ * @param dnn_network 
+ * @return true 
+ * @return false 
+ */
+static inline bool network_dropout_active(DNN_Network *dnn_network)
+{
+    return (dnn_network->network_config->dropout == true) && (dnn_network->network_config->dropout_rate > 0.0);
+}//end network_dropout_active.
+
+/**
+ * @brief Function to get the kind of an activation function pointer.
+ * 
+ * @param activation_function 
+ * @return Activation_t (ACTIVATION_CUSTOM: Not a library function)
+ */
+static Activation_t network_activation_of(double * (*activation_function) (Type_t *))
+{
+    if(activation_function == &ReLU)
+        return ACTIVATION_RELU;
+
+    if(activation_function == &ELU)
+        return ACTIVATION_ELU;
+
+    if(activation_function == &Sigmoid)
+        return ACTIVATION_SIGMOID;
+
+    if(activation_function == &Tanh)
+        return ACTIVATION_TANH;
+
+    if(activation_function == &SoftMax)
+        return ACTIVATION_SOFTMAX;
+
+    return ACTIVATION_CUSTOM;
+}//end network_activation_of.
+
+/**
+ * @brief Function to resolve the activations a network runs. (At its creation)
+ * 
+ * @param network_topology 
+ * @return Activation_Plan_t 
+ */
+static Activation_Plan_t network_activation_plan(Network_Topology_t *network_topology)
+{
+    Activation_Plan_t plan;
+
+    plan.hidden = (network_topology->activation != ACTIVATION_CUSTOM) ? 
+                  (network_topology->activation) : 
+                  (network_activation_of(network_topology->activation_function));
+
+    plan.output = (network_topology->output_activation != ACTIVATION_CUSTOM) ? 
+                  (network_topology->output_activation) : 
+                  (network_activation_of(network_topology->output_activation_function));
+
+    plan.alpha = (network_topology->activation_alpha > 0.0) ? 
+                 (network_topology->activation_alpha) : 
+                 (ELU_CONST_ALPHA);
+
+    return plan;
+}//end network_activation_plan.
+
+/**
+ * @brief Function to drop or scale one activated neuron. (Inverted dropout)
+ *          - A constant NULL mask is compiled out of the inlined kernels.
+ * 
+ * @param mask (NULL: No dropout)
+ * @param i 
+ * @param value The activated neuron.
+ * @return double 
+ */
+static inline double network_dropout_keep(const Dropout_Mask_t *mask, uint16_t i, double value)
+{
+    if(mask == NULL)
+        return value;
+
+    return (mask->randoms[i] < mask->keep_threshold) ? (value * mask->keep_scale) : (0.0);
+}//end network_dropout_keep.
+
+/**
+ * @brief The fused activation kernels: x[i] = mask(activation(x[i] + bias)).
+ *          - One switch per layer, every case is a plain loop the compiler can vectorize.
+ * 
+ * @param activation (ACTIVATION_CUSTOM: Nothing, the caller runs its function)
+ * @param alpha The ELU alpha.
+ * @param bias 
+ * @param x 
+ * @param len 
+ * @param mask The dropout mask of the layer. (NULL: No dropout)
+ */
+static inline void network_activate(Activation_t activation, double alpha, double bias, double *x, uint16_t len, const Dropout_Mask_t *mask)
+{
+    switch(activation)
+    {
+        case ACTIVATION_RELU:
+            for(uint16_t i = 0; i < len; i++)
+            {
+                const double value = x[i] + bias;
+                x[i] = network_dropout_keep(mask, i, (value > 0.0) ? (value) : (0.0));
+            }
+            break;
+
+        case ACTIVATION_ELU:
+            for(uint16_t i = 0; i < len; i++)
+            {
+                const double value = x[i] + bias;
+                x[i] = network_dropout_keep(mask, i, (value < 0.0) ? (alpha * (exp(value) - 1.0)) : (value));
+            }
+            break;
+
+        case ACTIVATION_SIGMOID:
+            for(uint16_t i = 0; i < len; i++)
+                x[i] = network_dropout_keep(mask, i, 1.0 / (1.0 + exp(-(x[i] + bias))));
+            break;
+
+        case ACTIVATION_TANH:
+            for(uint16_t i = 0; i < len; i++)
+                x[i] = network_dropout_keep(mask, i, tanh(x[i] + bias));
+            break;
+
+        case ACTIVATION_SOFTMAX:
+        {
+            // Stable form. (The bias shifts every element: Same result)
+            double max_element = x[0];
+
+            for(uint16_t i = 1; i < len; i++)
+                max_element = (x[i] > max_element) ? (x[i]) : (max_element);
+
+            double exponential_sum = 0.0;
+
+            for(uint16_t i = 0; i < len; i++)
+            {
+                x[i] = exp(x[i] - max_element);
+                exponential_sum += x[i];
+            }
+
+            const double inverse_sum = 1.0 / exponential_sum;
+
+            for(uint16_t i = 0; i < len; i++)
+                x[i] = network_dropout_keep(mask, i, x[i] * inverse_sum);
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    return;
+}//end network_activate.
+
+/**
+ * @brief Function to add the bias of a hidden layer & apply its activation, then its dropout mask.
+ * 
+ * @param dnn_network 
+ * @param layer_output 
+ * @param layer The weights layer index.
+ * @param mask (NULL: No dropout)
+ */
+static inline void network_hidden_activation(DNN_Network *dnn_network, Type_t *layer_output, uint16_t layer, const Dropout_Mask_t *mask)
+{
+    const Activation_Plan_t plan = dnn_network->network_layers->Activation_plan; // (Temporary variable for readbility).
+
+    if(plan.hidden == ACTIVATION_CUSTOM)
+    {
+        ApplyBiases(dnn_network->network_layers->Layers_biases->layers_biases, layer_output, (uint8_t) layer);
+        dnn_network->network_topology->activation_function(layer_output);
+
+        // A custom function can't be fused: The mask is a pass of its own.
+        if(mask != NULL)
+        {
+            for(uint16_t i = 0; i < layer_output->Vector_t.len; i++)
+                layer_output->Vector_t.Vector[i] = network_dropout_keep(mask, i, layer_output->Vector_t.Vector[i]);
+        }
+
+        return;
+    }
+
+    network_activate(plan.hidden, plan.alpha, dnn_network->network_layers->Layers_biases->layers_biases->Vector_t.Vector[layer],
+                     layer_output->Vector_t.Vector, layer_output->Vector_t.len, mask);
+
+    return;
+}//end network_hidden_activation.
+
+/**
+ * @brief Function to apply the activation of the output layer. (No bias)
+ * 
+ * @param dnn_network 
+ * @param layer_output 
+ */
+static inline void network_output_activation(DNN_Network *dnn_network, Type_t *layer_output)
+{
+    const Activation_Plan_t plan = dnn_network->network_layers->Activation_plan; // (Temporary variable for readbility).
+
+    if(plan.output == ACTIVATION_CUSTOM)
+    {
+        dnn_network->network_topology->output_activation_function(layer_output);
+        return;
+    }
+
+    network_activate(plan.output, plan.alpha, 0.0, layer_output->Vector_t.Vector, layer_output->Vector_t.len, NULL);
+
+    return;
+}//end network_output_activation.
+
+/**
+ * @brief Function to check if the output activation & the loss function are a fused pair.
+ *  - (SoftMax, MCCE) => MCCE_Batch, (Sigmoid, BCE) => BCE_Batch.
+ * 
+ * @param dnn_network 
+ * @return true The back propagation runs the fused kernel on the saved logits.
+ */
+static inline bool network_fused_loss(DNN_Network *dnn_network)
+{
+    const Activation_Plan_t plan = dnn_network->network_layers->Activation_plan; // (Temporary variable for readbility).
+    double (*loss_function)(Type_t *, Type_t *) = dnn_network->network_topology->loss_function;
+
+    return ( (plan.output == ACTIVATION_SOFTMAX) && (loss_function == &MCCE) ) ||
+           ( (plan.output == ACTIVATION_SIGMOID) && (loss_function == &BCE) );
+}//end network_fused_loss.
+
+/**
+ * @brief Function to choose the gradient checkpointing interval of a network.
+ *          - Stored vectors: (hidden_layer_num / k) checkpoints + the (k - 1) vectors of the segment buffer.
+ * 
+ * @param network_topology 
+ * @param network_config 
+ * @return uint16_t k. (1: Every hidden layer keeps its activations)
+ */
+static uint16_t network_checkpoint_interval(Network_Topology_t *network_topology, Network_Config_t *network_config)
+{
+    const uint16_t hidden_layers_num = network_topology->hidden_layer_num;
+
+    if(network_config->checkpoint_interval > 0)
+        return (network_config->checkpoint_interval < hidden_layers_num) ? (network_config->checkpoint_interval) : (hidden_layers_num);
+
+    if(network_config->checkpoint_memory_limit == 0)
+        return 1;
+
+    // The smallest interval under the limit. (The fewest recomputations) Or the fewest vectors.
+    const size_t vector_bytes = sizeof(double) * network_topology->hidden_layer_dense;
+
+    uint16_t fewest_interval = 1;
+    size_t fewest_vectors = hidden_layers_num;
+
+    for(uint16_t k = 1; k <= hidden_layers_num; k++)
+    {
+        const size_t stored_vectors = (hidden_layers_num / k) + (k - 1);
+
+        if(stored_vectors * vector_bytes <= network_config->checkpoint_memory_limit)
+            return k;
+
+        if(stored_vectors < fewest_vectors)
+        {
+            fewest_vectors  = stored_vectors;
+            fewest_interval = k;
+        }
+    }
+
+    return fewest_interval;
+}//end network_checkpoint_interval.
+
+/**
+ * @brief Function to choose the rows of a depth-first batch tile.
+ *          - Sized for the L2 cache: The widest weights & the tile rows of the inputs, of the two
+ *            ping-pong activations & of the outputs, so a tile's activations never leave it.
+ * 
+ * @param network_topology 
+ * @param batch_tile The requested rows. (0: Sized for the L2 cache)
+ * @return uint16_t A multiple of BATCH_TILE_MIN_ROWS, up to MAX_MATRIX_ROW. (A whole batch: Layer by layer)
+ */
+static uint16_t network_batch_tile(Network_Topology_t *network_topology, uint16_t batch_tile)
+{
+    if(batch_tile > 0)
+        return (batch_tile < MAX_MATRIX_ROW) ? (batch_tile) : (MAX_MATRIX_ROW);
+
+    const size_t input_dense  = network_topology->input_layer_dense;
+    const size_t hidden_dense = network_topology->hidden_layer_dense;
+    const size_t output_dense = network_topology->output_layer_dense;
+
+    const size_t widest_dense  = (input_dense > hidden_dense) ? ((input_dense > output_dense) ? (input_dense) : (output_dense)) :
+                                                                ((hidden_dense > output_dense) ? (hidden_dense) : (output_dense));
+    const size_t weights_bytes = sizeof(double) * hidden_dense * widest_dense;
+    const size_t row_bytes     = sizeof(double) * (input_dense + (2 * hidden_dense) + output_dense);
+    const size_t cache_bytes   = get_l2_cache_bytes();
+
+    if(cache_bytes <= weights_bytes + (BATCH_TILE_MIN_ROWS * row_bytes))
+        return BATCH_TILE_MIN_ROWS;
+
+    size_t tile_rows = (cache_bytes - weights_bytes) / row_bytes;
+    tile_rows -= tile_rows % BATCH_TILE_MIN_ROWS;
+
+    return (tile_rows < MAX_MATRIX_ROW) ? ((uint16_t) tile_rows) : (MAX_MATRIX_ROW);
+}//end network_batch_tile.
+
+/**
+ * @brief Function to check if a hidden layer keeps its activations. (A checkpoint)
+ * 
+ * @param layers 
+ * @param hidden_layer 
+ * @return true 
+ * @return false Its vector is shared, the backward pass recomputes it.
+ */
+static inline bool network_is_checkpoint(Layer_t *layers, uint16_t hidden_layer)
+{
+    return ((hidden_layer + 1) % layers->Checkpoint_interval) == 0;
+}//end network_is_checkpoint.
+
+/**
+ * @brief Function to get the checkpoint segment of a hidden layer. (The segment buffer holds one)
+ * 
+ * @param layers 
+ * @param hidden_layer 
+ * @return uint16_t 
+ */
+static inline uint16_t network_checkpoint_segment(Layer_t *layers, uint16_t hidden_layer)
+{
+    return hidden_layer / layers->Checkpoint_interval;
+}//end network_checkpoint_segment.
+
+/**
+ * @brief Function to get the sparse weights the product of a layer runs on.
+ * 
+ * @param dnn_network 
+ * @param layer 
+ * @return const Sparse_Matrix_t* (NULL: The dense kernel. Not sparsified, faster dense or changed weights)
+ */
+static inline const Sparse_Matrix_t *network_sparse_weights(DNN_Network *dnn_network, uint16_t layer)
+{
+    const Sparse_Weights_t *sparse_weights = dnn_network->network_layers->Sparse_weights;
+
+    if( (sparse_weights == NULL) || (sparse_weights->version != dnn_network->network_layers->Model_version) )
+        return NULL;
+
+    return sparse_weights->layers[layer].weights;
+}//end network_sparse_weights.
+
+/**
+ * @brief Function to get the low rank factors the product of a layer runs on.
+ * 
+ * @param dnn_network 
+ * @param layer 
+ * @return const LowRank_Layer_t* (NULL: The dense weights. Not factorized or changed weights)
+ */
+static inline const LowRank_Layer_t *network_lowrank_layer(DNN_Network *dnn_network, uint16_t layer)
+{
+    const LowRank_Weights_t *lowrank = dnn_network->network_layers->LowRank_weights;
+
+    if( (lowrank == NULL) || (lowrank->version != dnn_network->network_layers->Model_version) || (lowrank->layers[layer].rank == 0) )
+        return NULL;
+
+    return &lowrank->layers[layer];
+}//end network_lowrank_layer.
+
+/**
+ * @brief Function to get the 16 bits weights the product of a layer runs on.
+ * 
+ * @param dnn_network 
+ * @param layer 
+ * @param batch The batched passes. (false: One sample)
+ * @return const Half_Matrix_t* (NULL: The double weights. Not compressed, changed weights or the
+ *                               double kernel was faster on this path)
+ */
+static inline const Half_Matrix_t *network_half_weights(DNN_Network *dnn_network, uint16_t layer, const bool batch)
+{
+    const Half_Weights_t *half_weights = dnn_network->network_layers->Half_weights;
+
+    if( (half_weights == NULL) || (half_weights->version != dnn_network->network_layers->Model_version) )
+        return NULL;
+
+    const Half_Layer_t *half_layer = &half_weights->layers[layer];
+
+    return ( (batch) ? (half_layer->batch_half) : (half_layer->single_half) ) ? (half_layer->weights) : (NULL);
+}//end network_half_weights.
+
+/**
+ * @brief Function to get the multiply adds of the product of a layer. (Profiling)
+ * 
+ * @param pruned   (NULL: Not pruned)
+ * @param factored (NULL: Not factorized)
+ * @param rows 
+ * @param cols The columns read.
+ * @return double 
+ */
+static inline double network_gemm_macs(const Sparse_Matrix_t *pruned, const LowRank_Layer_t *factored, uint16_t rows, uint16_t cols)
+{
+    if(factored != NULL)
+        return (double) factored->rank * (rows + cols);
+
+    if(pruned != NULL)
+        return (double) pruned->nnz;
+
+    return (double) rows * cols;
+}//end network_gemm_macs.
+
+/**
+ * @brief Function to get the bytes read & written by the product of a layer. (Profiling)
+ * 
+ * @param pruned   (NULL: Not pruned)
+ * @param factored (NULL: Not factorized)
+ * @param half     (NULL: Double weights)
+ * @param rows 
+ * @param cols  The columns read.
+ * @param batch The samples sharing the weights.
+ * @return double 
+ */
+static inline double network_gemm_bytes(const Sparse_Matrix_t *pruned, const LowRank_Layer_t *factored, const Half_Matrix_t *half,
+                                        uint16_t rows, uint16_t cols, uint16_t batch)
+{
+    const double weights_bytes = (pruned != NULL) ? ((double) Sparse_Matrix_Bytes(pruned)) :
+                                 (half != NULL)   ? ((double) sizeof(uint16_t) * rows * cols) :
+                                                    ((double) sizeof(double) * network_gemm_macs(pruned, factored, rows, cols));
+
+    return weights_bytes + ((double) sizeof(double) * (cols + rows) * batch);
+}//end network_gemm_bytes.
+
+/**
+ * @brief The forward pass shared by the inference & the training, from a weights layer to another.
+ *          - (training) is a constant at every call, so the inference copy is compiled 
+ *            without any dropout code.
+ * 
+ * @param dnn_network 
+ * @param training 
+ * @param first_layer The first weights layer to run.
+ * @param last_layer  The last weights layer to run.
+ */
+static inline void network_forward_layers(DNN_Network *dnn_network, const bool training, uint16_t first_layer, uint16_t last_layer)
+{
+    const uint16_t hidden_layers_num = dnn_network->network_topology->hidden_layer_num;
+
+    // Dropout random numbers: Keyed per network, one stream per (step, layer).
+    const bool dropout = (training) && network_dropout_active(dnn_network);
+    const uint64_t dropout_key  = (dropout) ? network_dropout_key(dnn_network) : 0;
+    const uint64_t dropout_step = (dropout) ? dnn_network->network_layers->Layer_gradients->step : 0;
+
+    uint32_t mask_randoms[MAX_VECTOR_LEN];
+    const Dropout_Mask_t dropout_mask = {.randoms = mask_randoms,
+                                         .keep_threshold = (dropout) ? network_dropout_threshold(dnn_network->network_config->dropout_rate) : 0,
+                                         .keep_scale = (dropout) ? (1.0 / (1.0 - dnn_network->network_config->dropout_rate)) : 0.0};
+
+    // A bound input is read in place. (Bind_Input, then Bind_Sparse_Input)
+    const Tensor_View_t *input_view = &dnn_network->network_layers->Input_layer->input_view;
+    const Sparse_Vector_t *input_sparse = &dnn_network->network_layers->Input_layer->input_sparse;
+
+    for(uint16_t layer = first_layer; layer <= last_layer; layer++)
+    {
+        Type_t *layer_input   = network_layer_input(dnn_network, layer);
+        Type_t *layer_output  = network_layer_output(dnn_network, layer);
+        Type_t *layer_weights = dnn_network->network_layers->Layer_weights[layer].layer_weights;
+
+        const bool view   = (layer == 0) && (input_view->data != NULL);
+        const bool sparse = (layer == 0) && (input_view->data == NULL) && (input_sparse->len != 0);
+
+        // The low rank factors of this layer. (Factorize_Network, NULL: Dense) The input runs
+        // through the [rank x in] factor first, into the rank vector.
+        const LowRank_Layer_t *factored = network_lowrank_layer(dnn_network, layer);
+        Type_t *product_weights = (factored != NULL) ? (factored->down) : (layer_weights);
+        double *product_output  = (factored != NULL) ? (dnn_network->network_layers->LowRank_weights->rank_vector->Vector_t.Vector)
+                                                     : (layer_output->Vector_t.Vector);
+
+        // The pruned, then the 16 bits weights of this layer. (NULL: Dense) A strided view or a
+        // sparse input keep their own kernels.
+        const bool contiguous_input = !( (view && (input_view->stride > 1)) || (sparse) );
+        const double *input_data = (view) ? (input_view->data) : (layer_input->Vector_t.Vector);
+
+        const Sparse_Matrix_t *pruned = ( (contiguous_input) && (factored == NULL) ) ? (network_sparse_weights(dnn_network, layer)) : (NULL);
+        const Half_Matrix_t *half = ( (contiguous_input) && (factored == NULL) && (pruned == NULL) ) ? (network_half_weights(dnn_network, layer, false)) : (NULL);
+
+        const uint16_t rows = layer_weights->Matrix_t.row; // Temporary variable for readability.
+        const uint16_t cols = (sparse) ? (input_sparse->nnz) : (layer_weights->Matrix_t.col); // The columns read.
+
+        TRACE_BEGIN(Trace_Layer_Name(layer), TRACE_CAT_LAYER);
+
+        // Store the dot product result in the layer. (No allocation, the shapes are checked at the network creation)
+        PROFILE_BEGIN(gemm_start);
+
+        if(pruned != NULL)
+            VxSM_DotProduct_Unchecked(input_data, pruned, product_output);
+        else if(half != NULL)
+            VxHM_DotProduct_Unchecked(input_data, half, product_output);
+        else if(view)
+            ViewxM_DotProduct_Unchecked(input_view, product_weights, product_output);
+        else if(sparse)
+            SparsexM_DotProduct_Unchecked(input_sparse, product_weights, product_output);
+        else
+            VxM_DotProduct_Unchecked(layer_input, product_weights, product_output);
+
+        if(factored != NULL)
+        {
+            Type_t rank_vector = {.Vector_t = {.len = (uint8_t) factored->rank, .Vector = product_output}};
+            VxM_DotProduct_Unchecked(&rank_vector, factored->up, layer_output->Vector_t.Vector);
+        }
+
+        PROFILE_END(dnn_network, layer, PROFILE_PHASE_GEMM, gemm_start,
+                    2.0 * network_gemm_macs(pruned, factored, rows, cols), network_gemm_bytes(pruned, factored, half, rows, cols, 1));
+
+        if(layer == hidden_layers_num)
+        {
+            // The logits of a fused loss pair. (Training only, a later inference pass drops them)
+            Layer_Gradients *gradients = dnn_network->network_layers->Layer_gradients; // (Temporary variable for readbility).
+
+            if(gradients != NULL)
+            {
+                gradients->output_logits_saved = (training) && network_fused_loss(dnn_network);
+
+                if(gradients->output_logits_saved)
+                    memcpy(gradients->output_logits->Vector_t.Vector, layer_output->Vector_t.Vector, sizeof(double) * layer_output->Vector_t.len);
+            }
+
+            // Apply the output activation function.
+            PROFILE_BEGIN(activation_start);
+            network_output_activation(dnn_network, layer_output);
+            PROFILE_END(dnn_network, layer, PROFILE_PHASE_ACTIVATION, activation_start, rows, sizeof(double) * 2 * rows);
+        }
+        else if(dropout)
+        {
+            // The mask random numbers, then the biases, the activation function & the mask in one
+            // pass. (Training only)
+            PROFILE_BEGIN(dropout_start);
+            Random_Fill_U32(dropout_key, network_dropout_stream(dropout_step, layer), 0, mask_randoms, rows);
+            PROFILE_END(dnn_network, layer, PROFILE_PHASE_DROPOUT, dropout_start, rows, sizeof(uint32_t) * rows);
+
+            PROFILE_BEGIN(activation_start);
+            network_hidden_activation(dnn_network, layer_output, layer, &dropout_mask);
+            PROFILE_END(dnn_network, layer, PROFILE_PHASE_ACTIVATION, activation_start, 3.0 * rows, sizeof(double) * 2 * rows);
+        }
+        else
+        {
+            // Apply the biases & the activation function. (Fused: The biases are in this phase)
+            PROFILE_BEGIN(activation_start);
+            network_hidden_activation(dnn_network, layer_output, layer, NULL);
+            PROFILE_END(dnn_network, layer, PROFILE_PHASE_ACTIVATION, activation_start, 2.0 * rows, sizeof(double) * 2 * rows);
+        }
+
+        TRACE_END(Trace_Layer_Name(layer), TRACE_CAT_LAYER);
+    }
+
+    return;
+}//end network_forward_layers.
+
+/**
+ * @brief The whole forward pass.
+ * 
+ * @param dnn_network 
+ * @param training 
+ */
+static inline void network_forward(DNN_Network *dnn_network, const bool training)
+{
+    network_forward_layers(dnn_network, training, 0, dnn_network->network_topology->hidden_layer_num);
+
+    return;
+}//end network_forward.
+
+/**
+ * @brief Function to recompute the activations of a shared (not checkpointed) hidden layer.
+ *          - Runs the training forward pass again from the nearest checkpoint below it, so the
+ *            segment buffer holds every layer of its segment up to it.
+ *            (The same dropout masks: They are regenerated from their (step, layer) stream)
+ * 
+ * @param dnn_network 
+ * @param hidden_layer The highest layer of the segment needed.
+ */
+static void network_recompute(DNN_Network *dnn_network, uint16_t hidden_layer)
+{
+    uint16_t first_layer = hidden_layer;
+
+    while( (first_layer > 0) && (network_is_checkpoint(dnn_network->network_layers, first_layer - 1) == false) )
+        first_layer--;
+
+    TRACE_BEGIN("recompute", TRACE_CAT_TRAIN);
+    network_forward_layers(dnn_network, true, first_layer, hidden_layer);
+    TRACE_END("recompute", TRACE_CAT_TRAIN);
+
+    return;
+}//end network_recompute.
+
+/**
+ * @brief Function to multiply errors by an activation drevative, from the activation outputs.
+ *          - ReLU: (y > 0), ELU: (y > 0) ? 1 : (y + alpha), Sigmoid: y(1 - y), Tanh: 1 - y^2.
+ * 
+ * @param activation 
+ * @param alpha The ELU alpha.
+ * @param activated The activation outputs.
+ * @param delta The errors. (Multiplied in place)
+ * @param len 
+ */
+static inline void network_activation_derivative(Activation_t activation, double alpha, const double *activated, double *delta, uint16_t len)
+{
+    switch(activation)
+    {
+        case ACTIVATION_RELU:
+            for(uint16_t i = 0; i < len; i++)
+                delta[i] *= (activated[i] > 0.0) ? (1.0) : (0.0);
+            break;
+
+        case ACTIVATION_ELU:
+            for(uint16_t i = 0; i < len; i++)
+                delta[i] *= (activated[i] > 0.0) ? (1.0) : (activated[i] + alpha);
+            break;
+
+        case ACTIVATION_SIGMOID:
+            for(uint16_t i = 0; i < len; i++)
+                delta[i] *= activated[i] * (1.0 - activated[i]);
+            break;
+
+        case ACTIVATION_TANH:
+            for(uint16_t i = 0; i < len; i++)
+                delta[i] *= 1.0 - (activated[i] * activated[i]);
+            break;
+
+        default:
+            error_exit(CURRENT_C, "ACTIVATION_DERIVATIVE:UNKNOWN");
+    }
+
+    return;
+}//end network_activation_derivative.
+
+/**
+ * @brief Function to get the loss drevative w.r.t the output layer before its activation.
+ *  - Fused pairs: (SoftMax, MCCE) => sum(t) * y - t, (Sigmoid, BCE) => (y - t) / n.
+ *  - Otherwise: dLoss/dy through the output activation drevative.
+ * 
+ * @param dnn_network 
+ * @param desired_output 
+ * @param output_delta (output_layer_dense long)
+ */
+static void network_output_delta(DNN_Network *dnn_network, Type_t *desired_output, double *output_delta)
+{
+    Network_Topology_t *topology = dnn_network->network_topology; // (Temporary variable for readbility).
+    const Activation_Plan_t plan = dnn_network->network_layers->Activation_plan;
+
+    const double *y = dnn_network->network_layers->Output_layer->output_layer->Vector_t.Vector;
+    const double *t = desired_output->Vector_t.Vector;
+    const uint16_t output_len = topology->output_layer_dense;
+
+    // The fused pairs.
+    if( (plan.output == ACTIVATION_SOFTMAX) && (topology->loss_function == &MCCE) )
+    {
+        double target_sum = 0.0;
+
+        for(uint16_t i = 0; i < output_len; i++)
+            target_sum += t[i];
+
+        for(uint16_t i = 0; i < output_len; i++)
+            output_delta[i] = (target_sum * y[i]) - t[i];
+
+        return;
+    }
+
+    if( (plan.output == ACTIVATION_SIGMOID) && (topology->loss_function == &BCE) )
+    {
+        for(uint16_t i = 0; i < output_len; i++)
+            output_delta[i] = (y[i] - t[i]) / output_len;
+
+        return;
+    }
+
+    // dLoss/dy.
+    for(uint16_t i = 0; i < output_len; i++)
+    {
+        if(topology->loss_function == &MSE)
+            output_delta[i] = 2.0 * (y[i] - t[i]) / output_len;
+        else if(topology->loss_function == &MAE)
+            output_delta[i] = ((y[i] > t[i]) - (y[i] < t[i])) / (double) output_len;
+        else if(topology->loss_function == &BCE)
+            output_delta[i] = (y[i] - t[i]) / (fmax(y[i] * (1.0 - y[i]), LOSS_EPSILON) * output_len);
+        else if(topology->loss_function == &MCCE)
+            output_delta[i] = -t[i] / fmax(y[i], LOSS_EPSILON);
+        else
+            error_exit(CURRENT_C, "LOSS_DERIVATIVE:UNKNOWN");
+    }
+
+    // Through the output activation.
+    if(plan.output == ACTIVATION_SOFTMAX)
+    {
+        double weighted_sum = 0.0;
+
+        for(uint16_t i = 0; i < output_len; i++)
+            weighted_sum += output_delta[i] * y[i];
+
+        for(uint16_t i = 0; i < output_len; i++)
+            output_delta[i] = y[i] * (output_delta[i] - weighted_sum);
+    }
+    else
+    {
+        network_activation_derivative(plan.output, plan.alpha, y, output_delta, output_len);
+    }
+
+    return;
+}//end network_output_delta.
+
+/**
+ * @brief Function to create the training state of a network. (Once)
+ * 
+ * @param dnn_network 
+ */
+static void network_training_init(DNN_Network *dnn_network)
+{
+    if(dnn_network->network_layers->Layer_gradients != NULL)
+        return;
+
+    // The backward pass needs the drevatives of the activations & of the loss. (Before any step)
+    if(Check_Network_Training(dnn_network) != ANN_OK)
+        error_exit(CURRENT_C, "DERIVATIVE:UNKNOWN");
+
+    // Charge the training state to the network.
+    const Memory_Context_t previous_context = Memory_Enter(dnn_network->network_layers->Memory_stats, MEMORY_GRADIENTS);
+
+    Layer_Gradients *gradients = (Layer_Gradients *) Memory_Alloc(sizeof(Layer_Gradients), MEMORY_GRADIENTS);
+
+    const uint16_t number_of_matrices = dnn_network->network_topology->hidden_layer_num + 1; // Temporary variable for readability.
+
+    gradients->weights_gradients = (Layer_Weights *) Memory_Alloc(sizeof(Layer_Weights) * number_of_matrices, MEMORY_GRADIENTS);
+
+    // Same shapes as the weights & the biases. (Start from zero)
+    for(uint16_t i = 0; i < number_of_matrices; i++)
+    {
+        Type_t *layer_weights = dnn_network->network_layers->Layer_weights[i].layer_weights;
+
+        gradients->weights_gradients[i].layer_weights = create_matrix(layer_weights->Matrix_t.row, layer_weights->Matrix_t.col, false);
+
+        for(uint16_t r = 0; r < layer_weights->Matrix_t.row; r++)
+            memset(gradients->weights_gradients[i].layer_weights->Matrix_t.Matrix[r], 0, sizeof(double) * layer_weights->Matrix_t.col);
+    }
+
+    gradients->biases_gradients = create_vector(number_of_matrices, false);
+    memset(gradients->biases_gradients->Vector_t.Vector, 0, sizeof(double) * number_of_matrices);
+
+    // The errors are as long as the widest non input layer.
+    const uint16_t max_dense = (dnn_network->network_topology->hidden_layer_dense > dnn_network->network_topology->output_layer_dense) ? 
+                               (dnn_network->network_topology->hidden_layer_dense) : 
+                               (dnn_network->network_topology->output_layer_dense);
+
+    gradients->layer_deltas[0] = create_vector(max_dense, false);
+    gradients->layer_deltas[1] = create_vector(max_dense, false);
+
+    gradients->output_logits = create_vector(dnn_network->network_topology->output_layer_dense, false);
+    gradients->output_logits_saved = false;
+
+    gradients->step = 0;
+    gradients->accumulated = 0;
+
+    dnn_network->network_layers->Layer_gradients = gradients;
+
+    Memory_Leave(previous_context);
+
+    return;
+}//end network_training_init.
+
+/**
+ * @brief Function to check the arguments of a batched forward pass without exiting.
+ * 
+ * @param dnn_network 
+ * @param inputs  [batch_size x input_layer_dense]
+ * @param outputs [batch_size x output_layer_dense]
+ * @param batch_size 
+ * @return ANN_Status_t 
+ */
+static ANN_Status_t network_batch_check(DNN_Network *dnn_network, Type_t *inputs, Type_t *outputs, uint16_t batch_size)
+{
+    if( (dnn_network == NULL) || (inputs == NULL) || (outputs == NULL) )
+        return ANN_ERROR_NULL;
+
+    if( (inputs->Matrix_t.Matrix == NULL) || (outputs->Matrix_t.Matrix == NULL) )
+        return ANN_ERROR_NULL;
+
+    if(batch_size <= 0)
+        return ANN_ERROR_INVALID;
+
+    if(batch_size > MAX_MATRIX_ROW)
+        return ANN_ERROR_LIMIT;
+
+    if( (inputs->Matrix_t.col  != dnn_network->network_topology->input_layer_dense)  ||
+        (outputs->Matrix_t.col != dnn_network->network_topology->output_layer_dense) ||
+        (inputs->Matrix_t.row < batch_size) || (outputs->Matrix_t.row < batch_size) )
+        return ANN_ERROR_SHAPE;
+
+    return ANN_OK;
+}//end network_batch_check.
+
+/**
+ * @brief The batched forward pass of one tile through every layer, without any check.
+ * 
+ * @param dnn_network 
+ * @param inputs  [tile_rows x input_layer_dense]
+ * @param outputs [tile_rows x output_layer_dense] (Preallocated)
+ * @param tile_rows (Up to the workspace rows)
+ */
+static void network_forward_tile(DNN_Network *dnn_network, Type_t *inputs, Type_t *outputs, uint16_t tile_rows)
+{
+    Layer_t *layers = dnn_network->network_layers; // (Temporary variable for readbility).
+    const uint16_t hidden_layers_num = dnn_network->network_topology->hidden_layer_num;
+
+    // The products between the low rank factors. (Factorize_Network)
+    LowRank_Weights_t *lowrank = layers->LowRank_weights;
+
+    Type_t *current_layer = inputs;
+
+    for(uint16_t layer = 0; layer <= hidden_layers_num; layer++)
+    {
+        TRACE_BEGIN(Trace_Layer_Name(layer), TRACE_CAT_LAYER);
+
+        const bool is_output = (layer == hidden_layers_num);
+        Type_t *next_layer = (is_output) ? (outputs) : (layers->Batch_workspace[layer & 1]);
+
+        const uint16_t rows = layers->Layer_weights[layer].layer_weights->Matrix_t.row; // Temporary variable for readability.
+        const uint16_t cols = layers->Layer_weights[layer].layer_weights->Matrix_t.col; // Temporary variable for readability.
+
+        // The pruned weights of this layer. (Sparsify_Network, NULL: Dense)
+        // The low rank factors of this layer. (Factorize_Network, NULL: Dense)
+        const LowRank_Layer_t *factored = network_lowrank_layer(dnn_network, layer);
+        const Sparse_Matrix_t *pruned = (factored != NULL) ? (NULL) : (network_sparse_weights(dnn_network, layer));
+        const Half_Matrix_t *half = ( (factored != NULL) || (pruned != NULL) ) ? (NULL) : (network_half_weights(dnn_network, layer, true));
+
+        // The dot product for all the rows at once.
+        PROFILE_BEGIN(gemm_start);
+
+        if(factored != NULL)
+        {
+            // [tile x rank] view of the workspace between the two products.
+            Type_t rank_batch = {.Matrix_t = {.row = lowrank->batch_workspace->Matrix_t.row, .col = (uint8_t) factored->rank,
+                                              .Matrix = lowrank->batch_workspace->Matrix_t.Matrix}};
+
+            BxM_DotProduct_Unchecked(current_layer, factored->down, &rank_batch, tile_rows);
+            BxM_DotProduct_Unchecked(&rank_batch, factored->up, next_layer, tile_rows);
+        }
+        else if(pruned != NULL)
+            BxSM_DotProduct_Unchecked(current_layer, pruned, next_layer, tile_rows);
+        else if(half != NULL)
+            BxHM_DotProduct_Unchecked(current_layer, half, next_layer, tile_rows);
+        else
+            BxM_DotProduct_Unchecked(current_layer, layers->Layer_weights[layer].layer_weights, next_layer, tile_rows);
+
+        PROFILE_END(dnn_network, layer, PROFILE_PHASE_GEMM, gemm_start,
+                    2.0 * network_gemm_macs(pruned, factored, rows, cols) * tile_rows,
+                    network_gemm_bytes(pruned, factored, half, rows, cols, tile_rows));
+
+        // Apply the biases & the activation function row by row.
+        PROFILE_BEGIN(activation_start);
+
+        for(uint16_t r = 0; r < tile_rows; r++)
+        {
+            Type_t row_vector = {.Vector_t = {.len = next_layer->Matrix_t.col, .Vector = next_layer->Matrix_t.Matrix[r]}};
+
+            if(is_output)
+                network_output_activation(dnn_network, &row_vector);
+            else
+                network_hidden_activation(dnn_network, &row_vector, layer, NULL);
+        }
+
+        // (The biases are fused in this phase)
+        PROFILE_END(dnn_network, layer, PROFILE_PHASE_ACTIVATION, activation_start,
+                    (double) rows * tile_rows * ((is_output) ? (1) : (2)), sizeof(double) * 2 * rows * tile_rows);
+
+        TRACE_END(Trace_Layer_Name(layer), TRACE_CAT_LAYER);
+
+        current_layer = next_layer;
+    }
+
+    return;
+}//end network_forward_tile.
+
+/**
+ * @brief The batched forward pass, without any check. (network_batch_check)
+ * 
+ * @param dnn_network 
+ * @param inputs  [batch_size x input_layer_dense]
+ * @param outputs [batch_size x output_layer_dense] (Preallocated)
+ * @param batch_size 
+ */
+static void network_forward_batch(DNN_Network *dnn_network, Type_t *inputs, Type_t *outputs, uint16_t batch_size)
+{
+    Layer_t *layers = dnn_network->network_layers; // (Temporary variable for readbility).
+    const uint16_t hidden_layer_dense = dnn_network->network_topology->hidden_layer_dense;
+
+    // The workspace holds one tile. (A smaller batch: One tile)
+    const uint16_t tile_rows = (batch_size < layers->Batch_tile) ? (batch_size) : (layers->Batch_tile);
+
+    // (Re)Create the workspace if this tile doesn't fit.
+    const Memory_Context_t previous_context = Memory_Enter(layers->Memory_stats, MEMORY_ACTIVATIONS);
+
+    for(uint8_t i = 0; i < 2; i++)
+    {
+        if( (layers->Batch_workspace[i] != NULL) && (layers->Batch_workspace[i]->Matrix_t.row < tile_rows) )
+        {
+            free_matrix(layers->Batch_workspace[i]);
+            layers->Batch_workspace[i] = NULL;
+        }
+
+        if(layers->Batch_workspace[i] == NULL)
+            layers->Batch_workspace[i] = create_matrix(tile_rows, hidden_layer_dense, false);
+    }
+
+    // The products between the low rank factors. (Factorize_Network)
+    LowRank_Weights_t *lowrank = layers->LowRank_weights;
+
+    if( (lowrank != NULL) && (lowrank->max_rank > 0) )
+    {
+        if( (lowrank->batch_workspace != NULL) && (lowrank->batch_workspace->Matrix_t.row < tile_rows) )
+        {
+            free_matrix(lowrank->batch_workspace);
+            lowrank->batch_workspace = NULL;
+        }
+
+        if(lowrank->batch_workspace == NULL)
+            lowrank->batch_workspace = create_matrix(tile_rows, lowrank->max_rank, false);
+    }
+
+    Memory_Leave(previous_context);
+
+    TRACE_BEGIN("forward_batch", TRACE_CAT_INFERENCE);
+
+    // Depth-first: Each tile runs through every layer while its activations are in the cache.
+    for(uint16_t first_row = 0; first_row < batch_size; first_row += tile_rows)
+    {
+        const uint16_t rows = ((batch_size - first_row) < tile_rows) ? (batch_size - first_row) : (tile_rows);
+
+        // Views of the tile rows.
+        Type_t tile_inputs  = {.Matrix_t = {.row = (uint8_t) rows, .col = inputs->Matrix_t.col,  .Matrix = &inputs->Matrix_t.Matrix[first_row]}};
+        Type_t tile_outputs = {.Matrix_t = {.row = (uint8_t) rows, .col = outputs->Matrix_t.col, .Matrix = &outputs->Matrix_t.Matrix[first_row]}};
+
+        network_forward_tile(dnn_network, &tile_inputs, &tile_outputs, rows);
+    }
+
+    TRACE_END("forward_batch", TRACE_CAT_INFERENCE);
+
+    return;
+}//end network_forward_batch.
+
+/**
+ * @brief Function to compute the incremental accumulator again with the full Weights[0] product.
+ *          - New weights (model version) are transposed again first.
+ * 
+ * @param dnn_network 
+ */
+static void network_incremental_refresh(DNN_Network *dnn_network)
+{
+    Incremental_Layer *incremental = dnn_network->network_layers->Incremental_layer; // (Temporary variable for readbility).
+    Type_t *first_weights = dnn_network->network_layers->Layer_weights[0].layer_weights;
+    const uint64_t version = Model_Version(dnn_network);
+
+    if(incremental->version != version)
+    {
+        for(uint16_t i = 0; i < first_weights->Matrix_t.row; i++)
+        {
+            for(uint16_t j = 0; j < first_weights->Matrix_t.col; j++)
+                incremental->columns->Matrix_t.Matrix[j][i] = first_weights->Matrix_t.Matrix[i][j];
+        }
+
+        incremental->version = version;
+    }
+
+    PROFILE_BEGIN(gemm_start);
+    VxM_DotProduct_Unchecked(incremental->input, first_weights, incremental->accumulator->Vector_t.Vector);
+    PROFILE_END(dnn_network, 0, PROFILE_PHASE_GEMM, gemm_start,
+                2.0 * first_weights->Matrix_t.row * first_weights->Matrix_t.col,
+                sizeof(double) * ((first_weights->Matrix_t.row * first_weights->Matrix_t.col) + first_weights->Matrix_t.col + first_weights->Matrix_t.row));
+
+    incremental->updates = 0;
+
+    return;
+}//end network_incremental_refresh.
+
+/**
+ * @brief Function to run the network from the incremental accumulator: Hidden[0] activation, then the other layers.
+ * 
+ * @param dnn_network 
+ * @param output [output_layer_dense] (The output layer is copied into it)
+ */
+static void network_incremental_forward(DNN_Network *dnn_network, double *output)
+{
+    Layer_t *layers = dnn_network->network_layers; // (Temporary variable for readbility).
+    Type_t *first_hidden = layers->Hidden_layer[0].hidden_layer;
+
+    memcpy(first_hidden->Vector_t.Vector, layers->Incremental_layer->accumulator->Vector_t.Vector, sizeof(double) * first_hidden->Vector_t.len);
+
+    PROFILE_BEGIN(activation_start);
+    network_hidden_activation(dnn_network, first_hidden, 0, NULL);
+    PROFILE_END(dnn_network, 0, PROFILE_PHASE_ACTIVATION, activation_start, 2.0 * first_hidden->Vector_t.len, sizeof(double) * 2 * first_hidden->Vector_t.len);
+
+    network_forward_layers(dnn_network, false, 1, dnn_network->network_topology->hidden_layer_num);
+
+    memcpy(output, layers->Output_layer->output_layer->Vector_t.Vector, sizeof(double) * dnn_network->network_topology->output_layer_dense);
+
+    return;
+}//end network_incremental_forward.
 
 /*
 ----------------------------------------------------------------
@@ -63,14 +1122,20 @@ Network_Config_t general_network_config = {.learning_rate = 0.2549, .dropout = f
  */
 DNN_Network *Create_Network(Network_Topology_t *network_topology_settings, Network_Config_t *network_config)
 {
-    // Check the validity of a given network topology.
+    // Check the validity of a given network topology & config. (Once: The passes don't check the shapes again)
     network_topology_validity(network_topology_settings);
 
+    const ANN_Status_t config_status = Check_Network_Config(network_config);
+
+    if(config_status != ANN_OK)
+        error_exit(CURRENT_C, ANN_Status_Name(config_status));
+
+    // Charge all the network blocks to its own memory counters.
+    Memory_Stats_t *memory_stats = Memory_Create_Stats();
+    const Memory_Context_t previous_context = Memory_Enter(memory_stats, MEMORY_OTHER);
+
     // Create a new Deep Neural Network - Network struct.
-    DNN_Network *new_dnnNetwork = (DNN_Network *) malloc(sizeof(DNN_Network));
-   
-    if(new_dnnNetwork == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    DNN_Network *new_dnnNetwork = (DNN_Network *) Memory_Alloc(sizeof(DNN_Network), MEMORY_OTHER);
 
     // Set the network settings:
     // Set the network configs. (general by default. User can change it)
@@ -84,214 +1149,895 @@ DNN_Network *Create_Network(Network_Topology_t *network_topology_settings, Netwo
 
     // Set the Nerual Network settings:
     // Create new network layers struct in heap.
-    new_dnnNetwork->network_layers = (Layer_t *) malloc(sizeof(Layer_t));
-    
-    if(new_dnnNetwork->network_layers == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    new_dnnNetwork->network_layers = (Layer_t *) Memory_Alloc(sizeof(Layer_t), MEMORY_OTHER);
+    new_dnnNetwork->network_layers->Memory_stats = memory_stats;
 
     // Input Layer:
     // Create new vector in heap & Set the input layer dense. (Initalize: True)
     const uint16_t ilDense = new_dnnNetwork->network_topology->input_layer_dense; // Temporary variable for readability.
     // Create input layer struct memory in heap.
-    new_dnnNetwork->network_layers->Input_layer = (Input_Layer *) malloc(sizeof(Input_Layer));
+    new_dnnNetwork->network_layers->Input_layer = (Input_Layer *) Memory_Calloc(sizeof(Input_Layer), MEMORY_OTHER);
     // Create input layer vector data in heap.
+    Memory_Enter(memory_stats, MEMORY_ACTIVATIONS);
     new_dnnNetwork->network_layers->Input_layer->input_layer = create_vector(ilDense, true);
 
-    // Hidden Layer:
-    // Set the hidden layers num.
-    new_dnnNetwork->network_layers->hidden_layer_num = new_dnnNetwork->network_topology->hidden_layer_num;
-    // Create the hidden layers. (x num)
-    const uint16_t hlNum = new_dnnNetwork->network_layers->hidden_layer_num; // Temporary variable for readability.
-    new_dnnNetwork->network_layers->Hidden_layer = (Hidden_Layer *) malloc(sizeof(Hidden_Layer) * hlNum);
-    
-    if(new_dnnNetwork->network_layers->Hidden_layer == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    // Hidden Layer:
+    // Set the hidden layers num.
+    new_dnnNetwork->network_layers->hidden_layer_num = new_dnnNetwork->network_topology->hidden_layer_num;
+    // Create the hidden layers. (x num)
+    const uint16_t hlNum = new_dnnNetwork->network_layers->hidden_layer_num; // Temporary variable for readability.
+    new_dnnNetwork->network_layers->Hidden_layer = (Hidden_Layer *) Memory_Alloc(sizeof(Hidden_Layer) * hlNum, MEMORY_OTHER);
+
+    //Hidden_Layer hidden_layers[hlNum];
+    //new_dnnNetwork->network_layers->Hidden_layer = hidden_layers;
+
+    // Create layer dense for each hidden layer.
+    const uint16_t hlDense = new_dnnNetwork->network_topology->hidden_layer_dense; // Temporary variable for readability.
+
+    // Gradient checkpointing: The layers of a segment between two checkpoints share the segment
+    // buffer, one vector per position. (A whole segment is kept by one recomputation)
+    Layer_t *layers = new_dnnNetwork->network_layers; // (Temporary variable for readbility).
+
+    layers->Checkpoint_interval = network_checkpoint_interval(new_dnnNetwork->network_topology, new_dnnNetwork->network_config);
+    layers->Checkpoint_buffers  = NULL;
+
+    if(layers->Checkpoint_interval > 1)
+    {
+        layers->Checkpoint_buffers = (Type_t **) Memory_Alloc(sizeof(Type_t *) * (layers->Checkpoint_interval - 1), MEMORY_OTHER);
+
+        for(uint16_t i = 0; i < (layers->Checkpoint_interval - 1); i++)
+            layers->Checkpoint_buffers[i] = create_vector(hlDense, true);
+    }
+
+    for(uint16_t i = 0; i < hlNum; i++)
+    {   
+        // Creat new hidden layers vector. (Initalize: True)
+        layers->Hidden_layer[i].hidden_layer = (network_is_checkpoint(layers, i)) ? 
+                                               (create_vector(hlDense, true)) : 
+                                               (layers->Checkpoint_buffers[i % layers->Checkpoint_interval]);
+    }
+
+    // Output Layer:
+    // Create the output layer & set its dense. (Initalize: True)
+    const uint16_t olDense = new_dnnNetwork->network_topology->output_layer_dense;
+    // Create heap memory for the output struct
+    new_dnnNetwork->network_layers->Output_layer = (Output_Layer *) Memory_Alloc(sizeof(Output_Layer), MEMORY_OTHER);
+
+    // Create heap memory and assign data to the output layer vector.
+    new_dnnNetwork->network_layers->Output_layer->output_layer = create_vector(olDense ,true);
+
+
+    // Layer Weights: (Number of layers = hidden_layer_num + 2)
+    /*
+        row of the weights matrix: the output  vector dense.
+        col of the weights matrix: the input   vector dense.
+        Layer_Weights_Matrix       Input_Vector Output_Vector
+        [00, 01, 0j]               [0, 1, n] => [0] 
+        [10, 11, 1j]                         => [1]
+        [20, 21, 2j]                         => [2]
+        [i0, i1, ij]                         => [m]
+    */
+   
+    // Create layers weights (N_LAYERS - 1)
+    const uint16_t number_of_layers = new_dnnNetwork->network_topology->hidden_layer_num + 2; // temporary variable for readability.
+    const uint16_t number_of_matrices = number_of_layers - 1;
+
+    new_dnnNetwork->network_layers->Layer_weights = (Layer_Weights *) Memory_Alloc(sizeof(Layer_Weights) * (number_of_matrices), MEMORY_OTHER);
+
+    Memory_Enter(memory_stats, MEMORY_WEIGHTS);
+
+    // Set the Weights(INPUT<=>HIDDEN[0]): (Layer_weights[0]) <> (Transient states excpetion)
+    uint16_t row = new_dnnNetwork->network_topology->hidden_layer_dense;
+    uint16_t col = new_dnnNetwork->network_topology->input_layer_dense;
+    new_dnnNetwork->network_layers->Layer_weights[0].layer_weights = create_matrix(row, col, false); // (Initalize: Init_Network).
+
+
+    // Set the Weights(HIDDEN[0]<=>HIDDEN[N])
+    row = new_dnnNetwork->network_topology->hidden_layer_dense;
+    col = new_dnnNetwork->network_topology->hidden_layer_dense;
+
+    for(uint16_t i = 1; i < number_of_matrices-1; i++) 
+    {
+        new_dnnNetwork->network_layers->Layer_weights[i].layer_weights = create_matrix(row, col, false); // (Initalize: Init_Network).
+    }
+
+    // Set the Weights(HIDDEN[N]<=>OUTPUT): (Layer_weights[n-1]) <> (Transient states excpetion)
+    row = new_dnnNetwork->network_topology->output_layer_dense;
+    col = new_dnnNetwork->network_topology->hidden_layer_dense;
+    new_dnnNetwork->network_layers->Layer_weights[number_of_matrices-1].layer_weights = create_matrix(row, col, false); // (Initalize: Init_Network).
+    
+    // Layers_Biases:
+    // Create Layer Biases vector. (Initalize: True)
+    const uint16_t biases_vector_length = number_of_layers - 1; // Temporary variable for readability.
+    // Create Layers_Biases struct in heap.
+    new_dnnNetwork->network_layers->Layers_biases = (Layers_Biases *) Memory_Alloc(sizeof(Layers_Biases), MEMORY_OTHER);
+
+    // Create heap memory for the biases vector & assign the vector of biases.
+    new_dnnNetwork->network_layers->Layers_biases->layers_biases = create_vector(biases_vector_length, false);
+
+    // Initialize the weights & the biases with the configured schemes. (Same seed => Same network)
+    Init_Network(new_dnnNetwork, NULL, new_dnnNetwork->network_config->seed);
+
+    // Batch workspace: (Created on the first batched forward pass)
+    new_dnnNetwork->network_layers->Batch_workspace[0] = NULL;
+    new_dnnNetwork->network_layers->Batch_workspace[1] = NULL;
+    new_dnnNetwork->network_layers->Batch_tile = network_batch_tile(new_dnnNetwork->network_topology, new_dnnNetwork->network_config->batch_tile);
+
+    // Training state: (Created on the first training step)
+    new_dnnNetwork->network_layers->Layer_gradients = NULL;
+    new_dnnNetwork->network_layers->Owned_settings = NULL;
+
+    // Results cache: (Attach_Cache, hashes the weights on its first use)
+    new_dnnNetwork->network_layers->Model_version = 0;
+    new_dnnNetwork->network_layers->Inference_cache = NULL;
+
+    // Incremental first layer: (Created on the first Predict_Incremental_Reset)
+    new_dnnNetwork->network_layers->Incremental_layer = NULL;
+
+    // Sparse weights: (Prune_Network, Sparsify_Network)
+    new_dnnNetwork->network_layers->Sparse_weights = NULL;
+
+    // Low rank factors: (Factorize_Network)
+    new_dnnNetwork->network_layers->LowRank_weights = NULL;
+
+    // 16 bits weights: (Compress_Network)
+    new_dnnNetwork->network_layers->Half_weights = NULL;
+
+    // Profiling counters: (NULL without ANN_ENABLE_PROFILING)
+    new_dnnNetwork->network_layers->Network_stats = Profile_Create_Stats(number_of_matrices);
+
+    // Select the activation kernels of the passes.
+    new_dnnNetwork->network_layers->Activation_plan = network_activation_plan(new_dnnNetwork->network_topology);
+
+    Memory_Leave(previous_context);
+
+    // Return the new created network.
+    return new_dnnNetwork;
+}//end Create_Network.
+
+/**
+ * @brief Function to free a network & all its layers, weights, workspaces & training state.
+ *          - The topology & the config belong to the caller. (Not freed)
+ * 
+ * @param dnn_network 
+ */
+void Free_Network(DNN_Network *dnn_network)
+{
+    // Error Handeling.
+    if(dnn_network == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    Layer_t *layers = dnn_network->network_layers; // (Temporary variable for readbility).
+    const uint16_t number_of_matrices = dnn_network->network_topology->hidden_layer_num + 1;
+
+    // Training state.
+    if(layers->Layer_gradients != NULL)
+    {
+        for(uint16_t i = 0; i < number_of_matrices; i++)
+            free_matrix(layers->Layer_gradients->weights_gradients[i].layer_weights);
+
+        free_vector(layers->Layer_gradients->biases_gradients);
+        free_vector(layers->Layer_gradients->layer_deltas[0]);
+        free_vector(layers->Layer_gradients->layer_deltas[1]);
+        free_vector(layers->Layer_gradients->output_logits);
+
+        Memory_Free(layers->Layer_gradients->weights_gradients);
+        Memory_Free(layers->Layer_gradients);
+    }
+
+    // Batch workspace.
+    for(uint8_t i = 0; i < 2; i++)
+    {
+        if(layers->Batch_workspace[i] != NULL)
+            free_matrix(layers->Batch_workspace[i]);
+    }
+
+    // Incremental first layer.
+    if(layers->Incremental_layer != NULL)
+    {
+        free_vector(layers->Incremental_layer->accumulator);
+        free_vector(layers->Incremental_layer->input);
+        free_matrix(layers->Incremental_layer->columns);
+        Memory_Free(layers->Incremental_layer);
+    }
+
+    // Sparse, low rank & 16 bits weights.
+    Free_Sparse_Weights(layers->Sparse_weights);
+    Free_LowRank_Weights(layers->LowRank_weights);
+    Free_Half_Weights(layers->Half_weights);
+
+    // Weights & biases.
+    for(uint16_t i = 0; i < number_of_matrices; i++)
+        free_matrix(layers->Layer_weights[i].layer_weights);
+
+    free_vector(layers->Layers_biases->layers_biases);
+
+    Memory_Free(layers->Layers_biases);
+    Memory_Free(layers->Layer_weights);
+
+    // Layers.
+    free_vector(layers->Input_layer->input_layer);
+    free_vector(layers->Output_layer->output_layer);
+
+    for(uint16_t i = 0; i < layers->hidden_layer_num; i++)
+    {
+        if(network_is_checkpoint(layers, i))
+            free_vector(layers->Hidden_layer[i].hidden_layer);
+    }
+
+    if(layers->Checkpoint_buffers != NULL)
+    {
+        for(uint16_t i = 0; i < (layers->Checkpoint_interval - 1); i++)
+            free_vector(layers->Checkpoint_buffers[i]);
+
+        Memory_Free(layers->Checkpoint_buffers);
+    }
+
+    Memory_Free(layers->Input_layer);
+    Memory_Free(layers->Output_layer);
+    Memory_Free(layers->Hidden_layer);
+
+    // Counters. (Last, the blocks above are uncharged from them)
+    Memory_Stats_t *memory_stats = layers->Memory_stats;
+    struct _Network_Settings_t *owned_settings = layers->Owned_settings;
+
+    free(layers->Network_stats);
+    Memory_Free(layers);
+    Memory_Free(dnn_network);
+    Memory_Free(owned_settings);
+
+    free(memory_stats);
+
+    return;
+}//end Free_Network.
+
+/**
+ * @brief Function to create a network without exiting on an invalid topology or config.
+ * 
+ * @param network_topology_settings 
+ * @param network_config 
+ * @param dnn_network The created network. (NULL on error)
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Create_Network_Checked(Network_Topology_t *network_topology_settings, Network_Config_t *network_config, DNN_Network **dnn_network)
+{
+    if(dnn_network == NULL)
+        return ANN_ERROR_NULL;
+
+    *dnn_network = NULL;
+
+    ANN_Status_t status = Check_Network_Topology(network_topology_settings);
+
+    if(status != ANN_OK)
+        return status;
+
+    status = Check_Network_Config(network_config);
+
+    if(status != ANN_OK)
+        return status;
+
+    *dnn_network = Create_Network(network_topology_settings, network_config);
+
+    return ANN_OK;
+}//end Create_Network_Checked.
+
+/*
+----------------------------------------------------------------
+!-                       DNN FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to perform the forward propagation on the network.
+ *  - Forward Propagation Algorithms:
+        - Input_Layer (dot product) Weights_Layer[0] & Store the result in Hidden[0].
+        - Hidden[n-1] (dot product) Weights_Layer[n] & Store the result in Hidden[n].
+        - Hidden[N] (dot product) Weights_Layer[N] & Store the result in the output layer.
+ * @param dnn_network 
+ */
+void forward_propagation(DNN_Network *dnn_network)
+{
+    /// Check if the passed network isn't created yet.
+    if(dnn_network == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK: NULL");
+
+    network_forward(dnn_network, false);
+
+    return;
+}//end forward_propagation.
+
+/**
+ * @brief Function to perform the forward propagation on one sample, without exiting.
+ *          - For serving: A bad request returns its status instead of killing the process.
+ *            (The arguments are checked once per call, not per layer)
+ *          - With a cache attached, a cached input returns its stored output without a pass.
+ *            (The hidden layers are left as they were)
+ * @param dnn_network 
+ * @param input  [input_len]  (Read in place, not copied)
+ * @param input_len 
+ * @param output [output_len] (The output layer is copied into it)
+ * @param output_len 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Predict_Network(DNN_Network *dnn_network, const double *input, uint16_t input_len, double *output, uint16_t output_len)
+{
+    if( (dnn_network == NULL) || (input == NULL) || (output == NULL) )
+        return ANN_ERROR_NULL;
+
+    if( (input_len  != dnn_network->network_topology->input_layer_dense) ||
+        (output_len != dnn_network->network_topology->output_layer_dense) )
+        return ANN_ERROR_SHAPE;
+
+    struct _Cache_t *cache = dnn_network->network_layers->Inference_cache; // (Temporary variable for readbility).
+    const uint64_t version = (cache != NULL) ? (Model_Version(dnn_network)) : (0);
+
+    if( (cache != NULL) && (Cache_Lookup(cache, version, input, output)) )
+        return ANN_OK;
+
+    // Borrow the request for this pass only.
+    Input_Layer *input_layer = dnn_network->network_layers->Input_layer; // (Temporary variable for readbility).
+    const Tensor_View_t bound_view = input_layer->input_view;
+
+    input_layer->input_view = Tensor_View(input, input_len, 1);
+    network_forward(dnn_network, false);
+    input_layer->input_view = bound_view;
+
+    memcpy(output, dnn_network->network_layers->Output_layer->output_layer->Vector_t.Vector, sizeof(double) * output_len);
+
+    if(cache != NULL)
+        Cache_Insert(cache, version, input, output);
+
+    return ANN_OK;
+}//end Predict_Network.
+
+/**
+ * @brief Function to perform the forward propagation on one sparse sample, without exiting.
+ *          - Same as Predict_Network, the first layer reads the active weights columns only.
+ *            (Not cached: The cache keys are dense inputs)
+ * @param dnn_network 
+ * @param sparse [input_layer_dense] long. (Read in place, not copied)
+ * @param output [output_len] (The output layer is copied into it)
+ * @param output_len 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Predict_Sparse_Network(DNN_Network *dnn_network, const Sparse_Vector_t *sparse, double *output, uint16_t output_len)
+{
+    if( (dnn_network == NULL) || (output == NULL) )
+        return ANN_ERROR_NULL;
+
+    const ANN_Status_t status = Sparse_Vector_Check(sparse);
+
+    if(status != ANN_OK)
+        return status;
+
+    if( (sparse->len  != dnn_network->network_topology->input_layer_dense) ||
+        (output_len != dnn_network->network_topology->output_layer_dense) )
+        return ANN_ERROR_SHAPE;
+
+    // Borrow the request for this pass only.
+    Input_Layer *input_layer = dnn_network->network_layers->Input_layer; // (Temporary variable for readbility).
+    const Tensor_View_t bound_view = input_layer->input_view;
+    const Sparse_Vector_t bound_sparse = input_layer->input_sparse;
+
+    input_layer->input_view.data = NULL;
+    input_layer->input_sparse = *sparse;
+    network_forward(dnn_network, false);
+    input_layer->input_view = bound_view;
+    input_layer->input_sparse = bound_sparse;
+
+    memcpy(output, dnn_network->network_layers->Output_layer->output_layer->Vector_t.Vector, sizeof(double) * output_len);
+
+    return ANN_OK;
+}//end Predict_Sparse_Network.
+
+/**
+ * @brief Function to perform the training forward propagation on the network.
+ *  - Same as forward_propagation, plus the (inverted) dropout of the hidden neurons.
+ * @param dnn_network 
+ */
+void forward_propagation_train(DNN_Network *dnn_network)
+{
+    /// Check if the passed network isn't created yet.
+    if(dnn_network == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK: NULL");
+
+    network_training_init(dnn_network);
+
+    network_forward(dnn_network, true);
+
+    return;
+}//end forward_propagation_train.
+
+/**
+ * @brief Function to perform the forward propagation on a whole batch.
+ *  - Batched Forward Propagation Algorithm:
+        - The batch is split in tiles (Set_Batch_Tile): Every layer runs for all the tile rows,
+          the whole tile runs through every layer before the next tile starts.
+        - Tile_Inputs (dot product) Weights_Layer[0] => Workspace[0] => ... => Tile_Outputs.
+        - The inputs are only read, so they may be rows of a mapped dataset (zero-copy views).
+ * @param dnn_network 
+ * @param inputs  [batch_size x input_layer_dense]
+ * @param outputs [batch_size x output_layer_dense] (Preallocated)
+ * @param batch_size 
+ */
+void forward_propagation_batch(DNN_Network *dnn_network, Type_t *inputs, Type_t *outputs, uint16_t batch_size)
+{
+    // Error Handeling.
+    const ANN_Status_t status = network_batch_check(dnn_network, inputs, outputs, batch_size);
+
+    if(status != ANN_OK)
+        error_exit(CURRENT_C, ANN_Status_Name(status));
+
+    network_forward_batch(dnn_network, inputs, outputs, batch_size);
+
+    return;
+}//end forward_propagation_batch.
+
+/**
+ * @brief Function to perform the forward propagation on a whole batch, without exiting.
+ *          - For serving: A bad request returns its status instead of killing the process.
+ *            (The arguments are checked once per call, not per layer)
+ *          - With a cache attached, only the rows missing from it run through the network.
+ * @param dnn_network 
+ * @param inputs  [batch_size x input_layer_dense]
+ * @param outputs [batch_size x output_layer_dense] (Preallocated)
+ * @param batch_size 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Predict_Batch_Network(DNN_Network *dnn_network, Type_t *inputs, Type_t *outputs, uint16_t batch_size)
+{
+    const ANN_Status_t status = network_batch_check(dnn_network, inputs, outputs, batch_size);
+
+    if(status != ANN_OK)
+        return status;
 
-    //Hidden_Layer hidden_layers[hlNum];
-    //new_dnnNetwork->network_layers->Hidden_layer = hidden_layers;
+    struct _Cache_t *cache = dnn_network->network_layers->Inference_cache; // (Temporary variable for readbility).
 
-    // Create layer dense for each hidden layer.
-    const uint16_t hlDense = new_dnnNetwork->network_topology->hidden_layer_dense; // Temporary variable for readability.
+    if(cache == NULL)
+    {
+        network_forward_batch(dnn_network, inputs, outputs, batch_size);
+        return ANN_OK;
+    }
 
-    for(uint16_t i = 0; i < hlNum; i++)
-    {   
-        // Creat new hidden layers vector. (Initalize: True)
-        new_dnnNetwork->network_layers->Hidden_layer[i].hidden_layer = create_vector(hlDense, true);
+    const uint64_t version = Model_Version(dnn_network);
+
+    // Views of the missed rows. (The outputs rows are written in place)
+    double *missed_inputs[MAX_MATRIX_ROW], *missed_outputs[MAX_MATRIX_ROW];
+    uint16_t missed = 0;
+
+    for(uint16_t r = 0; r < batch_size; r++)
+    {
+        if(Cache_Lookup(cache, version, inputs->Matrix_t.Matrix[r], outputs->Matrix_t.Matrix[r]) == false)
+        {
+            missed_inputs[missed]  = inputs->Matrix_t.Matrix[r];
+            missed_outputs[missed] = outputs->Matrix_t.Matrix[r];
+            missed++;
+        }
     }
 
-    // Output Layer:
-    // Create the output layer & set its dense. (Initalize: True)
-    const uint16_t olDense = new_dnnNetwork->network_topology->output_layer_dense;
-    // Create heap memory for the output struct
-    new_dnnNetwork->network_layers->Output_layer = (Output_Layer *) malloc(sizeof(Output_Layer));
-    
-    if(new_dnnNetwork->network_layers->Output_layer == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    if(missed == 0)
+        return ANN_OK;
 
-    // Create heap memory and assign data to the output layer vector.
-    new_dnnNetwork->network_layers->Output_layer->output_layer = create_vector(olDense ,true);
+    Type_t missed_inputs_view  = {.Matrix_t = {.row = (uint8_t) missed, .col = inputs->Matrix_t.col, .Matrix = missed_inputs}};
+    Type_t missed_outputs_view = {.Matrix_t = {.row = (uint8_t) missed, .col = outputs->Matrix_t.col, .Matrix = missed_outputs}};
 
+    network_forward_batch(dnn_network, &missed_inputs_view, &missed_outputs_view, missed);
 
-    // Layer Weights: (Number of layers = hidden_layer_num + 2)
-    /*
-        row of the weights matrix: the output  vector dense.
-        col of the weights matrix: the input   vector dense.
-        Layer_Weights_Matrix       Input_Vector Output_Vector
-        [00, 01, 0j]               [0, 1, n] => [0] 
-        [10, 11, 1j]                         => [1]
-        [20, 21, 2j]                         => [2]
-        [i0, i1, ij]                         => [m]
-    */
-   
-    // Create layers weights (N_LAYERS - 1)
-    const uint16_t number_of_layers = new_dnnNetwork->network_topology->hidden_layer_num + 2; // temporary variable for readability.
-    const uint16_t number_of_matrices = number_of_layers - 1;
+    for(uint16_t r = 0; r < missed; r++)
+        Cache_Insert(cache, version, missed_inputs[r], missed_outputs[r]);
 
-    new_dnnNetwork->network_layers->Layer_weights = (Layer_Weights *) malloc(sizeof(Layer_Weights) * (number_of_matrices));
-   
-    if(new_dnnNetwork->network_layers->Layer_weights == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    return ANN_OK;
+}//end Predict_Batch_Network.
 
-    // Set the Weights(INPUT<=>HIDDEN[0]): (Layer_weights[0]) <> (Transient states excpetion)
-    uint16_t row = new_dnnNetwork->network_topology->hidden_layer_dense;
-    uint16_t col = new_dnnNetwork->network_topology->input_layer_dense;
-    new_dnnNetwork->network_layers->Layer_weights[0].layer_weights = create_matrix(row, col, true); // (Initalize: True).
+/**
+ * @brief Function to start an incremental forward propagation from a whole input.
+ *          - The network keeps the first layer accumulator (Weights[0] products) of this input.
+ *            Predict_Incremental then updates it from the changed inputs only.
+ * 
+ * @param dnn_network 
+ * @param input  [input_len] (Copied)
+ * @param input_len 
+ * @param output [output_len] (The output layer is copied into it)
+ * @param output_len 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Predict_Incremental_Reset(DNN_Network *dnn_network, const double *input, uint16_t input_len, double *output, uint16_t output_len)
+{
+    if( (dnn_network == NULL) || (input == NULL) || (output == NULL) )
+        return ANN_ERROR_NULL;
 
+    if( (input_len  != dnn_network->network_topology->input_layer_dense) ||
+        (output_len != dnn_network->network_topology->output_layer_dense) )
+        return ANN_ERROR_SHAPE;
 
-    // Set the Weights(HIDDEN[0]<=>HIDDEN[N])
-    row = new_dnnNetwork->network_topology->hidden_layer_dense;
-    col = new_dnnNetwork->network_topology->hidden_layer_dense;
+    Layer_t *layers = dnn_network->network_layers; // (Temporary variable for readbility).
 
-    for(uint16_t i = 1; i < number_of_matrices-1; i++) 
+    // Created once.
+    if(layers->Incremental_layer == NULL)
     {
-        new_dnnNetwork->network_layers->Layer_weights[i].layer_weights = create_matrix(row, col, true); // (Initalize: True).
+        const uint16_t hidden_layer_dense = dnn_network->network_topology->hidden_layer_dense;
+        const Memory_Context_t previous_context = Memory_Enter(layers->Memory_stats, MEMORY_ACTIVATIONS);
+
+        Incremental_Layer *incremental = (Incremental_Layer *) Memory_Calloc(sizeof(Incremental_Layer), MEMORY_OTHER);
+
+        incremental->accumulator = create_vector(hidden_layer_dense, false);
+        incremental->input       = create_vector(input_len, false);
+
+        Memory_Enter(layers->Memory_stats, MEMORY_WEIGHTS);
+        incremental->columns = create_matrix(input_len, hidden_layer_dense, false);
+
+        Memory_Leave(previous_context);
+
+        layers->Incremental_layer = incremental;
     }
 
-    // Set the Weights(HIDDEN[N]<=>OUTPUT): (Layer_weights[n-1]) <> (Transient states excpetion)
-    row = new_dnnNetwork->network_topology->output_layer_dense;
-    col = new_dnnNetwork->network_topology->hidden_layer_dense;
-    new_dnnNetwork->network_layers->Layer_weights[number_of_matrices-1].layer_weights = create_matrix(row, col, true); // (Initalize: True).
-    
-    // Layers_Biases:
-    // Create Layer Biases vector. (Initalize: True)
-    const uint16_t biases_vector_length = number_of_layers - 1; // Temporary variable for readability.
-    // Create Layers_Biases struct in heap.
-    new_dnnNetwork->network_layers->Layers_biases = (Layers_Biases *) malloc(sizeof(Layers_Biases));
-    
-    if(new_dnnNetwork->network_layers->Layers_biases == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    TRACE_BEGIN("incremental_reset", TRACE_CAT_INFERENCE);
 
-    // Create heap memory for the biases vector & assign the vector of biases.
-    new_dnnNetwork->network_layers->Layers_biases->layers_biases = create_vector(biases_vector_length, true);
+    memcpy(layers->Incremental_layer->input->Vector_t.Vector, input, sizeof(double) * input_len);
 
-    // Return the new created network.
-    return new_dnnNetwork;
-}//end Create_Network.
+    network_incremental_refresh(dnn_network);
+    network_incremental_forward(dnn_network, output);
 
-/*
-----------------------------------------------------------------
-!-                       DNN FUNCTIONS                         -
-----------------------------------------------------------------
-*/
+    TRACE_END("incremental_reset", TRACE_CAT_INFERENCE);
+
+    return ANN_OK;
+}//end Predict_Incremental_Reset.
 
 /**
- * @brief Function to perform the forward propagation on the network.
- *  - Forward Propagation Algorithms:
-        - Input_Layer (dot product) Weights_Layer[0] & Store the result in Hidden[0].
+ * @brief Function to perform the forward propagation after a few inputs changed. (Since the last one)
+ *  - Incremental Forward Propagation Algorithm:
+        - Accumulator[i] += delta * Weights[0][i][index] (For every change), then Hidden[0] = Activation(Accumulator + bias).
+        - The next layers run as usual.
+        - Costs O(changes x hidden_layer_dense) instead of O(input_layer_dense x hidden_layer_dense) on the first layer.
+ *  - Equal to Predict_Network of the updated input up to the rounding. The full product is computed
+ *    again every INCREMENTAL_REFRESH_UPDATES updates, after the weights change (model version), or
+ *    when half of the inputs or more changed.
+ * 
  * @param dnn_network 
+ * @param indices [changes_num] The changed inputs.
+ * @param deltas  [changes_num] Added to them.
+ * @param changes_num 
+ * @param output [output_len] (The output layer is copied into it)
+ * @param output_len 
+ * @return ANN_Status_t (ANN_ERROR_INVALID: No Predict_Incremental_Reset before)
  */
-void forward_propagation(DNN_Network *dnn_network)
+ANN_Status_t Predict_Incremental(DNN_Network *dnn_network, const uint16_t *indices, const double *deltas, uint16_t changes_num, double *output, uint16_t output_len)
 {
-    /// Check if the passed network isn't created yet.
-    if(dnn_network == NULL)
-        error_exit(CURRENT_C, "DNN_NETWORK: NULL");
+    if( (dnn_network == NULL) || (output == NULL) || ((changes_num > 0) && ((indices == NULL) || (deltas == NULL))) )
+        return ANN_ERROR_NULL;
 
-    // First the dot product of input & weights_layer[0].
-    // Do the dot product and store it in it.
-    Type_t *input_layer = dnn_network->network_layers->Input_layer->input_layer; // (Temporary variable for readbility).
-    Type_t *weights_layer_0 = dnn_network->network_layers->Layer_weights[0].layer_weights; // (Temporary variable for readbility).
-    
-    // Perform the dot product and save it into the hidden layer 0.
-    //free(hidden_layer_0); // Free the previous array.
-    dnn_network->network_layers->Hidden_layer[0].hidden_layer->Vector_t.Vector = VxM_DotProduct(input_layer, weights_layer_0);
-    // Apply biases to the vector.
-    ApplyBiases(dnn_network->network_layers->Layers_biases->layers_biases, 
-                dnn_network->network_layers->Hidden_layer[0].hidden_layer, 
-                (uint16_t) 0);
-                
-    // Apply the activation function.
-    dnn_network->network_layers->Hidden_layer[0].hidden_layer->Vector_t.Vector = 
-    dnn_network->network_topology->activation_function(dnn_network->network_layers->Hidden_layer[0].hidden_layer);
-
-    // Do the dot product from hidden layer [0] to hidden layer [n].
-    const uint16_t hidden_layers_num = dnn_network->network_topology->hidden_layer_num;
+    if(output_len != dnn_network->network_topology->output_layer_dense)
+        return ANN_ERROR_SHAPE;
 
-    uint16_t temporary_counter = 0; // Temporary counter for the number of multiplications.
-    uint16_t hidden_layer_counter = 1; // Temporary counter for iterating through the hidden layers.
-    uint16_t layer_weights_counter = 1; // Temporary counter for iterating through the weights.
-
-    while(temporary_counter < (hidden_layers_num-1))
-    {
-        Type_t *hidden_layer_current = dnn_network->network_layers->Hidden_layer[hidden_layer_counter-1].hidden_layer;
-        Type_t *weights_layer_current = dnn_network->network_layers->Layer_weights[layer_weights_counter].layer_weights;
-        
-        // Free the previous allocated array.
-        //free(hidden_layer_next);
-        // Store the dot product result.
-        dnn_network->network_layers->Hidden_layer[hidden_layer_counter].hidden_layer->Vector_t.Vector = VxM_DotProduct(hidden_layer_current, weights_layer_current);
-        // Apply biases to the vector.
-        ApplyBiases(dnn_network->network_layers->Layers_biases->layers_biases, 
-                    dnn_network->network_layers->Hidden_layer[hidden_layer_counter].hidden_layer, 
-                    (uint16_t) hidden_layer_counter);
-        
-        // Apply the activation function.
-        dnn_network->network_layers->Hidden_layer[hidden_layer_counter].hidden_layer->Vector_t.Vector = 
-        dnn_network->network_topology->activation_function(dnn_network->network_layers->Hidden_layer[hidden_layer_counter].hidden_layer);
-
-        temporary_counter++; 
-        hidden_layer_counter++; 
-        layer_weights_counter++; 
-    }//end while.
-    
-    // Do the dot product for hidden layer [n] and output layer.
-    Type_t *hidden_layer_n = dnn_network->network_layers->Hidden_layer[hidden_layers_num-1].hidden_layer;
-    const uint16_t layer_weights_num = hidden_layers_num; // ((+ 2 - 1) = (+ 1 - 1) = (0)).
-    Type_t *layer_weights_n = dnn_network->network_layers->Layer_weights[layer_weights_num].layer_weights;
+    Incremental_Layer *incremental = dnn_network->network_layers->Incremental_layer; // (Temporary variable for readbility).
 
-    // Free the previous allocated array.
-    //free(output_layer);
-    // Store the dot product result.
-    dnn_network->network_layers->Output_layer->output_layer->Vector_t.Vector = VxM_DotProduct(hidden_layer_n, layer_weights_n);
+    if( (incremental == NULL) || (incremental->version == 0) )
+        return ANN_ERROR_INVALID;
 
-    // Apply the activation function.
-    dnn_network->network_layers->Output_layer->output_layer->Vector_t.Vector = 
-    dnn_network->network_topology->output_activation_function(dnn_network->network_layers->Output_layer->output_layer);
+    const uint16_t input_dense = dnn_network->network_topology->input_layer_dense;
 
-    return;
-}//end forward_propagation.
+    // All the indices first: A bad request changes nothing.
+    for(uint16_t c = 0; c < changes_num; c++)
+    {
+        if(indices[c] >= input_dense)
+            return ANN_ERROR_SHAPE;
+    }
+
+    TRACE_BEGIN("incremental_update", TRACE_CAT_INFERENCE);
+
+    for(uint16_t c = 0; c < changes_num; c++)
+        incremental->input->Vector_t.Vector[indices[c]] += deltas[c];
+
+    if( (incremental->version != Model_Version(dnn_network)) || (incremental->updates >= INCREMENTAL_REFRESH_UPDATES) ||
+        (2 * changes_num >= input_dense) )
+    {
+        network_incremental_refresh(dnn_network);
+    }
+    else
+    {
+        double *accumulator = incremental->accumulator->Vector_t.Vector;
+        const uint16_t hidden_layer_dense = incremental->accumulator->Vector_t.len;
+
+        PROFILE_BEGIN(gemm_start);
+
+        for(uint16_t c = 0; c < changes_num; c++)
+        {
+            const double *column = incremental->columns->Matrix_t.Matrix[indices[c]];
+            const double delta = deltas[c];
+
+            for(uint16_t i = 0; i < hidden_layer_dense; i++)
+                accumulator[i] += delta * column[i];
+        }
+
+        PROFILE_END(dnn_network, 0, PROFILE_PHASE_GEMM, gemm_start,
+                    2.0 * changes_num * hidden_layer_dense, sizeof(double) * (changes_num + 2.0) * hidden_layer_dense);
+
+        incremental->updates++;
+    }
+
+    network_incremental_forward(dnn_network, output);
+
+    TRACE_END("incremental_update", TRACE_CAT_INFERENCE);
+
+    return ANN_OK;
+}//end Predict_Incremental.
 
 /**
  * @brief Function to perform the backward propagation on the network.
  *  ! Back Propagation Algorithm: (General: X[n+1] = X[n] + LR * dE/dX[n]) (X => Weight)
         Which means that (The new updated weight = the previous weight + 
             Learning_Rate * The error rate of change to the previous weight)
+    - Accumulates dE/dWeights & dE/dBiases of the last forward_propagation_train into the
+      network gradients. The optimizer function applies their mean & clears them.
+    - The dropout masks are regenerated from their (step, layer) stream, not stored.
  * @param dnn_network 
  * @param desired_output 
+ * @return double The loss of the current output.
  */
-void back_propagation(DNN_Network *dnn_network, Type_t *desired_output)
+double back_propagation(DNN_Network *dnn_network, Type_t *desired_output)
 {
     /// Check if the passed network isn't created yet.
-    if(dnn_network == NULL)
-        error_exit(CURRENT_C, "DNN_NETWORK: NULL");
+    if( (dnn_network == NULL) || (desired_output == NULL) )
+        error_exit(CURRENT_C, "DNN_NETWORK_DESIRED_OUTPUT: NULL");
+
+    if(desired_output->Vector_t.len != dnn_network->network_topology->output_layer_dense)
+        error_exit(CURRENT_C, "DESIRED_OUTPUT_LEN != NETWORK_VECTOR_LEN");
+
+    network_training_init(dnn_network);
+
+    TRACE_BEGIN("backward", TRACE_CAT_TRAIN);
+
+    Layer_Gradients *gradients = dnn_network->network_layers->Layer_gradients; // (Temporary variable for readbility).
+    const uint16_t hidden_layers_num = dnn_network->network_topology->hidden_layer_num;
 
     // Calculate the loss function for the network current output.
+    PROFILE_BEGIN(loss_start);
     Type_t *actual_output = dnn_network->network_layers->Output_layer->output_layer;
-    double *loss_function_vector = dnn_network->network_topology->loss_function(desired_output, actual_output);
+    uint8_t current_delta = 0;
+    double network_loss;
 
-    
-    return;                     
+    if(gradients->output_logits_saved)
+    {
+        // The fused pairs: The stable loss & the output layer error from the logits. (One row views)
+        double *logits_row  = gradients->output_logits->Vector_t.Vector;
+        double *desired_row = desired_output->Vector_t.Vector;
+        double *delta_row   = gradients->layer_deltas[current_delta]->Vector_t.Vector;
+        const uint8_t output_len = (uint8_t) actual_output->Vector_t.len;
+
+        Type_t logits_view  = {.Matrix_t = {.row = 1, .col = output_len, .Matrix = &logits_row}};
+        Type_t desired_view = {.Matrix_t = {.row = 1, .col = output_len, .Matrix = &desired_row}};
+        Type_t delta_view   = {.Matrix_t = {.row = 1, .col = output_len, .Matrix = &delta_row}};
+
+        if(dnn_network->network_topology->loss_function == &MCCE)
+            network_loss = MCCE_Batch(&logits_view, &desired_view, &delta_view, 1);
+        else
+            network_loss = BCE_Batch(&logits_view, &desired_view, &delta_view, 1);
+    }
+    else
+    {
+        // The output layer error.
+        network_loss = dnn_network->network_topology->loss_function(desired_output, actual_output);
+        network_output_delta(dnn_network, desired_output, gradients->layer_deltas[current_delta]->Vector_t.Vector);
+    }
+    PROFILE_END(dnn_network, hidden_layers_num, PROFILE_PHASE_LOSS, loss_start,
+                4 * actual_output->Vector_t.len, sizeof(double) * 3 * actual_output->Vector_t.len);
+
+    // The dropout masks of the forward pass.
+    const bool dropout = network_dropout_active(dnn_network);
+    const uint64_t dropout_key = (dropout) ? network_dropout_key(dnn_network) : 0;
+    const uint32_t keep_threshold = (dropout) ? network_dropout_threshold(dnn_network->network_config->dropout_rate) : 0;
+    const double keep_probability = 1.0 - dnn_network->network_config->dropout_rate;
+
+    // Gradient checkpointing: The segment buffer still holds the last segment after the forward pass.
+    uint16_t valid_segment = network_checkpoint_segment(dnn_network->network_layers, hidden_layers_num - 1);
+
+    for(uint16_t layer = hidden_layers_num; ; layer--)
+    {
+        // Recompute the segment of the input of this layer if the buffer holds another one. (From
+        // its highest layer: Once per segment)
+        if( (layer > 0) && (network_is_checkpoint(dnn_network->network_layers, layer - 1) == false) &&
+            (network_checkpoint_segment(dnn_network->network_layers, layer - 1) != valid_segment) )
+        {
+            network_recompute(dnn_network, layer - 1);
+            valid_segment = network_checkpoint_segment(dnn_network->network_layers, layer - 1);
+        }
+
+        Type_t *layer_input   = network_layer_input(dnn_network, layer);
+        Type_t *layer_weights = dnn_network->network_layers->Layer_weights[layer].layer_weights;
+
+        double **weights_gradients = gradients->weights_gradients[layer].layer_weights->Matrix_t.Matrix;
+        const double *delta = gradients->layer_deltas[current_delta]->Vector_t.Vector;
+        const double *input = layer_input->Vector_t.Vector;
+
+        // A bound input: Read in place, a strided one is gathered once for the outer product.
+        const Tensor_View_t *input_view = &dnn_network->network_layers->Input_layer->input_view;
+        double view_input[MAX_VECTOR_LEN];
+
+        if( (layer == 0) && (input_view->data != NULL) )
+        {
+            input = input_view->data;
+
+            if(input_view->stride > 1)
+            {
+                for(uint16_t j = 0; j < input_view->len; j++)
+                    view_input[j] = input_view->data[(size_t) j * input_view->stride];
+
+                input = view_input;
+            }
+        }
+
+        // A bound sparse input: Its active columns only get gradients.
+        const Sparse_Vector_t *input_sparse = &dnn_network->network_layers->Input_layer->input_sparse;
+        const bool sparse = (layer == 0) && (input_view->data == NULL) && (input_sparse->len != 0);
+
+        const uint16_t rows = layer_weights->Matrix_t.row; // Temporary variable for readability.
+        const uint16_t cols = layer_weights->Matrix_t.col; // Temporary variable for readability.
+
+        // dE/dWeights = delta (outer product) input.
+        PROFILE_BEGIN(gradient_start);
+
+        if(sparse)
+        {
+            for(uint16_t i = 0; i < rows; i++)
+            {
+                for(uint16_t k = 0; k < input_sparse->nnz; k++)
+                    weights_gradients[i][input_sparse->indices[k]] += delta[i] * 
+                        ((input_sparse->values != NULL) ? (input_sparse->values[k]) : (1.0));
+            }
+        }
+        else
+        {
+            for(uint16_t i = 0; i < rows; i++)
+            {
+                for(uint16_t j = 0; j < cols; j++)
+                    weights_gradients[i][j] += delta[i] * input[j];
+            }
+        }
+
+        // dE/dBias. (One bias per hidden layer)
+        if(layer < hidden_layers_num)
+        {
+            double delta_sum = 0.0;
+
+            for(uint16_t i = 0; i < rows; i++)
+                delta_sum += delta[i];
+
+            gradients->biases_gradients->Vector_t.Vector[layer] += delta_sum;
+        }
+
+        const uint16_t gradient_cols = (sparse) ? (input_sparse->nnz) : (cols); // The columns written.
+
+        PROFILE_END(dnn_network, layer, PROFILE_PHASE_GRADIENT, gradient_start,
+                    2.0 * rows * gradient_cols, sizeof(double) * ((2 * rows * gradient_cols) + rows + gradient_cols));
+
+        if(layer == 0)
+            break;
+
+        // Back propagate the error to the previous hidden layer.
+        PROFILE_BEGIN(delta_start);
+        double *previous_delta = gradients->layer_deltas[current_delta ^ 1]->Vector_t.Vector;
+
+        memset(previous_delta, 0, sizeof(double) * cols);
+
+        for(uint16_t i = 0; i < rows; i++)
+        {
+            for(uint16_t j = 0; j < cols; j++)
+                previous_delta[j] += layer_weights->Matrix_t.Matrix[i][j] * delta[i];
+        }
+
+        // Through the dropout mask & the activation of the previous layer.
+        const double *activated = input;
+        double kept_activated[MAX_VECTOR_LEN];
+
+        if(dropout)
+        {
+            uint32_t mask_randoms[MAX_VECTOR_LEN];
+            Random_Fill_U32(dropout_key, network_dropout_stream(gradients->step, layer - 1), 0, mask_randoms, cols);
+
+            for(uint16_t j = 0; j < cols; j++)
+            {
+                if(mask_randoms[j] >= keep_threshold)
+                {
+                    // (A dropped neuron is 0: Any finite drevative keeps its error 0)
+                    previous_delta[j] = 0.0;
+                    kept_activated[j] = 0.0;
+                    continue;
+                }
+
+                // Undo the inverted dropout scale.
+                kept_activated[j] = input[j] * keep_probability;
+                previous_delta[j] /= keep_probability;
+            }
+
+            activated = kept_activated;
+        }
+
+        network_activation_derivative(dnn_network->network_layers->Activation_plan.hidden, 
+                                      dnn_network->network_layers->Activation_plan.alpha, activated, previous_delta, cols);
+
+        PROFILE_END(dnn_network, layer, PROFILE_PHASE_DELTA, delta_start,
+                    (2.0 * rows * cols) + (2.0 * cols), sizeof(double) * ((rows * cols) + rows + (2 * cols)));
+
+        current_delta ^= 1;
+    }
+
+    gradients->step++;
+    gradients->accumulated++;
+
+    TRACE_END("backward", TRACE_CAT_TRAIN);
+
+    return network_loss;
 }//end back_propagation.
 
+/**
+ * @brief Function to train the network on a set of samples.
+ *  - For (epochs): For every sample: forward_propagation_train => back_propagation.
+ *                   Every (batch_size) samples & after the last one: optimizer. (Mean of the accumulated gradients)
+ * @param dnn_network 
+ * @param inputs          [samples_num x input_layer_dense]
+ * @param desired_outputs [samples_num x output_layer_dense]
+ * @param samples_num 
+ * @return double The mean loss of the last epoch.
+ */
+double Train_Network(DNN_Network *dnn_network, Type_t *inputs, Type_t *desired_outputs, uint16_t samples_num)
+{
+    // Error Handeling.
+    if( (dnn_network == NULL) || (inputs == NULL) || (desired_outputs == NULL) )
+        error_exit(CURRENT_C, "DNN_NETWORK_INPUTS_OUTPUTS: NULL");
+
+    if( (samples_num <= 0) || (inputs->Matrix_t.row < samples_num) || (desired_outputs->Matrix_t.row < samples_num) ||
+        (inputs->Matrix_t.col != dnn_network->network_topology->input_layer_dense) ||
+        (desired_outputs->Matrix_t.col != dnn_network->network_topology->output_layer_dense) )
+        error_exit(CURRENT_C, "INPUTS_OUTPUTS_DIMS:INVALID");
+
+    Input_Layer *input_layer = dnn_network->network_layers->Input_layer; // (Temporary variable for readbility).
+    const Tensor_View_t bound_view = input_layer->input_view;
+    Type_t desired_output = {.Vector_t = {.len = desired_outputs->Matrix_t.col, .Vector = NULL}};
+
+    // Samples per optimizer step.
+    const uint16_t batch_size = (dnn_network->network_config->batch_size > 1) ? (dnn_network->network_config->batch_size) : (1);
+
+    double epoch_loss = 0.0;
+
+    for(uint16_t epoch = 0; epoch < dnn_network->network_config->epochs; epoch++)
+    {
+        TRACE_BEGIN("epoch", TRACE_CAT_TRAIN);
+
+        epoch_loss = 0.0;
+
+        for(uint16_t s = 0; s < samples_num; s++)
+        {
+            TRACE_BEGIN("train_step", TRACE_CAT_TRAIN);
+
+            // Borrow the sample. (No copy)
+            input_layer->input_view = Tensor_View_Row(inputs, s);
+            desired_output.Vector_t.Vector = desired_outputs->Matrix_t.Matrix[s];
+
+            forward_propagation_train(dnn_network);
+            epoch_loss += back_propagation(dnn_network, &desired_output);
+
+            // One step per full batch. (And for the last, partial one)
+            if( (((s + 1) % batch_size) == 0) || ((s + 1) == samples_num) )
+            {
+                TRACE_BEGIN("optimizer", TRACE_CAT_OPTIMIZER);
+                dnn_network->network_topology->optimizer_function(dnn_network);
+                dnn_network->network_layers->Model_version = 0; // (Custom optimizers too)
+                TRACE_END("optimizer", TRACE_CAT_OPTIMIZER);
+            }
+
+            TRACE_END("train_step", TRACE_CAT_TRAIN);
+        }
+
+        epoch_loss /= samples_num;
+
+        TRACE_END("epoch", TRACE_CAT_TRAIN);
+    }
+
+    input_layer->input_view = bound_view;
+
+    return epoch_loss;
+}//end Train_Network.
+
 /**
  * @brief Function to set the input vector of the network.
  * 
@@ -312,14 +2058,198 @@ void Set_Input(DNN_Network *myNetwork, Type_t *vector)
         error_exit(CURRENT_C, "VECTOR_LEN != NETWORK_VECTOR_LEN");
     // assert(vector_len == network_vector_len); // For strictly exit.
 
-    // Set the network vector.
-    Type_t *input_layer_temp = myNetwork->network_layers->Input_layer->input_layer;
-    myNetwork->network_layers->Input_layer->input_layer = vector;
+    // Set the network vector.
+    Type_t *input_layer_temp = myNetwork->network_layers->Input_layer->input_layer;
+    myNetwork->network_layers->Input_layer->input_layer = vector;
+    // (The network reads its own vector again)
+    myNetwork->network_layers->Input_layer->input_view.data = NULL;
+    myNetwork->network_layers->Input_layer->input_sparse.len = 0;
+
+    free_vector(input_layer_temp);
+
+    return;
+}//end Set_Input.
+
+/**
+ * @brief Function to bind a borrowed input to the network. (Zero copy Set_Input)
+ *          - The forward passes & back_propagation read it in place until the next
+ *            Bind_Input/Set_Input. The data must stay valid meanwhile.
+ *          - Re-bind it for every sample: Bind_Input(myNetwork, &row_view).
+ * 
+ * @param myNetwork 
+ * @param view (NULL: Read the input layer vector again)
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Bind_Input(DNN_Network *myNetwork, const Tensor_View_t *view)
+{
+    if(myNetwork == NULL)
+        return ANN_ERROR_NULL;
+
+    Input_Layer *input_layer = myNetwork->network_layers->Input_layer; // (Temporary variable for readbility).
+
+    if(view == NULL)
+    {
+        input_layer->input_view.data = NULL;
+        input_layer->input_sparse.len = 0;
+        return ANN_OK;
+    }
+
+    const ANN_Status_t status = Tensor_View_Check(view);
+
+    if(status != ANN_OK)
+        return status;
+
+    if(view->len != myNetwork->network_topology->input_layer_dense)
+        return ANN_ERROR_SHAPE;
+
+    input_layer->input_view = Tensor_View(view->data, view->len, view->stride);
+    input_layer->input_sparse.len = 0;
+
+    return ANN_OK;
+}//end Bind_Input.
+
+/**
+ * @brief Function to bind a borrowed sparse input to the network. (One-hot & bag of features inputs)
+ *          - The first layer sums the weights columns of its non zero elements only: O(nnz) instead of
+ *            O(input_layer_dense) per neuron, and back_propagation writes the gradients of these columns only.
+ *          - The indices & the values are read in place until the next Bind_Input/Bind_Sparse_Input/Set_Input.
+ * 
+ * @param myNetwork 
+ * @param sparse (NULL: Read the input layer vector again)
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Bind_Sparse_Input(DNN_Network *myNetwork, const Sparse_Vector_t *sparse)
+{
+    if(myNetwork == NULL)
+        return ANN_ERROR_NULL;
+
+    Input_Layer *input_layer = myNetwork->network_layers->Input_layer; // (Temporary variable for readbility).
+
+    if(sparse == NULL)
+    {
+        input_layer->input_view.data = NULL;
+        input_layer->input_sparse.len = 0;
+        return ANN_OK;
+    }
+
+    const ANN_Status_t status = Sparse_Vector_Check(sparse);
+
+    if(status != ANN_OK)
+        return status;
+
+    if(sparse->len != myNetwork->network_topology->input_layer_dense)
+        return ANN_ERROR_SHAPE;
+
+    input_layer->input_sparse = *sparse;
+    input_layer->input_view.data = NULL;
+
+    return ANN_OK;
+}//end Bind_Sparse_Input.
+
+/**
+ * @brief Function to attach a results cache to the Predict functions of the network.
+ *          - One cache may be shared by many networks & threads. Networks with the same
+ *            weights (Loaded from the same model file) share their cached results.
+ * 
+ * @param myNetwork 
+ * @param cache (Borrowed, NULL: Detach)
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Attach_Cache(DNN_Network *myNetwork, struct _Cache_t *cache)
+{
+    if(myNetwork == NULL)
+        return ANN_ERROR_NULL;
+
+    if( (cache != NULL) && ((cache->input_dense  != myNetwork->network_topology->input_layer_dense) ||
+                            (cache->output_dense != myNetwork->network_topology->output_layer_dense)) )
+        return ANN_ERROR_SHAPE;
+
+    myNetwork->network_layers->Inference_cache = cache;
+
+    return ANN_OK;
+}//end Attach_Cache.
+
+/**
+ * @brief Function to set the rows of the depth-first batch tiles. (Overrides the config batch_tile)
+ *          - Every tile runs through all the layers before the next one: Its activations stay
+ *            in the cache. A tile of a whole batch runs it layer by layer.
+ * 
+ * @param myNetwork 
+ * @param batch_tile (0: Sized for the L2 cache)
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Set_Batch_Tile(DNN_Network *myNetwork, uint16_t batch_tile)
+{
+    if( (myNetwork == NULL) || (myNetwork->network_layers == NULL) )
+        return ANN_ERROR_NULL;
+
+    if(batch_tile > MAX_MATRIX_ROW)
+        return ANN_ERROR_LIMIT;
+
+    // (The workspace grows on the next batched pass if the tile is larger)
+    myNetwork->network_layers->Batch_tile = network_batch_tile(myNetwork->network_topology, batch_tile);
+
+    return ANN_OK;
+}//end Set_Batch_Tile.
+
+/**
+ * @brief Function to get the model version: A hash of the shapes, the activations, the weights & the biases.
+ *          - Hashed once after every change of the weights. (Optimizer steps, Init_Network, Load_Network,
+ *            Weights_Changed)
+ * 
+ * @param myNetwork 
+ * @return uint64_t (Never 0)
+ */
+uint64_t Model_Version(DNN_Network *myNetwork)
+{
+    // Error Handeling.
+    if(myNetwork == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    Layer_t *layers = myNetwork->network_layers; // (Temporary variable for readbility).
+
+    if(layers->Model_version != 0)
+        return layers->Model_version;
+
+    const Activation_Plan_t plan = layers->Activation_plan;
+    const double shapes[] = {myNetwork->network_topology->input_layer_dense, myNetwork->network_topology->output_layer_dense,
+                             myNetwork->network_topology->hidden_layer_num,  myNetwork->network_topology->hidden_layer_dense,
+                             plan.hidden, plan.output, plan.alpha};
+
+    uint64_t version = Cache_Hash(shapes, sizeof(shapes) / sizeof(shapes[0]), 0);
+
+    for(uint16_t layer = 0; layer <= myNetwork->network_topology->hidden_layer_num; layer++)
+    {
+        Type_t *layer_weights = layers->Layer_weights[layer].layer_weights;
+
+        for(uint16_t r = 0; r < layer_weights->Matrix_t.row; r++)
+            version = Cache_Hash(layer_weights->Matrix_t.Matrix[r], layer_weights->Matrix_t.col, version);
+    }
+
+    Type_t *biases = layers->Layers_biases->layers_biases;
+    version = Cache_Hash(biases->Vector_t.Vector, biases->Vector_t.len, version);
+
+    layers->Model_version = (version != 0) ? (version) : (1);
+
+    return layers->Model_version;
+}//end Model_Version.
 
-    free_vector(input_layer_temp);
+/**
+ * @brief Function to tell the network its weights were changed outside the library functions.
+ *          - The cached results of the old weights won't be returned anymore.
+ * 
+ * @param myNetwork 
+ */
+void Weights_Changed(DNN_Network *myNetwork)
+{
+    // Error Handeling.
+    if(myNetwork == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    myNetwork->network_layers->Model_version = 0;
 
     return;
-}//end Set_Input.
+}//end Weights_Changed.
 
 /**
  * @brief Function to set the input vector of the network.
@@ -364,8 +2294,8 @@ void Set_Output(DNN_Network *myNetwork, Type_t *vector)
  */
 double *ReLU(Type_t *vector)
 {
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     const uint16_t vector_len = vector->Vector_t.len;
 
@@ -386,9 +2316,8 @@ double *ReLU(Type_t *vector)
  */
 double *ReLU_D(Type_t *vector)
 {
-    // Error Handeling.
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     const uint16_t vector_len = vector->Vector_t.len;
 
@@ -411,9 +2340,8 @@ double *ReLU_D(Type_t *vector)
  */
 double *ELU(Type_t *vector)
 {   
-    // Error Handeling.
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     const uint16_t vector_len = vector->Vector_t.len;
 
@@ -438,9 +2366,8 @@ double *ELU(Type_t *vector)
  */
 double *ELU_D(Type_t *vector)
 {
-    // Error Handeling.
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     const uint16_t vector_len = vector->Vector_t.len;
 
@@ -463,8 +2390,8 @@ double *ELU_D(Type_t *vector)
  */
 double *Sigmoid(Type_t *vector)
 {
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     const uint16_t vector_len = vector->Vector_t.len;
 
@@ -484,9 +2411,8 @@ double *Sigmoid(Type_t *vector)
  */
 double *Sigmoid_D(Type_t *vector)
 {
-    // Error Handeling.
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     const uint16_t vector_len = vector->Vector_t.len;
 
@@ -509,9 +2435,8 @@ double *Sigmoid_D(Type_t *vector)
  */
 double *Tanh(Type_t *vector)
 {
-    // Error Handeling.
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     const uint16_t vector_len = vector->Vector_t.len;
 
@@ -531,9 +2456,8 @@ double *Tanh(Type_t *vector)
  */
 double *Tanh_D(Type_t *vector)
 {
-    // Error Handeling.
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     double *Tanhed = Tanh(vector);
 
@@ -549,24 +2473,34 @@ double *Tanh_D(Type_t *vector)
 
 /**
  * @brief The Softmax Activation Function.
+ *  - Stable form: exp(x[i] - max(x)) / sum(exp(x - max(x))). (Same result, no overflow)
  * 
  * @param vector 
  * @return double* 
  */
 double *SoftMax(Type_t *vector)
 {
-    // Error Handeling.
-    if(vector == NULL)
-        error_exit(CURRENT_C, "VECTOR:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT(vector != NULL, "VECTOR:NULL");
 
     const uint16_t vector_len = vector->Vector_t.len;
 
-    // Calculate the exponential sum of the given vector.
+    // Find the max element to shift the exponentials with.
+    double max_element = vector->Vector_t.Vector[0];
+
+    for(uint16_t i = 1; i < vector_len; i++)
+    {
+        if(vector->Vector_t.Vector[i] > max_element)
+            max_element = vector->Vector_t.Vector[i];
+    }
+
+    // Calculate the exponentials & their sum.
     double exponential_sum = 0.0f;
 
     for(uint16_t i = 0; i < vector_len; i++)
     {
-        exponential_sum += exp(vector->Vector_t.Vector[i]);
+        vector->Vector_t.Vector[i] = exp(vector->Vector_t.Vector[i] - max_element);
+        exponential_sum += vector->Vector_t.Vector[i];
     }
 
     // Convert the regression vector to classification vector.
@@ -589,9 +2523,9 @@ double *SoftMax(Type_t *vector)
  * 
  * @param desired_vector 
  * @param obtained_vector 
- * @return double* 
+ * @return double 
  */
-double *MSE(Type_t *desired_vector, Type_t *obtained_vector)
+double MSE(Type_t *desired_vector, Type_t *obtained_vector)
 {
     // Error handeling.
     if(obtained_vector == NULL || desired_vector == NULL)
@@ -599,17 +2533,15 @@ double *MSE(Type_t *desired_vector, Type_t *obtained_vector)
 
     const uint16_t vector_len = obtained_vector->Vector_t.len;
 
-    double *error = (double *) malloc(sizeof(double));
+    double error = 0.0;
 
     for(uint16_t i = 0; i < vector_len; i++)
     {
-        *error += pow( (desired_vector->Vector_t.Vector[i] - obtained_vector->Vector_t.Vector[i]), 2);
+        const double difference = desired_vector->Vector_t.Vector[i] - obtained_vector->Vector_t.Vector[i];
+        error += difference * difference;
     }
 
-    *error = (*error / vector_len);
-
-    // !Don't Forget to free the allocated location. (In the use)
-    return error;
+    return (error / vector_len);
 }//end MSE.
 
 /**
@@ -617,9 +2549,9 @@ double *MSE(Type_t *desired_vector, Type_t *obtained_vector)
  * 
  * @param desired_vector 
  * @param obtained_vector 
- * @return double* 
+ * @return double 
  */
-double *MAE(Type_t *desired_vector, Type_t *obtained_vector)
+double MAE(Type_t *desired_vector, Type_t *obtained_vector)
 {
     // Error handeling.
     if(obtained_vector == NULL || desired_vector == NULL)
@@ -627,17 +2559,251 @@ double *MAE(Type_t *desired_vector, Type_t *obtained_vector)
     
     const uint16_t vector_len = obtained_vector->Vector_t.len;
 
-    double *error = (double *) malloc(sizeof(double));
+    double error = 0.0;
+
+    for(uint16_t i = 0; i < vector_len; i++)
+    {
+        error += fabs( (desired_vector->Vector_t.Vector[i] - obtained_vector->Vector_t.Vector[i]) );
+    }
+
+    return (error / vector_len);
+}//end MAE.
+
+/**
+ * @brief Function to perform the binary classification error. (Rate of wrong 0/1 decisions)
+ * 
+ * @param desired_vector 
+ * @param obtained_vector Probabilities. (Sigmoid output)
+ * @return double 
+ */
+double BC(Type_t *desired_vector, Type_t *obtained_vector)
+{
+    // Error handeling.
+    if(obtained_vector == NULL || desired_vector == NULL)
+        error_exit(CURRENT_C, "VECTOR:NULL");
+
+    const uint16_t vector_len = obtained_vector->Vector_t.len;
+
+    uint16_t wrong_decisions = 0;
 
     for(uint16_t i = 0; i < vector_len; i++)
     {
-        *error += abs( (desired_vector->Vector_t.Vector[i] - obtained_vector->Vector_t.Vector[i]) );
+        wrong_decisions += ( (obtained_vector->Vector_t.Vector[i] >= 0.5) != 
+                             (desired_vector->Vector_t.Vector[i]  >= 0.5) );
     }
 
-    *error = (*error / vector_len);
+    return ((double) wrong_decisions / vector_len);
+}//end BC.
+
+/**
+ * @brief Function to perform the binary cross entropy loss.
+ *  - BCE = -mean(t * log(p) + (1 - t) * log(1 - p)). (p clamped away from 0 & 1)
+ * 
+ * @param desired_vector 
+ * @param obtained_vector Probabilities. (Sigmoid output)
+ * @return double 
+ */
+double BCE(Type_t *desired_vector, Type_t *obtained_vector)
+{
+    // Error handeling.
+    if(obtained_vector == NULL || desired_vector == NULL)
+        error_exit(CURRENT_C, "VECTOR:NULL");
+
+    const uint16_t vector_len = obtained_vector->Vector_t.len;
+
+    double error = 0.0;
+
+    for(uint16_t i = 0; i < vector_len; i++)
+    {
+        const double target = desired_vector->Vector_t.Vector[i];
+        const double probability = fmin(fmax(obtained_vector->Vector_t.Vector[i], LOSS_EPSILON), 1.0 - LOSS_EPSILON);
+
+        error -= (target * log(probability)) + ((1.0 - target) * log(1.0 - probability));
+    }
+
+    return (error / vector_len);
+}//end BCE.
+
+/**
+ * @brief Function to perform the multi class classification error. (1 if the predicted class is wrong)
+ * 
+ * @param desired_vector 
+ * @param obtained_vector 
+ * @return double 
+ */
+double MCC(Type_t *desired_vector, Type_t *obtained_vector)
+{
+    // Error handeling.
+    if(obtained_vector == NULL || desired_vector == NULL)
+        error_exit(CURRENT_C, "VECTOR:NULL");
+
+    const uint16_t vector_len = obtained_vector->Vector_t.len;
+
+    // Compare the classes with the highest score.
+    uint16_t obtained_class = 0;
+    uint16_t desired_class  = 0;
+
+    for(uint16_t i = 1; i < vector_len; i++)
+    {
+        if(obtained_vector->Vector_t.Vector[i] > obtained_vector->Vector_t.Vector[obtained_class])
+            obtained_class = i;
+
+        if(desired_vector->Vector_t.Vector[i] > desired_vector->Vector_t.Vector[desired_class])
+            desired_class = i;
+    }
+
+    return (obtained_class != desired_class) ? (1.0) : (0.0);
+}//end MCC.
+
+/**
+ * @brief Function to perform the multi class cross entropy loss.
+ *  - MCCE = -sum(t * log(p)). (p clamped away from 0)
+ * 
+ * @param desired_vector 
+ * @param obtained_vector Probabilities. (SoftMax output)
+ * @return double 
+ */
+double MCCE(Type_t *desired_vector, Type_t *obtained_vector)
+{
+    // Error handeling.
+    if(obtained_vector == NULL || desired_vector == NULL)
+        error_exit(CURRENT_C, "VECTOR:NULL");
+
+    const uint16_t vector_len = obtained_vector->Vector_t.len;
+
+    double error = 0.0;
+
+    for(uint16_t i = 0; i < vector_len; i++)
+    {
+        if(desired_vector->Vector_t.Vector[i] != 0.0)
+            error -= desired_vector->Vector_t.Vector[i] * log(fmax(obtained_vector->Vector_t.Vector[i], LOSS_EPSILON));
+    }
 
     return error;
-}//end MAE.
+}//end MCCE.
+
+/**
+ * @brief Fused sigmoid + binary cross entropy over a batch of logits.
+ *  - Per element (z: logit, t: target):
+        Loss     = max(z, 0) - z * t + log(1 + exp(-|z|))   (Never overflows)
+        Gradient = (Sigmoid(z) - t) / (batch_size * classes) (dLoss/dz of the mean loss)
+    - exp(-|z|) is shared by the loss & the sigmoid, so each element costs one exp.
+ * 
+ * @param logits   [batch_size x classes] The output layer before the activation.
+ * @param desired  [batch_size x classes]
+ * @param gradient [batch_size x classes] (Preallocated, NULL: loss only)
+ * @param batch_size 
+ * @return double The mean loss.
+ */
+double BCE_Batch(Type_t *logits, Type_t *desired, Type_t *gradient, uint16_t batch_size)
+{
+    // Error handeling.
+    if( (logits == NULL) || (desired == NULL) )
+        error_exit(CURRENT_C, "LOGITS_DESIRED:NULL");
+
+    if( (batch_size <= 0) || (logits->Matrix_t.row < batch_size) || (desired->Matrix_t.row < batch_size) ||
+        (logits->Matrix_t.col != desired->Matrix_t.col) ||
+        ( (gradient != NULL) && ( (gradient->Matrix_t.row < batch_size) || (gradient->Matrix_t.col != logits->Matrix_t.col) ) ) )
+        error_exit(CURRENT_C, "LOGITS_DESIRED_GRADIENT_DIMS:INVALID");
+
+    const uint16_t classes = logits->Matrix_t.col; // Temporary variable for readability.
+    const double gradient_scale = 1.0 / ((double) batch_size * classes);
+
+    double loss = 0.0;
+
+    for(uint16_t r = 0; r < batch_size; r++)
+    {
+        const double *z = logits->Matrix_t.Matrix[r];
+        const double *t = desired->Matrix_t.Matrix[r];
+
+        for(uint16_t i = 0; i < classes; i++)
+        {
+            const double exponential = exp(-fabs(z[i]));
+
+            loss += fmax(z[i], 0.0) - (z[i] * t[i]) + log1p(exponential);
+
+            if(gradient != NULL)
+            {
+                const double sigmoid = (z[i] >= 0) ? (1.0 / (1.0 + exponential)) : (exponential / (1.0 + exponential));
+                gradient->Matrix_t.Matrix[r][i] = (sigmoid - t[i]) * gradient_scale;
+            }
+        }
+    }
+
+    return (loss * gradient_scale);
+}//end BCE_Batch.
+
+/**
+ * @brief Fused softmax + multi class cross entropy over a batch of logits.
+ *  - Per row (z: logits, t: targets):
+        1- One read sweep keeps the running max (m), the running sum (s) of exp(z - m),
+           sum(t * z) & sum(t). (The sum is rescaled whenever the max grows)
+        2- LogSumExp = m + log(s), Loss = sum(t) * LogSumExp - sum(t * z). (= -sum(t * LogSoftMax(z)))
+        3- The gradient only: One write sweep, Gradient = (sum(t) * exp(z - LogSumExp) - t) / batch_size.
+           (Any targets: sum(t) is 1 for the one hot & the normalized ones)
+ * 
+ * @param logits   [batch_size x classes] The output layer before the activation.
+ * @param desired  [batch_size x classes]
+ * @param gradient [batch_size x classes] (Preallocated, NULL: loss only)
+ * @param batch_size 
+ * @return double The mean loss.
+ */
+double MCCE_Batch(Type_t *logits, Type_t *desired, Type_t *gradient, uint16_t batch_size)
+{
+    // Error handeling.
+    if( (logits == NULL) || (desired == NULL) )
+        error_exit(CURRENT_C, "LOGITS_DESIRED:NULL");
+
+    if( (batch_size <= 0) || (logits->Matrix_t.row < batch_size) || (desired->Matrix_t.row < batch_size) ||
+        (logits->Matrix_t.col != desired->Matrix_t.col) ||
+        ( (gradient != NULL) && ( (gradient->Matrix_t.row < batch_size) || (gradient->Matrix_t.col != logits->Matrix_t.col) ) ) )
+        error_exit(CURRENT_C, "LOGITS_DESIRED_GRADIENT_DIMS:INVALID");
+
+    const uint16_t classes = logits->Matrix_t.col; // Temporary variable for readability.
+    const double gradient_scale = 1.0 / batch_size;
+
+    double loss = 0.0;
+
+    for(uint16_t r = 0; r < batch_size; r++)
+    {
+        const double *z = logits->Matrix_t.Matrix[r];
+        const double *t = desired->Matrix_t.Matrix[r];
+
+        // Online max & exponential sum, with the target sums of the loss.
+        double max_logit = z[0];
+        double exponential_sum = 1.0;
+        double target_logits = t[0] * z[0];
+        double target_sum = t[0];
+
+        for(uint16_t i = 1; i < classes; i++)
+        {
+            target_logits += t[i] * z[i];
+            target_sum += t[i];
+
+            if(z[i] > max_logit)
+            {
+                exponential_sum = (exponential_sum * exp(max_logit - z[i])) + 1.0;
+                max_logit = z[i];
+            }
+            else
+            {
+                exponential_sum += exp(z[i] - max_logit);
+            }
+        }
+
+        const double log_sum_exp = max_logit + log(exponential_sum);
+
+        loss += (target_sum * log_sum_exp) - target_logits;
+
+        if(gradient != NULL)
+        {
+            for(uint16_t i = 0; i < classes; i++)
+                gradient->Matrix_t.Matrix[r][i] = ((target_sum * exp(z[i] - log_sum_exp)) - t[i]) * gradient_scale;
+        }
+    }
+
+    return (loss * gradient_scale);
+}//end MCCE_Batch.
 
 /*
 ----------------------------------------------------------------
@@ -647,18 +2813,105 @@ double *MAE(Type_t *desired_vector, Type_t *obtained_vector)
 
 /**
  * @brief Function to do the optimization with gradient decent.
+ *  - Weights = Weights - (Learning_Rate * dE/dWeights), then the gradients are cleared.
+ *  - dE/dWeights: The mean of the back propagations accumulated since the last step.
+ * 
+ * @param dnn_network 
+ */
+void GradientDescent(DNN_Network *dnn_network)
+{
+    // Error handeling.
+    if(dnn_network == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    Layer_Gradients *gradients = dnn_network->network_layers->Layer_gradients; // (Temporary variable for readbility).
+
+    // Nothing to apply before the first back propagation.
+    if(gradients == NULL)
+        return;
+
+    // The mean of the accumulated gradients, scaled in the same pass.
+    const double learning_rate = (gradients->accumulated > 1) ? 
+                                 (dnn_network->network_config->learning_rate / gradients->accumulated) : 
+                                 (dnn_network->network_config->learning_rate);
+    const uint16_t number_of_matrices = dnn_network->network_topology->hidden_layer_num + 1;
+
+    for(uint16_t layer = 0; layer < number_of_matrices; layer++)
+    {
+        Type_t *layer_weights     = dnn_network->network_layers->Layer_weights[layer].layer_weights;
+        Type_t *weights_gradients = gradients->weights_gradients[layer].layer_weights;
+
+        PROFILE_BEGIN(optimizer_start);
+
+        for(uint16_t i = 0; i < layer_weights->Matrix_t.row; i++)
+        {
+            for(uint16_t j = 0; j < layer_weights->Matrix_t.col; j++)
+            {
+                layer_weights->Matrix_t.Matrix[i][j] -= learning_rate * weights_gradients->Matrix_t.Matrix[i][j];
+                weights_gradients->Matrix_t.Matrix[i][j] = 0.0;
+            }
+        }
+
+        dnn_network->network_layers->Layers_biases->layers_biases->Vector_t.Vector[layer] -= 
+            learning_rate * gradients->biases_gradients->Vector_t.Vector[layer];
+        gradients->biases_gradients->Vector_t.Vector[layer] = 0.0;
+
+        PROFILE_END(dnn_network, layer, PROFILE_PHASE_OPTIMIZER, optimizer_start,
+                    2.0 * layer_weights->Matrix_t.row * layer_weights->Matrix_t.col,
+                    sizeof(double) * 4 * layer_weights->Matrix_t.row * layer_weights->Matrix_t.col);
+    }
+
+    gradients->accumulated = 0;
+
+    // New weights: A new model version.
+    dnn_network->network_layers->Model_version = 0;
+
+    return;
+}//end GradientDescent.
+
+/*
+----------------------------------------------------------------
+!-                       REGULARIZATION FUNCTIONS              -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to apply inverted dropout to a vector.
+ *  - Every neuron is kept with probability (1 - dropout_rate) & scaled by 1 / (1 - dropout_rate),
+ *    so the inference needs no rescaling.
+ *  - The mask comes from the (key, stream) counter based random numbers: The same key & stream
+ *    always drop the same neurons.
  * 
  * @param vector 
- * @return double* 
+ * @param dropout_rate 
+ * @param key 
+ * @param stream 
  */
-double *GradientDescent(Type_t *vector)
+void Dropout_Apply(Type_t *vector, double dropout_rate, uint64_t key, uint64_t stream)
 {
     // Error handeling.
     if(vector == NULL)
         error_exit(CURRENT_C, "VECTOR:NULL");
-    
-    return NULL;
-}//end GradientDescent.
+
+    if( !((dropout_rate >= 0.0) && (dropout_rate < 1.0)) )
+        error_exit(CURRENT_C, "DROPOUT_RATE:INVALID");
+
+    const uint16_t vector_len = vector->Vector_t.len;
+
+    uint32_t mask_randoms[MAX_VECTOR_LEN];
+    Random_Fill_U32(key, stream, 0, mask_randoms, vector_len);
+
+    const uint32_t keep_threshold = network_dropout_threshold(dropout_rate);
+    const double keep_scale = 1.0 / (1.0 - dropout_rate);
+
+    for(uint16_t i = 0; i < vector_len; i++)
+    {
+        vector->Vector_t.Vector[i] = (mask_randoms[i] < keep_threshold) ? 
+                                     (vector->Vector_t.Vector[i] * keep_scale) : (0.0);
+    }
+
+    return;
+}//end Dropout_Apply.
 
 
 /*
@@ -676,9 +2929,8 @@ double *GradientDescent(Type_t *vector)
  */
 void ApplyBiases(Type_t *biases, Type_t *vector, uint8_t current_idx)
 {
-    // Error handler.
-    if(vector == NULL || biases == NULL)
-        error_exit("CURRENT_C", "VECTOR:NULL || BIASES:NULL");
+    // Unchecked: The layers are validated once, when the network is built.
+    ANN_ASSERT( (vector != NULL) && (biases != NULL), "VECTOR:NULL || BIASES:NULL");
     
     for(uint16_t i = 0; i < vector->Vector_t.len; i++)  
     {  
@@ -695,11 +2947,26 @@ void ApplyBiases(Type_t *biases, Type_t *vector, uint8_t current_idx)
  * @param network_topology 
  */
 void network_topology_validity(Network_Topology_t *network_topology)
+{
+    const ANN_Status_t status = Check_Network_Topology(network_topology);
+
+    if(status != ANN_OK)
+        error_exit(CURRENT_C, ANN_Status_Name(status));
+
+    return;
+}//end network_topology_validity.
+
+/**
+ * @brief Function to check a network topology without exiting.
+ * 
+ * @param network_topology 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Check_Network_Topology(Network_Topology_t *network_topology)
 {
     //Check if the passed newtork_topology is valid.
     if(network_topology == NULL)
-        error_exit(CURRENT_C, "NETWORK_TOPOLOGY:NULL");
-    // assert(network_topology != NULL); // For strictly exit.
+        return ANN_ERROR_NULL;
 
     // First check the layers.
     if((network_topology->input_layer_dense  <= 0) ||
@@ -707,48 +2974,155 @@ void network_topology_validity(Network_Topology_t *network_topology)
        (network_topology->output_layer_dense <= 0) ||
        (network_topology->hidden_layer_num   <= 1)
       )
-        error_exit(CURRENT_C, "NETWORK_TOPOLOGY_PARAMS:INVALID");
-
-    // assert(network_topology->input_layer_dense > 0);
-    // assert(network_topology->hidden_layer_dense > 0);
-    // assert(network_topology->output_layer_dense > 0);
-    // assert(hidden_layer_num > 0);
+        return ANN_ERROR_INVALID;
 
     // Check the restrections.
     if(network_topology->input_layer_dense  > MAX_INPUT_LAYER_DENSE)
-        error_exit(CURRENT_C, "INPUT_LAYER_DENSE:MAX_LIMIT");
-    // assert(network_topology->input_layer_dense < MAX_INPUT_LAYER_DENSE);
+        return ANN_ERROR_LIMIT;
 
     if(network_topology->hidden_layer_dense > MAX_HIDDEN_LAYER_DENSE)
-        error_exit(CURRENT_C, "HIDDEN_LAYER_DENSE:MAX_LIMIT");
-    // assert(network_topology->hidden_layer_dense < MAX_HIDDEN_LAYER_DENSE);
+        return ANN_ERROR_LIMIT;
 
     if(network_topology->output_layer_dense > MAX_OUTPUT_LAYER_DENSE)
-        error_exit(CURRENT_C, "OUTPUT_LAYER_DENSE:MAX_LIMIT");
-    // assert(network_topology->outputlayer_dense < MAX_OUTPUT_LAYER_DENSE);
+        return ANN_ERROR_LIMIT;
 
     if(network_topology->hidden_layer_num   > MAX_HIDDEN_LAYER_NUM)
-        error_exit(CURRENT_C, "HIDDEN_LAYER_NUM:MAX_LIMIT");
-    // assert(network_topology->hidden_layer_num < MAX_HIDDEN_LAYER_NUM);
+        return ANN_ERROR_LIMIT;
+
+    // Check the activation kinds. (SoftMax: Output layer only)
+    if( (network_topology->activation >= ACTIVATIONS_NUM) || (network_topology->output_activation >= ACTIVATIONS_NUM) ||
+        (network_topology->activation == ACTIVATION_SOFTMAX) || (network_topology->activation_alpha < 0.0) )
+        return ANN_ERROR_INVALID;
 
     // Check the functions pointer.
-    // Check the activation function pointer.
-    if(network_topology->activation_function == NULL)
-        error_exit(CURRENT_C, "NETWORK_TOPOLOGY_AF:NULL");
-    // assert(network_topology->activation_function != NULL);
+    // Check the activation function pointer. (Custom activations only)
+    if( (network_topology->activation == ACTIVATION_CUSTOM) && (network_topology->activation_function == NULL) )
+        return ANN_ERROR_NULL;
+
+    // Check the output activation function pointer.
+    if( (network_topology->output_activation == ACTIVATION_CUSTOM) && (network_topology->output_activation_function == NULL) )
+        return ANN_ERROR_NULL;
 
     // Check the loss function pointer.
     if(network_topology->loss_function == NULL)
-        error_exit(CURRENT_C, "NETWORK_TOPOLOGY_LF:NULL");
-    // assert(network_topology->loss_function != NULL);
+        return ANN_ERROR_NULL;
 
     // Check the optimizer function pointer.
     if(network_topology->optimizer_function == NULL)
-        error_exit(CURRENT_C, "NETWORK_TOPOLOGY_OF:NULL");
-    // assert(network_topology->optimizer_function != NULL);
+        return ANN_ERROR_NULL;
 
-    return;
-}//end network_topology_validity.
+    return ANN_OK;
+}//end Check_Network_Topology.
+
+/**
+ * @brief Function to check a network config without exiting. (NULL: The general config)
+ * 
+ * @param network_config 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Check_Network_Config(Network_Config_t *network_config)
+{
+    if(network_config == NULL)
+        return ANN_OK;
+
+    if( (isfinite(network_config->learning_rate) == false) || (network_config->learning_rate < 0.0) )
+        return ANN_ERROR_INVALID;
+
+    // (NaN included)
+    if( !((network_config->dropout_rate >= 0.0) && (network_config->dropout_rate < 1.0)) )
+        return ANN_ERROR_INVALID;
+
+    if( (network_config->weight_init > INIT_HE_NORMAL) || (network_config->output_weight_init > INIT_HE_NORMAL) )
+        return ANN_ERROR_INVALID;
+
+    return ANN_OK;
+}//end Check_Network_Config.
+
+/**
+ * @brief Function to check that a network can be trained without exiting.
+ *          - The backward pass runs the drevatives of the library activations & of the MSE,
+ *            MAE, BCE & MCCE losses only. (Not of a custom activation, BC or MCC)
+ * 
+ * @param dnn_network 
+ * @return ANN_Status_t (ANN_ERROR_INVALID: No drevative)
+ */
+ANN_Status_t Check_Network_Training(DNN_Network *dnn_network)
+{
+    if( (dnn_network == NULL) || (dnn_network->network_topology == NULL) || (dnn_network->network_layers == NULL) )
+        return ANN_ERROR_NULL;
+
+    const Activation_Plan_t plan = dnn_network->network_layers->Activation_plan; // (Temporary variable for readbility).
+    double (*loss_function)(Type_t *, Type_t *) = dnn_network->network_topology->loss_function;
+
+    if( (plan.hidden == ACTIVATION_CUSTOM) || (plan.output == ACTIVATION_CUSTOM) )
+        return ANN_ERROR_INVALID;
+
+    if( (loss_function != &MSE) && (loss_function != &MAE) && (loss_function != &BCE) && (loss_function != &MCCE) )
+        return ANN_ERROR_INVALID;
+
+    return ANN_OK;
+}//end Check_Network_Training.
+
+/**
+ * @brief Function to check the shapes of all the layers of a network without exiting.
+ *          - Create_Network builds valid networks. Check again after replacing layers
+ *            (Set_Input, Set_Output) to keep the unchecked forward pass safe.
+ * 
+ * @param dnn_network 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Check_Network(DNN_Network *dnn_network)
+{
+    if( (dnn_network == NULL) || (dnn_network->network_topology == NULL) || (dnn_network->network_layers == NULL) )
+        return ANN_ERROR_NULL;
+
+    const ANN_Status_t topology_status = Check_Network_Topology(dnn_network->network_topology);
+
+    if(topology_status != ANN_OK)
+        return topology_status;
+
+    const uint16_t hidden_layers_num = dnn_network->network_topology->hidden_layer_num;
+
+    for(uint16_t layer = 0; layer <= hidden_layers_num; layer++)
+    {
+        Type_t *layer_input  = network_layer_input(dnn_network, layer);
+        Type_t *layer_output = network_layer_output(dnn_network, layer);
+        Type_t *layer_weights = dnn_network->network_layers->Layer_weights[layer].layer_weights;
+
+        const ANN_Status_t status = dotProduct_Check(layer_input, layer_weights);
+
+        if(status != ANN_OK)
+            return status;
+
+        if( (layer_output == NULL) || (layer_output->Vector_t.Vector == NULL) )
+            return ANN_ERROR_NULL;
+
+        if(layer_output->Vector_t.len != layer_weights->Matrix_t.row)
+            return ANN_ERROR_SHAPE;
+    }
+
+    // The bound input.
+    const Tensor_View_t *input_view = &dnn_network->network_layers->Input_layer->input_view;
+
+    if( (input_view->data != NULL) && (input_view->len != dnn_network->network_topology->input_layer_dense) )
+        return ANN_ERROR_SHAPE;
+
+    const Sparse_Vector_t *input_sparse = &dnn_network->network_layers->Input_layer->input_sparse;
+
+    if( (input_sparse->len != 0) && (input_sparse->len != dnn_network->network_topology->input_layer_dense) )
+        return ANN_ERROR_SHAPE;
+
+    // One bias per hidden layer.
+    Type_t *biases = dnn_network->network_layers->Layers_biases->layers_biases;
+
+    if( (biases == NULL) || (biases->Vector_t.Vector == NULL) )
+        return ANN_ERROR_NULL;
+
+    if(biases->Vector_t.len < hidden_layers_num)
+        return ANN_ERROR_SHAPE;
+
+    return ANN_OK;
+}//end Check_Network.
 
 
 /**
@@ -771,7 +3145,7 @@ void print_network(DNN_Network *myNetwork)
     printf("\n[>] Hidden Layer Num Layer Dense: %d", myNetwork->network_topology->hidden_layer_num);
     printf("\n[>] Output Layer Dense: %d", myNetwork->network_topology->output_layer_dense);
     printf("\n[>] Learning Rate: %lf", myNetwork->network_config->learning_rate);
-    printf("\n[>] Drop out: %d", myNetwork->network_config->dropout);
+    printf("\n[>] Drop out: %d (Rate: %lf)", myNetwork->network_config->dropout, myNetwork->network_config->dropout_rate);
     printf("\n[>] Number Of Epochs: %d", myNetwork->network_config->epochs);
     printf("\n");
     for(uint8_t i = 0; i < BORDER_NUM; i++)
@@ -0,0 +1,450 @@
+/**
+ * @file CACHE.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Inference results cache functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "CACHE.H"
+#define CURRENT_C "CACHE.C"
+
+/*
+    - Cache overview:
+        Key:   Hash(input bytes, model version). (A hit also compares the whole input)
+        Value: The output vector of the network for this input.
+
+        [Shard 0][Shard 1] .. [Shard 15]    <= The high bits of the key pick the shard.
+           |
+           +-- Buckets => Entries chains    <= The low bits pick the bucket.
+           +-- LRU list: head (most recent) .. tail (evicted first)
+
+    - Each shard has its own lock, so the threads only wait for the ones hitting the same
+      shard. The shards are created full size: No allocation after Cache_Create.
+
+    - Invalidation: The model version is part of the key. (Model_Version: A hash of the
+      weights) When the weights change, the old entries can't be hit anymore & are evicted
+      first as they age.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define CACHE_HASH_MULTIPLIER ((const uint64_t) 0x9E3779B97F4A7C15ull)
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to mix the bits of a 64 bits word. (SplitMix64 finalizer)
+ *
+ * @param x
+ * @return uint64_t
+ */
+static inline uint64_t cache_mix(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+
+    return x;
+}//end cache_mix.
+
+/**
+ * @brief Function to get the input & the output stored for an entry.
+ *
+ * @param cache
+ * @param shard
+ * @param entry
+ * @return double* [input_dense + output_dense]
+ */
+static inline double *cache_values(Cache_t *cache, Cache_Shard_t *shard, int32_t entry)
+{
+    return shard->values + ((size_t) entry * (cache->input_dense + cache->output_dense));
+}//end cache_values.
+
+/**
+ * @brief Function to unlink an entry from the LRU list.
+ *
+ * @param shard
+ * @param entry
+ */
+static inline void cache_lru_unlink(Cache_Shard_t *shard, int32_t entry)
+{
+    Cache_Entry_t *current = &shard->entries[entry];
+
+    if(current->lru_prev != CACHE_NO_ENTRY)
+        shard->entries[current->lru_prev].lru_next = current->lru_next;
+    else
+        shard->lru_head = current->lru_next;
+
+    if(current->lru_next != CACHE_NO_ENTRY)
+        shard->entries[current->lru_next].lru_prev = current->lru_prev;
+    else
+        shard->lru_tail = current->lru_prev;
+
+    return;
+}//end cache_lru_unlink.
+
+/**
+ * @brief Function to put an entry at the head (most recent) of the LRU list.
+ *
+ * @param shard
+ * @param entry
+ */
+static inline void cache_lru_push(Cache_Shard_t *shard, int32_t entry)
+{
+    Cache_Entry_t *current = &shard->entries[entry];
+
+    current->lru_prev = CACHE_NO_ENTRY;
+    current->lru_next = shard->lru_head;
+
+    if(shard->lru_head != CACHE_NO_ENTRY)
+        shard->entries[shard->lru_head].lru_prev = entry;
+    else
+        shard->lru_tail = entry;
+
+    shard->lru_head = entry;
+
+    return;
+}//end cache_lru_push.
+
+/**
+ * @brief Function to unlink an entry from its bucket chain.
+ *
+ * @param shard
+ * @param entry
+ */
+static void cache_chain_unlink(Cache_Shard_t *shard, int32_t entry)
+{
+    int32_t *link = &shard->buckets[shard->entries[entry].hash & shard->buckets_mask];
+
+    while(*link != entry)
+        link = &shard->entries[*link].chain_next;
+
+    *link = shard->entries[entry].chain_next;
+
+    return;
+}//end cache_chain_unlink.
+
+/**
+ * @brief Function to find the entry of an input. (Shard locked)
+ *
+ * @param cache
+ * @param shard
+ * @param hash
+ * @param version
+ * @param input
+ * @return int32_t (CACHE_NO_ENTRY: Not found)
+ */
+static int32_t cache_find(Cache_t *cache, Cache_Shard_t *shard, uint64_t hash, uint64_t version, const double *input)
+{
+    for(int32_t entry = shard->buckets[hash & shard->buckets_mask]; entry != CACHE_NO_ENTRY; entry = shard->entries[entry].chain_next)
+    {
+        if( (shard->entries[entry].hash == hash) && (shard->entries[entry].version == version) &&
+            (memcmp(cache_values(cache, shard, entry), input, sizeof(double) * cache->input_dense) == 0) )
+            return entry;
+    }
+
+    return CACHE_NO_ENTRY;
+}//end cache_find.
+
+/**
+ * @brief Function to empty a shard. (Shard locked)
+ *
+ * @param shard
+ */
+static void cache_shard_reset(Cache_Shard_t *shard)
+{
+    for(uint32_t b = 0; b <= shard->buckets_mask; b++)
+        shard->buckets[b] = CACHE_NO_ENTRY;
+
+    shard->used = 0;
+    shard->lru_head = CACHE_NO_ENTRY;
+    shard->lru_tail = CACHE_NO_ENTRY;
+
+    return;
+}//end cache_shard_reset.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to create an empty cache.
+ *
+ * @param entries The maximum number of results kept. (Spread over the shards)
+ * @param input_dense
+ * @param output_dense
+ * @return Cache_t* (Free it with Cache_Free)
+ */
+Cache_t *Cache_Create(uint32_t entries, uint16_t input_dense, uint16_t output_dense)
+{
+    // Error Handeling.
+    if( (entries == 0) || (input_dense == 0) || (output_dense == 0) )
+        error_exit(CURRENT_C, "CACHE_SIZE:INVALID");
+
+    Cache_t *cache = (Cache_t *) Memory_Calloc(sizeof(Cache_t), MEMORY_OTHER);
+
+    cache->input_dense  = input_dense;
+    cache->output_dense = output_dense;
+    cache->capacity     = (entries + CACHE_SHARDS - 1) / CACHE_SHARDS;
+
+    // Twice more buckets than entries: Short chains.
+    uint32_t buckets_num = 1;
+
+    while(buckets_num < 2 * cache->capacity)
+        buckets_num <<= 1;
+
+    for(uint16_t s = 0; s < CACHE_SHARDS; s++)
+    {
+        Cache_Shard_t *shard = &cache->shards[s];
+
+        pthread_mutex_init(&shard->lock, NULL);
+
+        shard->entries = (Cache_Entry_t *) Memory_Alloc(sizeof(Cache_Entry_t) * cache->capacity, MEMORY_OTHER);
+        shard->values  = (double *) Memory_Alloc(sizeof(double) * cache->capacity * (input_dense + output_dense), MEMORY_OTHER);
+        shard->buckets = (int32_t *) Memory_Alloc(sizeof(int32_t) * buckets_num, MEMORY_OTHER);
+        shard->buckets_mask = buckets_num - 1;
+
+        cache_shard_reset(shard);
+    }
+
+    return cache;
+}//end Cache_Create.
+
+/**
+ * @brief Function to free a cache. (No network may still use it)
+ *
+ * @param cache
+ */
+void Cache_Free(Cache_t *cache)
+{
+    if(cache == NULL)
+        return;
+
+    for(uint16_t s = 0; s < CACHE_SHARDS; s++)
+    {
+        pthread_mutex_destroy(&cache->shards[s].lock);
+        Memory_Free(cache->shards[s].entries);
+        Memory_Free(cache->shards[s].values);
+        Memory_Free(cache->shards[s].buckets);
+    }
+
+    Memory_Free(cache);
+
+    return;
+}//end Cache_Free.
+
+/**
+ * @brief Function to look the output of an input up.
+ *
+ * @param cache
+ * @param version The model version. (Model_Version)
+ * @param input  [input_dense]
+ * @param output [output_dense] (Written on a hit only)
+ * @return bool (true: Hit)
+ */
+bool Cache_Lookup(Cache_t *cache, uint64_t version, const double *input, double *output)
+{
+    const uint64_t hash = Cache_Hash(input, cache->input_dense, version);
+    Cache_Shard_t *shard = &cache->shards[(hash >> 60) & (CACHE_SHARDS - 1)];
+
+    pthread_mutex_lock(&shard->lock);
+
+    const int32_t entry = cache_find(cache, shard, hash, version, input);
+
+    if(entry != CACHE_NO_ENTRY)
+    {
+        memcpy(output, cache_values(cache, shard, entry) + cache->input_dense, sizeof(double) * cache->output_dense);
+
+        // Now the most recent.
+        cache_lru_unlink(shard, entry);
+        cache_lru_push(shard, entry);
+        shard->hits++;
+    }
+    else
+    {
+        shard->misses++;
+    }
+
+    pthread_mutex_unlock(&shard->lock);
+
+    return (entry != CACHE_NO_ENTRY);
+}//end Cache_Lookup.
+
+/**
+ * @brief Function to store the output of an input. (Evicts the least recently used entry of a full shard)
+ *
+ * @param cache
+ * @param version The model version. (Model_Version)
+ * @param input  [input_dense]
+ * @param output [output_dense]
+ */
+void Cache_Insert(Cache_t *cache, uint64_t version, const double *input, const double *output)
+{
+    const uint64_t hash = Cache_Hash(input, cache->input_dense, version);
+    Cache_Shard_t *shard = &cache->shards[(hash >> 60) & (CACHE_SHARDS - 1)];
+
+    pthread_mutex_lock(&shard->lock);
+
+    // Another thread stored it first.
+    if(cache_find(cache, shard, hash, version, input) != CACHE_NO_ENTRY)
+    {
+        pthread_mutex_unlock(&shard->lock);
+        return;
+    }
+
+    int32_t entry;
+
+    if(shard->used < cache->capacity)
+    {
+        entry = (int32_t) shard->used++;
+    }
+    else
+    {
+        entry = shard->lru_tail;
+
+        cache_lru_unlink(shard, entry);
+        cache_chain_unlink(shard, entry);
+        shard->evictions++;
+    }
+
+    double *values = cache_values(cache, shard, entry);
+
+    memcpy(values, input, sizeof(double) * cache->input_dense);
+    memcpy(values + cache->input_dense, output, sizeof(double) * cache->output_dense);
+
+    shard->entries[entry].hash    = hash;
+    shard->entries[entry].version = version;
+    shard->entries[entry].chain_next = shard->buckets[hash & shard->buckets_mask];
+    shard->buckets[hash & shard->buckets_mask] = entry;
+
+    cache_lru_push(shard, entry);
+    shard->insertions++;
+
+    pthread_mutex_unlock(&shard->lock);
+
+    return;
+}//end Cache_Insert.
+
+/**
+ * @brief Function to drop all the entries. (The counters are kept)
+ *
+ * @param cache
+ */
+void Cache_Clear(Cache_t *cache)
+{
+    // Error Handeling.
+    if(cache == NULL)
+        error_exit(CURRENT_C, "CACHE:NULL");
+
+    for(uint16_t s = 0; s < CACHE_SHARDS; s++)
+    {
+        pthread_mutex_lock(&cache->shards[s].lock);
+        cache_shard_reset(&cache->shards[s]);
+        pthread_mutex_unlock(&cache->shards[s].lock);
+    }
+
+    return;
+}//end Cache_Clear.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to hash an input vector & a model version.
+ *          - Hashes the bytes: -0.0 & 0.0 are different inputs.
+ *
+ * @param input [len]
+ * @param len
+ * @param version
+ * @return uint64_t
+ */
+uint64_t Cache_Hash(const double *input, uint16_t len, uint64_t version)
+{
+    uint64_t hash = cache_mix(version ^ ((uint64_t) len * CACHE_HASH_MULTIPLIER));
+
+    for(uint16_t i = 0; i < len; i++)
+    {
+        uint64_t word;
+        memcpy(&word, &input[i], sizeof(uint64_t));
+
+        hash = (hash ^ word) * CACHE_HASH_MULTIPLIER;
+        hash ^= hash >> 29;
+    }
+
+    return cache_mix(hash);
+}//end Cache_Hash.
+
+/**
+ * @brief Function to get the counters of a cache.
+ *
+ * @param cache
+ * @param report
+ */
+void Cache_Get_Report(Cache_t *cache, Cache_Report_t *report)
+{
+    // Error Handeling.
+    if( (cache == NULL) || (report == NULL) )
+        error_exit(CURRENT_C, "CACHE_REPORT:NULL");
+
+    memset(report, 0, sizeof(Cache_Report_t));
+
+    for(uint16_t s = 0; s < CACHE_SHARDS; s++)
+    {
+        Cache_Shard_t *shard = &cache->shards[s];
+
+        pthread_mutex_lock(&shard->lock);
+        report->hits       += shard->hits;
+        report->misses     += shard->misses;
+        report->insertions += shard->insertions;
+        report->evictions  += shard->evictions;
+        report->entries    += shard->used;
+        pthread_mutex_unlock(&shard->lock);
+    }
+
+    report->capacity = (uint64_t) cache->capacity * CACHE_SHARDS;
+    report->hit_rate = ((report->hits + report->misses) > 0) ? ((double) report->hits / (report->hits + report->misses)) : (0.0);
+
+    return;
+}//end Cache_Get_Report.
+
+/**
+ * @brief Function to print the counters of a cache.
+ *
+ * @param cache
+ */
+void print_cache_report(Cache_t *cache)
+{
+    Cache_Report_t report;
+
+    Cache_Get_Report(cache, &report);
+
+    printf("\nCACHE: %llu/%llu entries, HITS: %llu, MISSES: %llu (%.1f%% hit rate), INSERTIONS: %llu, EVICTIONS: %llu\n",
+           (unsigned long long) report.entries, (unsigned long long) report.capacity,
+           (unsigned long long) report.hits, (unsigned long long) report.misses, 100.0 * report.hit_rate,
+           (unsigned long long) report.insertions, (unsigned long long) report.evictions);
+
+    return;
+}//end print_cache_report.
+
+//!=============================> .END
@@ -0,0 +1,861 @@
+/**
+ * @file DATASET.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Training dataset streaming functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "DATASET.H"
+#define CURRENT_C "DATASET.C"
+
+/*
+    - Streaming overview:
+        The dataset file is never loaded as a whole. Samples are read in (DATASET_CHUNK_SIZE)
+        chunks and parsed straight into one of two batch buffers by a background I/O thread,
+        while the training loop works on the other buffer.
+
+    - Double buffer states:
+        [EMPTY] --(I/O thread fills)--> [FILLED] --(Dataset_Next_Batch)--> [HELD]
+        [HELD]  --(next Dataset_Next_Batch call)--> [EMPTY]
+
+    - Mapped overview:
+        The binary file is mapped read only & the batches are row pointers into the mapping,
+        so nothing is parsed or copied. The page cache holds one copy of the file for all
+        the processes training on it.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to read the next (batch_size) samples from the file into a batch.
+ *
+ * @param stream
+ * @param batch
+ * @param status ANN_ERROR_IO: A read error or a truncated last row, ANN_ERROR_INVALID: A
+ *               malformed CSV line. (The batch is dropped)
+ * @return uint16_t The number of samples read. (0 at end of file)
+ */
+static uint16_t dataset_fill_batch(Dataset_Stream_t *stream, Dataset_Batch_t *batch, ANN_Status_t *status)
+{
+    uint16_t samples = 0;
+
+    *status = ANN_OK;
+
+    if(stream->format == DATASET_FORMAT_BINARY)
+    {
+        // Read the whole batch as one chunk then scatter the rows. (Bytes: A truncated row shows)
+        const size_t row_bytes  = sizeof(double) * stream->row_stride;
+        const size_t bytes_read = fread(stream->staging_buffer, 1, row_bytes * stream->batch_size, stream->file);
+        const size_t rows_read  = bytes_read / row_bytes;
+
+        if( ((bytes_read % row_bytes) != 0) || (ferror(stream->file) != 0) )
+        {
+            *status = ANN_ERROR_IO;
+            return 0;
+        }
+
+        for(samples = 0; samples < rows_read; samples++)
+        {
+            const double *row = &stream->staging_buffer[(size_t) samples * stream->row_stride];
+
+            memcpy(batch->inputs->Matrix_t.Matrix[samples], row,
+                   sizeof(double) * stream->input_dense);
+            memcpy(batch->outputs->Matrix_t.Matrix[samples], &row[stream->input_dense],
+                   sizeof(double) * stream->output_dense);
+        }
+    }
+    else
+    {
+        double *row = stream->staging_buffer;
+
+        while(samples < stream->batch_size)
+        {
+            if(fgets(stream->line_buffer, DATASET_LINE_MAX, stream->file) == NULL)
+            {
+                if(ferror(stream->file) != 0)
+                {
+                    *status = ANN_ERROR_IO;
+                    return 0;
+                }
+
+                break;
+            }
+
+            // Skip the empty & the comment lines.
+            if(stream->line_buffer[0] == '\n' || stream->line_buffer[0] == '\r' || stream->line_buffer[0] == '#')
+                continue;
+
+            if(dataset_parse_csv_line(stream->line_buffer, row, stream->row_stride) == false)
+            {
+                *status = ANN_ERROR_INVALID;
+                return 0;
+            }
+
+            memcpy(batch->inputs->Matrix_t.Matrix[samples], row,
+                   sizeof(double) * stream->input_dense);
+            memcpy(batch->outputs->Matrix_t.Matrix[samples], &row[stream->input_dense],
+                   sizeof(double) * stream->output_dense);
+
+            samples++;
+        }
+    }
+
+    batch->size = samples;
+
+    return samples;
+}//end dataset_fill_batch.
+
+/**
+ * @brief Function to seek the stream back to its first sample.
+ *
+ * @param stream
+ * @return bool False if the seek failed.
+ */
+static bool dataset_seek_start(Dataset_Stream_t *stream)
+{
+    clearerr(stream->file);
+
+    return (fseek(stream->file, stream->data_offset, SEEK_SET) == 0);
+}//end dataset_seek_start.
+
+/**
+ * @brief The background I/O thread. Keeps the next batch buffer filled.
+ *
+ * @param arg The owning Dataset_Stream_t.
+ * @return void*
+ */
+static void *dataset_prefetch_worker(void *arg)
+{
+    Dataset_Stream_t *stream = (Dataset_Stream_t *) arg;
+
+    Trace_Thread_Name("dataset_prefetch");
+
+    pthread_mutex_lock(&stream->lock);
+
+    while(stream->stop == false)
+    {
+        // Restart from the first sample if the training loop asked for it.
+        if(stream->rewind == true)
+        {
+            stream->status = (dataset_seek_start(stream)) ? (ANN_OK) : (ANN_ERROR_IO);
+
+            stream->filled[0] = false;
+            stream->filled[1] = false;
+            stream->fill_idx  = 0;
+            stream->eof       = (stream->status != ANN_OK);
+            stream->rewind    = false;
+
+            pthread_cond_broadcast(&stream->filled_cond);
+            continue;
+        }
+
+        // Sleep while the next buffer is still in use or there is nothing left to read.
+        if( (stream->filled[stream->fill_idx] == true) || (stream->eof == true) )
+        {
+            pthread_cond_wait(&stream->empty_cond, &stream->lock);
+            continue;
+        }
+
+        // Fill the free buffer without holding the lock.
+        const uint8_t fill_idx = stream->fill_idx;
+        pthread_mutex_unlock(&stream->lock);
+
+        ANN_Status_t fill_status;
+
+        TRACE_BEGIN("prefetch", TRACE_CAT_DATA);
+        const uint16_t samples = dataset_fill_batch(stream, &stream->batches[fill_idx], &fill_status);
+        TRACE_END("prefetch", TRACE_CAT_DATA);
+
+        pthread_mutex_lock(&stream->lock);
+
+        // A rewind requested while filling makes this batch stale.
+        if(stream->rewind == true)
+            continue;
+
+        // The stream ends on its first error: The training loop gets it after the filled batches.
+        if(fill_status != ANN_OK)
+        {
+            stream->status = fill_status;
+            stream->eof = true;
+        }
+        else if(samples == 0)
+        {
+            stream->eof = true;
+        }
+        else
+        {
+            stream->filled[fill_idx] = true;
+            stream->fill_idx ^= 1;
+
+            // A short batch is always the last one.
+            if(samples < stream->batch_size)
+                stream->eof = true;
+        }
+
+        pthread_cond_broadcast(&stream->filled_cond);
+    }
+
+    pthread_mutex_unlock(&stream->lock);
+
+    return NULL;
+}//end dataset_prefetch_worker.
+
+/**
+ * @brief Function to hint the kernel about the coming access pattern of the mapping.
+ *
+ * @param map
+ * @param first_sample The first sample of the coming range.
+ * @param samples_num  The number of samples in the coming range.
+ */
+static void dataset_map_advise(Dataset_Map_t *map, uint64_t first_sample, uint64_t samples_num)
+{
+#ifndef _WIN32
+    if(map->shuffled == true)
+    {
+        madvise(map->mapping, map->mapping_size, MADV_RANDOM);
+        return;
+    }
+
+    // Sequential order: Ask for the pages of the next batch ahead of time.
+    const long page_size = sysconf(_SC_PAGESIZE);
+
+    const uintptr_t range_start = (uintptr_t) (map->samples + (first_sample * map->row_stride));
+    const uintptr_t range_end   = (uintptr_t) (map->samples + ((first_sample + samples_num) * map->row_stride));
+    const uintptr_t page_start  = range_start & ~((uintptr_t) page_size - 1);
+
+    if(range_end > page_start)
+        madvise((void *) page_start, range_end - page_start, MADV_WILLNEED);
+#else
+    (void) map; (void) first_sample; (void) samples_num;
+#endif
+
+    return;
+}//end dataset_map_advise.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to open a dataset file & start prefetching its first batches.
+ *          - The file rows are (input_dense) inputs followed by (output_dense) desired outputs.
+ *
+ * @param path
+ * @param format
+ * @param input_dense
+ * @param output_dense
+ * @param batch_size
+ * @return Dataset_Stream_t*
+ */
+Dataset_Stream_t *Dataset_Open_Stream(const char *path, Dataset_Format_t format,
+                                      uint16_t input_dense, uint16_t output_dense, uint16_t batch_size)
+{
+    // Error Handler.
+    if(path == NULL)
+        error_exit(CURRENT_C, "DATASET_PATH:NULL");
+
+    if( (input_dense <= 0) || (output_dense <= 0) || (batch_size <= 0) )
+        error_exit(CURRENT_C, "DATASET_PARAMS:INVALID");
+
+    if( (input_dense > MAX_MATRIX_COL) || (output_dense > MAX_MATRIX_COL) || (batch_size > MAX_MATRIX_ROW) )
+        error_exit(CURRENT_C, "DATASET_PARAMS:MAX_LIMIT");
+
+    // Create the stream struct in heap.
+    Dataset_Stream_t *new_stream = (Dataset_Stream_t *) Memory_Calloc(sizeof(Dataset_Stream_t), MEMORY_DATASET);
+
+    new_stream->format       = format;
+    new_stream->input_dense  = input_dense;
+    new_stream->output_dense = output_dense;
+    new_stream->row_stride   = input_dense + output_dense;
+    new_stream->batch_size   = batch_size;
+
+    // Open the file & give it a chunk sized buffer.
+    new_stream->file = fopen(path, (format == DATASET_FORMAT_BINARY) ? "rb" : "r");
+
+    if(new_stream->file == NULL)
+        error_exit(CURRENT_C, "DATASET_FILE:OPEN_FAILED");
+
+    new_stream->chunk_buffer = (char *) Memory_Alloc(DATASET_CHUNK_SIZE, MEMORY_DATASET);
+
+    setvbuf(new_stream->file, new_stream->chunk_buffer, _IOFBF, DATASET_CHUNK_SIZE);
+
+    if(format == DATASET_FORMAT_BINARY)
+    {
+        // Check the binary header against the requested dense.
+        Dataset_Header_t header;
+
+        if(fread(&header, sizeof(Dataset_Header_t), 1, new_stream->file) != 1)
+            error_exit(CURRENT_C, "DATASET_HEADER:READ_FAILED");
+
+        if(memcmp(header.magic, DATASET_BINARY_MAGIC, sizeof(header.magic)) != 0 ||
+           header.version != DATASET_BINARY_VERSION)
+            error_exit(CURRENT_C, "DATASET_HEADER:INVALID");
+
+        if( (header.input_dense != input_dense) || (header.output_dense != output_dense) ||
+            (header.row_stride < (input_dense + output_dense)) )
+            error_exit(CURRENT_C, "DATASET_HEADER_DENSE:INVALID");
+
+        new_stream->row_stride = header.row_stride;
+    }
+    else
+    {
+        new_stream->line_buffer = (char *) Memory_Alloc(DATASET_LINE_MAX, MEMORY_DATASET);
+    }
+
+    new_stream->data_offset = ftell(new_stream->file);
+
+    // Skip a non numeric (header) first line of a CSV file.
+    if(format == DATASET_FORMAT_CSV)
+    {
+        double *first_row = (double *) Memory_Alloc(sizeof(double) * new_stream->row_stride, MEMORY_DATASET);
+
+        if( (fgets(new_stream->line_buffer, DATASET_LINE_MAX, new_stream->file) != NULL) &&
+            (dataset_parse_csv_line(new_stream->line_buffer, first_row, new_stream->row_stride) == false) )
+            new_stream->data_offset = ftell(new_stream->file);
+
+        Memory_Free(first_row);
+
+        if(dataset_seek_start(new_stream) == false)
+            error_exit(CURRENT_C, "DATASET_FILE:SEEK_FAILED");
+    }
+
+    // Staging buffer: One batch of raw rows (binary) or one parsed row (csv).
+    const size_t staging_rows = (format == DATASET_FORMAT_BINARY) ? batch_size : 1;
+    new_stream->staging_buffer = (double *) Memory_Alloc(sizeof(double) * new_stream->row_stride * staging_rows, MEMORY_DATASET);
+
+    // Create the two batch buffers. (Initalize: False)
+    for(uint8_t i = 0; i < 2; i++)
+    {
+        const Memory_Context_t previous_context = Memory_Enter(NULL, MEMORY_DATASET);
+        new_stream->batches[i].inputs  = create_matrix(batch_size, input_dense, false);
+        new_stream->batches[i].outputs = create_matrix(batch_size, output_dense, false);
+        Memory_Leave(previous_context);
+        new_stream->batches[i].size    = 0;
+    }
+
+    // Start the I/O thread.
+    pthread_mutex_init(&new_stream->lock, NULL);
+    pthread_cond_init(&new_stream->filled_cond, NULL);
+    pthread_cond_init(&new_stream->empty_cond, NULL);
+
+    if(pthread_create(&new_stream->worker, NULL, dataset_prefetch_worker, new_stream) != 0)
+        error_exit(CURRENT_C, "DATASET_THREAD:CREATE_FAILED");
+
+    return new_stream;
+}//end Dataset_Open_Stream.
+
+/**
+ * @brief Function to get the next prefetched batch.
+ *          - The returned batch stays valid until the next call. Calling again hands it back
+ *            to the I/O thread to be refilled.
+ *          - A file error ends the stream like its end: Use Dataset_Next_Batch_Checked to tell
+ *            them apart.
+ *
+ * @param stream
+ * @return Dataset_Batch_t* The next batch or NULL at the end of the dataset.
+ */
+Dataset_Batch_t *Dataset_Next_Batch(Dataset_Stream_t *stream)
+{
+    // Error Handler.
+    if(stream == NULL)
+        error_exit(CURRENT_C, "DATASET_STREAM:NULL");
+
+    Dataset_Batch_t *next_batch = NULL;
+
+    Dataset_Next_Batch_Checked(stream, &next_batch);
+
+    return next_batch;
+}//end Dataset_Next_Batch.
+
+/**
+ * @brief Function to get the next prefetched batch, or the error that ended the stream.
+ *          - The batches read before an error are returned first. Dataset_Rewind clears the
+ *            error. (The same line fails again)
+ *
+ * @param stream
+ * @param batch The next batch. (NULL: The end of the dataset or an error)
+ * @return ANN_Status_t (ANN_ERROR_IO: A read error or a truncated binary row, ANN_ERROR_INVALID:
+ *         A malformed CSV line)
+ */
+ANN_Status_t Dataset_Next_Batch_Checked(Dataset_Stream_t *stream, Dataset_Batch_t **batch)
+{
+    // Error Handeling.
+    if( (stream == NULL) || (batch == NULL) )
+        return ANN_ERROR_NULL;
+
+    Dataset_Batch_t *next_batch = NULL;
+    ANN_Status_t status = ANN_OK;
+
+    pthread_mutex_lock(&stream->lock);
+
+    // Give the previous batch back to the I/O thread.
+    if(stream->holding == true)
+    {
+        stream->filled[stream->held_idx] = false;
+        stream->holding = false;
+        pthread_cond_signal(&stream->empty_cond);
+    }
+
+    // Wait for the I/O thread. (Only stalls if parsing is slower than training)
+    if( (stream->filled[stream->consume_idx] == false) && (stream->eof == false) )
+    {
+        TRACE_BEGIN("dataset_wait", TRACE_CAT_DATA);
+
+        while( (stream->filled[stream->consume_idx] == false) && (stream->eof == false) )
+            pthread_cond_wait(&stream->filled_cond, &stream->lock);
+
+        TRACE_END("dataset_wait", TRACE_CAT_DATA);
+    }
+
+    if(stream->filled[stream->consume_idx] == true)
+    {
+        next_batch = &stream->batches[stream->consume_idx];
+
+        stream->holding  = true;
+        stream->held_idx = stream->consume_idx;
+        stream->consume_idx ^= 1;
+    }
+    else
+    {
+        status = stream->status;
+    }
+
+    pthread_mutex_unlock(&stream->lock);
+
+    *batch = next_batch;
+
+    return status;
+}//end Dataset_Next_Batch_Checked.
+
+/**
+ * @brief Function to restart the stream from its first sample. (New epoch)
+ *
+ * @param stream
+ */
+void Dataset_Rewind(Dataset_Stream_t *stream)
+{
+    // Error Handler.
+    if(stream == NULL)
+        error_exit(CURRENT_C, "DATASET_STREAM:NULL");
+
+    pthread_mutex_lock(&stream->lock);
+
+    stream->holding     = false;
+    stream->consume_idx = 0;
+    stream->rewind      = true;
+    pthread_cond_signal(&stream->empty_cond);
+
+    // Wait until the I/O thread seeked back.
+    while(stream->rewind == true)
+        pthread_cond_wait(&stream->filled_cond, &stream->lock);
+
+    pthread_mutex_unlock(&stream->lock);
+
+    return;
+}//end Dataset_Rewind.
+
+/**
+ * @brief Function to stop the I/O thread & free the stream.
+ *
+ * @param stream
+ */
+void Dataset_Close_Stream(Dataset_Stream_t *stream)
+{
+    // Error Handler.
+    if(stream == NULL)
+        error_exit(CURRENT_C, "DATASET_STREAM:NULL");
+
+    // Stop & join the I/O thread.
+    pthread_mutex_lock(&stream->lock);
+    stream->stop = true;
+    pthread_cond_signal(&stream->empty_cond);
+    pthread_mutex_unlock(&stream->lock);
+
+    pthread_join(stream->worker, NULL);
+
+    pthread_cond_destroy(&stream->empty_cond);
+    pthread_cond_destroy(&stream->filled_cond);
+    pthread_mutex_destroy(&stream->lock);
+
+    // Free the buffers.
+    for(uint8_t i = 0; i < 2; i++)
+    {
+        free_matrix(stream->batches[i].inputs);
+        free_matrix(stream->batches[i].outputs);
+    }
+
+    fclose(stream->file);
+
+    Memory_Free(stream->chunk_buffer);
+    Memory_Free(stream->staging_buffer);
+    Memory_Free(stream->line_buffer);
+    Memory_Free(stream);
+
+    return;
+}//end Dataset_Close_Stream.
+
+/**
+ * @brief Function to open a binary dataset as a memory mapped (out-of-core) dataset.
+ *          - The dense are read from the file header.
+ *
+ * @param path
+ * @param batch_size
+ * @return Dataset_Map_t*
+ */
+Dataset_Map_t *Dataset_Open_Map(const char *path, uint16_t batch_size)
+{
+    // Error Handler.
+    if(path == NULL)
+        error_exit(CURRENT_C, "DATASET_PATH:NULL");
+
+    if( (batch_size <= 0) || (batch_size > MAX_MATRIX_ROW) )
+        error_exit(CURRENT_C, "DATASET_BATCH_SIZE:INVALID");
+
+    // Create the map struct in heap.
+    Dataset_Map_t *new_map = (Dataset_Map_t *) Memory_Calloc(sizeof(Dataset_Map_t), MEMORY_DATASET);
+
+    // Map the whole file read only.
+#ifdef _WIN32
+    new_map->file_handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if(new_map->file_handle == INVALID_HANDLE_VALUE)
+        error_exit(CURRENT_C, "DATASET_FILE:OPEN_FAILED");
+
+    LARGE_INTEGER file_size;
+    GetFileSizeEx(new_map->file_handle, &file_size);
+    new_map->mapping_size = (size_t) file_size.QuadPart;
+
+    if(new_map->mapping_size < sizeof(Dataset_Header_t))
+        error_exit(CURRENT_C, "DATASET_HEADER:INVALID");
+
+    new_map->mapping_handle = CreateFileMappingA(new_map->file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if(new_map->mapping_handle == NULL)
+        error_exit(CURRENT_C, "DATASET_FILE:MAP_FAILED");
+
+    new_map->mapping = MapViewOfFile(new_map->mapping_handle, FILE_MAP_READ, 0, 0, 0);
+
+    if(new_map->mapping == NULL)
+        error_exit(CURRENT_C, "DATASET_FILE:MAP_FAILED");
+#else
+    new_map->file_descriptor = open(path, O_RDONLY);
+
+    if(new_map->file_descriptor < 0)
+        error_exit(CURRENT_C, "DATASET_FILE:OPEN_FAILED");
+
+    struct stat file_stat;
+
+    if(fstat(new_map->file_descriptor, &file_stat) != 0)
+        error_exit(CURRENT_C, "DATASET_FILE:STAT_FAILED");
+
+    new_map->mapping_size = (size_t) file_stat.st_size;
+
+    if(new_map->mapping_size < sizeof(Dataset_Header_t))
+        error_exit(CURRENT_C, "DATASET_HEADER:INVALID");
+
+    new_map->mapping = mmap(NULL, new_map->mapping_size, PROT_READ, MAP_SHARED, new_map->file_descriptor, 0);
+
+    if(new_map->mapping == MAP_FAILED)
+        error_exit(CURRENT_C, "DATASET_FILE:MAP_FAILED");
+#endif
+
+    // Check the header.
+    const Dataset_Header_t *header = (const Dataset_Header_t *) new_map->mapping;
+
+    if(memcmp(header->magic, DATASET_BINARY_MAGIC, sizeof(header->magic)) != 0 ||
+       header->version != DATASET_BINARY_VERSION)
+        error_exit(CURRENT_C, "DATASET_HEADER:INVALID");
+
+    if( (header->input_dense <= 0) || (header->output_dense <= 0) ||
+        (header->input_dense > MAX_MATRIX_COL) || (header->output_dense > MAX_MATRIX_COL) ||
+        (header->row_stride < (header->input_dense + header->output_dense)) )
+        error_exit(CURRENT_C, "DATASET_HEADER_DENSE:INVALID");
+
+    if( (header->samples > UINT32_MAX) ||
+        (sizeof(Dataset_Header_t) + (header->samples * header->row_stride * sizeof(double)) > new_map->mapping_size) )
+        error_exit(CURRENT_C, "DATASET_HEADER_SAMPLES:INVALID");
+
+    new_map->samples      = (const double *) ((const uint8_t *) new_map->mapping + sizeof(Dataset_Header_t));
+    new_map->samples_num  = header->samples;
+    new_map->input_dense  = header->input_dense;
+    new_map->output_dense = header->output_dense;
+    new_map->row_stride   = header->row_stride;
+    new_map->batch_size   = batch_size;
+
+    // The visiting order. (Identity until shuffled)
+    new_map->order = (uint32_t *) Memory_Alloc(sizeof(uint32_t) * (new_map->samples_num ? new_map->samples_num : 1), MEMORY_DATASET);
+    new_map->input_rows  = (double **) Memory_Alloc(sizeof(double *) * batch_size, MEMORY_DATASET);
+    new_map->output_rows = (double **) Memory_Alloc(sizeof(double *) * batch_size, MEMORY_DATASET);
+
+    for(uint64_t i = 0; i < new_map->samples_num; i++)
+        new_map->order[i] = (uint32_t) i;
+
+    // Link the views to the row pointers.
+    new_map->input_view.Matrix_t.col     = new_map->input_dense;
+    new_map->input_view.Matrix_t.Matrix  = new_map->input_rows;
+    new_map->output_view.Matrix_t.col    = new_map->output_dense;
+    new_map->output_view.Matrix_t.Matrix = new_map->output_rows;
+
+    new_map->batch.inputs  = &new_map->input_view;
+    new_map->batch.outputs = &new_map->output_view;
+
+    dataset_map_advise(new_map, 0, batch_size);
+
+    return new_map;
+}//end Dataset_Open_Map.
+
+/**
+ * @brief Function to get the next batch of a mapped dataset.
+ *          - The batch rows point into the mapping. (Read only & valid until the next call)
+ *
+ * @param map
+ * @return Dataset_Batch_t* The next batch or NULL at the end of the epoch.
+ */
+Dataset_Batch_t *Dataset_Map_Next_Batch(Dataset_Map_t *map)
+{
+    // Error Handler.
+    if(map == NULL)
+        error_exit(CURRENT_C, "DATASET_MAP:NULL");
+
+    if(map->cursor >= map->samples_num)
+        return NULL;
+
+    const uint64_t remaining = map->samples_num - map->cursor;
+    const uint16_t samples = (remaining < map->batch_size) ? (uint16_t) remaining : map->batch_size;
+
+    // Point the views at the next samples.
+    for(uint16_t r = 0; r < samples; r++)
+    {
+        double *row = (double *) (map->samples + ((uint64_t) map->order[map->cursor + r] * map->row_stride));
+
+        map->input_rows[r]  = row;
+        map->output_rows[r] = row + map->input_dense;
+    }
+
+    map->input_view.Matrix_t.row  = (uint8_t) samples;
+    map->output_view.Matrix_t.row = (uint8_t) samples;
+    map->batch.size = samples;
+
+    map->cursor += samples;
+
+    dataset_map_advise(map, map->cursor, map->batch_size);
+
+    return &map->batch;
+}//end Dataset_Map_Next_Batch.
+
+/**
+ * @brief Function to shuffle the visiting order of a mapped dataset. (Fisher-Yates)
+ *          - Only the index array moves, the samples stay in place.
+ *          - Also rewinds the dataset.
+ *
+ * @param map
+ * @param seed The same seed gives the same order.
+ */
+void Dataset_Shuffle(Dataset_Map_t *map, uint64_t seed)
+{
+    // Error Handler.
+    if(map == NULL)
+        error_exit(CURRENT_C, "DATASET_MAP:NULL");
+
+    const uint64_t key = Random_Key(seed, 0);
+
+    for(uint64_t i = map->samples_num; i > 1; i--)
+    {
+        const uint64_t j = Random_U64(key, i) % i;
+
+        const uint32_t temporary = map->order[i - 1];
+        map->order[i - 1] = map->order[j];
+        map->order[j] = temporary;
+    }
+
+    map->shuffled = true;
+    map->cursor   = 0;
+
+    dataset_map_advise(map, 0, map->batch_size);
+
+    return;
+}//end Dataset_Shuffle.
+
+/**
+ * @brief Function to restart a mapped dataset from its first sample. (Same order)
+ *
+ * @param map
+ */
+void Dataset_Map_Rewind(Dataset_Map_t *map)
+{
+    // Error Handler.
+    if(map == NULL)
+        error_exit(CURRENT_C, "DATASET_MAP:NULL");
+
+    map->cursor = 0;
+
+    dataset_map_advise(map, 0, map->batch_size);
+
+    return;
+}//end Dataset_Map_Rewind.
+
+/**
+ * @brief Function to unmap & free a mapped dataset.
+ *
+ * @param map
+ */
+void Dataset_Close_Map(Dataset_Map_t *map)
+{
+    // Error Handler.
+    if(map == NULL)
+        error_exit(CURRENT_C, "DATASET_MAP:NULL");
+
+#ifdef _WIN32
+    UnmapViewOfFile(map->mapping);
+    CloseHandle(map->mapping_handle);
+    CloseHandle(map->file_handle);
+#else
+    munmap(map->mapping, map->mapping_size);
+    close(map->file_descriptor);
+#endif
+
+    Memory_Free(map->order);
+    Memory_Free(map->input_rows);
+    Memory_Free(map->output_rows);
+    Memory_Free(map);
+
+    return;
+}//end Dataset_Close_Map.
+
+/**
+ * @brief Function to convert a CSV dataset to the binary format.
+ *          - Streams line by line, so the CSV file may be larger than the memory.
+ *          - Aligned: Every row is padded to start on a cache line, so every column
+ *            sits at the same offset of its line. (Larger file, faster mapped batches)
+ *
+ * @param csv_path
+ * @param binary_path
+ * @param input_dense
+ * @param output_dense
+ * @param aligned
+ */
+void Dataset_CSV_To_Binary(const char *csv_path, const char *binary_path, uint16_t input_dense, uint16_t output_dense, bool aligned)
+{
+    // Error Handler.
+    if( (csv_path == NULL) || (binary_path == NULL) )
+        error_exit(CURRENT_C, "DATASET_PATH:NULL");
+
+    if( (input_dense <= 0) || (output_dense <= 0) )
+        error_exit(CURRENT_C, "DATASET_PARAMS:INVALID");
+
+    FILE *csv_file    = fopen(csv_path, "r");
+    FILE *binary_file = fopen(binary_path, "wb");
+
+    if( (csv_file == NULL) || (binary_file == NULL) )
+        error_exit(CURRENT_C, "DATASET_FILE:OPEN_FAILED");
+
+    const uint16_t values_num = input_dense + output_dense; // Temporary variable for readability.
+    const uint16_t row_stride = (aligned) ? 
+                                (((values_num + DATASET_ROW_ALIGN - 1) / DATASET_ROW_ALIGN) * DATASET_ROW_ALIGN) : 
+                                (values_num);
+
+    char   *line = (char *) Memory_Alloc(DATASET_LINE_MAX, MEMORY_DATASET);
+    double *row  = (double *) Memory_Calloc(sizeof(double) * row_stride, MEMORY_DATASET);
+
+    // Write a placeholder header. (The samples count is patched at the end)
+    Dataset_Header_t header;
+    memset(&header, 0, sizeof(Dataset_Header_t));
+    memcpy(header.magic, DATASET_BINARY_MAGIC, sizeof(header.magic));
+    header.version      = DATASET_BINARY_VERSION;
+    header.input_dense  = input_dense;
+    header.output_dense = output_dense;
+    header.row_stride   = row_stride;
+
+    fwrite(&header, sizeof(Dataset_Header_t), 1, binary_file);
+
+    uint64_t line_num = 0;
+
+    while(fgets(line, DATASET_LINE_MAX, csv_file) != NULL)
+    {
+        line_num++;
+
+        if(line[0] == '\n' || line[0] == '\r' || line[0] == '#')
+            continue;
+
+        if(dataset_parse_csv_line(line, row, values_num) == false)
+        {
+            // Only the first line may be a non numeric (header) line.
+            if(line_num == 1)
+                continue;
+
+            error_exit(CURRENT_C, "DATASET_CSV_LINE:INVALID");
+        }
+
+        if(fwrite(row, sizeof(double), row_stride, binary_file) != row_stride)
+            error_exit(CURRENT_C, "DATASET_FILE:WRITE_FAILED");
+
+        header.samples++;
+    }
+
+    // Patch the samples count.
+    fseek(binary_file, 0, SEEK_SET);
+    fwrite(&header, sizeof(Dataset_Header_t), 1, binary_file);
+
+    fclose(binary_file);
+    fclose(csv_file);
+    Memory_Free(line);
+    Memory_Free(row);
+
+    return;
+}//end Dataset_CSV_To_Binary.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to parse one CSV line of numbers. (Separators: ',' ';' ' ' '\t')
+ *
+ * @param line
+ * @param values
+ * @param values_num
+ * @return true  The line holds exactly (values_num) numbers.
+ * @return false Otherwise.
+ */
+bool dataset_parse_csv_line(char *line, double *values, uint16_t values_num)
+{
+    char *cursor = line;
+    char *end    = NULL;
+
+    for(uint16_t i = 0; i < values_num; i++)
+    {
+        // Skip the separators.
+        while(*cursor == ',' || *cursor == ';' || *cursor == ' ' || *cursor == '\t')
+            cursor++;
+
+        values[i] = strtod(cursor, &end);
+
+        if(end == cursor)
+            return false;
+
+        cursor = end;
+    }
+
+    // Nothing but separators may follow the last value.
+    while(*cursor == ',' || *cursor == ';' || *cursor == ' ' || *cursor == '\t' || *cursor == '\r' || *cursor == '\n')
+        cursor++;
+
+    return (*cursor == '\0');
+}//end dataset_parse_csv_line.
+
+//!=============================> .END
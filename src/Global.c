@@ -45,20 +45,15 @@ Type_t *create_vector(const uint16_t vector_len, bool init)
     if(vector_len > MAX_VECTOR_LEN)
         error_exit(CURRENT_C, "VECTOR_LEN:MAX_LEN_IMIT");
    
-    // Create vector in the heap.
-    Type_t *new_vector = (Type_t *) malloc(sizeof(Type_t));
-
-    if(new_vector == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    // Create vector in the heap. (Charged to the thread memory context)
+    const Memory_Category_t category = Memory_Current_Category();
+    Type_t *new_vector = (Type_t *) Memory_Alloc(sizeof(Type_t), category);
 
     // Modify the new vector parameters.
     // Vector length.
     new_vector->Vector_t.len = vector_len;
     // Vector array.
-    new_vector->Vector_t.Vector = (double *) malloc(sizeof(double) * new_vector->Vector_t.len);
-    
-    if(new_vector->Vector_t.Vector == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    new_vector->Vector_t.Vector = (double *) Memory_Alloc(sizeof(double) * new_vector->Vector_t.len, category);
 
     // Initialize the new vector.
     init ? 
@@ -97,10 +92,9 @@ Type_t *create_matrix(const uint16_t row, const uint16_t col, bool init)
         error_exit(CURRENT_C, "MATRIX_ROW_COL:MAX_LENGTH_LIMIT");
     // assert(row < MAX_MATRIX_ROW); assert(col < MAX_MATRIX_COL); // For strictly exit.
 
-    // Create the matrix struct
-    Type_t *new_matrix = (Type_t *) malloc(sizeof(Type_t));
-    if(new_matrix == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    // Create the matrix struct. (Charged to the thread memory context)
+    const Memory_Category_t category = Memory_Current_Category();
+    Type_t *new_matrix = (Type_t *) Memory_Alloc(sizeof(Type_t), category);
 
     // Set the matrix parameters.
     new_matrix->Matrix_t.row = row;
@@ -110,17 +104,13 @@ Type_t *create_matrix(const uint16_t row, const uint16_t col, bool init)
     //printf("\n row: %d", new_matrix->Matrix_t.row);
 
     // Allocating the 2d array in heap (matrix)
-    new_matrix->Matrix_t.Matrix = (double **) malloc(sizeof(double **) * new_matrix->Matrix_t.row);
-    if(new_matrix->Matrix_t.Matrix == NULL)
-        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    new_matrix->Matrix_t.Matrix = (double **) Memory_Alloc(sizeof(double *) * new_matrix->Matrix_t.row, category);
 
     // Start creating the links.
     for(uint16_t i = 0; i < new_matrix->Matrix_t.row; i++)
     {   
         // Allocating N Links (N=col).
-        new_matrix->Matrix_t.Matrix[i] = (double *) malloc(sizeof(double) * new_matrix->Matrix_t.col);
-        if(new_matrix->Matrix_t.Matrix[i] == NULL)
-            error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+        new_matrix->Matrix_t.Matrix[i] = (double *) Memory_Alloc(sizeof(double) * new_matrix->Matrix_t.col, category);
     }
 
     // Initalize the new matrix.
@@ -156,14 +146,8 @@ void vector_init(Type_t *vector)
         error_exit(CURRENT_C, "VECTOR_LEN:INVALID");
     // assert(vector->Vector_t.len > 0) // For strictly exit.
 
-    // Init the array.
-    if(private.randoming == true)
-        srand(GetTickCount());
-
-    for(uint16_t i = 0; i < vector->Vector_t.len; i++)
-    {
-        vector->Vector_t.Vector[i] = rand()%private.range * private.factor;
-    }
+    // Init the array. (The next stream of the thread seed: Init_Set_Seed, Init_Set_Stream)
+    Init_Vector(vector, INIT_DEFAULT, Init_Get_Seed(), Init_Next_Stream());
     
     return;
 }//end vector_init.
@@ -191,17 +175,8 @@ void matrix_init(Type_t *matrix)
         error_exit(CURRENT_C, "MATRIX_ROW_COL:INVALID");
     // assert(matrix->Matrix_t.row > 0); assert(matrix->Matrix_t.col > 0);  // For strictly exit.
 
-    // Init the matrix.
-    if(private.randoming == true)
-        srand(GetTickCount());
-
-    for(uint16_t i = 0; i < matrix->Matrix_t.row; i++)
-    {
-        for(uint16_t j = 0; j < matrix->Matrix_t.col ; j++)
-        {
-            matrix->Matrix_t.Matrix[i][j] = rand()%private.range * private.factor;
-        }
-    }
+    // Init the matrix. (The next stream of the thread seed: Init_Set_Seed, Init_Set_Stream)
+    Init_Matrix(matrix, INIT_DEFAULT, Init_Get_Seed(), Init_Next_Stream());
 
     return;
 }//end matrix_init.
@@ -309,9 +284,9 @@ void free_vector(Type_t *vector)
     // assert(vector->Vector_t.len > 0); // For strictly exit.
 
     // Free the vector.
-    free(vector->Vector_t.Vector);
+    Memory_Free(vector->Vector_t.Vector);
     // Free the struct.
-    free(vector);
+    Memory_Free(vector);
 
     // Indicator message.
     //printf("\n VECTOR_FREE: SUCCESSFUL\n");
@@ -346,13 +321,13 @@ void free_matrix(Type_t *matrix)
     for(uint16_t i = 0; i < matrix->Matrix_t.row; i++) 
     {
         // Free the mCOLS pointers.
-        free(matrix->Matrix_t.Matrix[i]);
+        Memory_Free(matrix->Matrix_t.Matrix[i]);
     }
     // Free the nROWS double pointers.
-    free(matrix->Matrix_t.Matrix);
+    Memory_Free(matrix->Matrix_t.Matrix);
 
     // Free the struct.
-    free(matrix);
+    Memory_Free(matrix);
 
     // Indicator message.
     //printf("\n MATRIX_FREE: SUCCESSFUL\n");
@@ -360,4 +335,124 @@ void free_matrix(Type_t *matrix)
     return;
 }//end free_matrix.
 
+/**
+ * @brief Function to get the number of hardware threads.
+ * 
+ * @return uint16_t 
+ */
+uint16_t get_threads_num(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    const long threads_num = (long) system_info.dwNumberOfProcessors;
+#else
+    const long threads_num = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return (threads_num > 0) ? ((uint16_t) threads_num) : (1);
+}//end get_threads_num.
+
+/**
+ * @brief Function to get the size of the L2 cache of a core.
+ * 
+ * @return size_t (DEFAULT_L2_CACHE_BYTES: The system doesn't report it)
+ */
+size_t get_l2_cache_bytes(void)
+{
+    size_t cache_bytes = 0;
+
+#ifdef _WIN32
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION processor_info[64];
+    DWORD info_bytes = sizeof(processor_info);
+
+    if(GetLogicalProcessorInformation(processor_info, &info_bytes))
+    {
+        for(DWORD i = 0; i < (info_bytes / sizeof(processor_info[0])); i++)
+        {
+            if( (processor_info[i].Relationship == RelationCache) && (processor_info[i].Cache.Level == 2) )
+                cache_bytes = (size_t) processor_info[i].Cache.Size;
+        }
+    }
+#elif defined(_SC_LEVEL2_CACHE_SIZE)
+    const long level2_bytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+
+    if(level2_bytes > 0)
+        cache_bytes = (size_t) level2_bytes;
+#endif
+
+    return (cache_bytes > 0) ? (cache_bytes) : (DEFAULT_L2_CACHE_BYTES);
+}//end get_l2_cache_bytes.
+
+/**
+ * @brief Function to get the model name of the CPU.
+ * 
+ * @param name [name_len] ("unknown": The system doesn't report it)
+ * @param name_len 
+ */
+void get_cpu_name(char *name, size_t name_len)
+{
+    // Error Handeling.
+    if( (name == NULL) || (name_len == 0) )
+        error_exit(CURRENT_C, "CPU_NAME:NULL");
+
+    name[0] = '\0';
+
+#ifdef _WIN32
+    DWORD name_bytes = (DWORD) name_len;
+
+    if(RegGetValueA(HKEY_LOCAL_MACHINE, "HARDWARE\\DESCRIPTION\\System\\CentralProcessor\\0", "ProcessorNameString",
+                    RRF_RT_REG_SZ, NULL, name, &name_bytes) != ERROR_SUCCESS)
+        name[0] = '\0';
+#else
+    FILE *cpu_info = fopen("/proc/cpuinfo", "r");
+
+    if(cpu_info != NULL)
+    {
+        char line[256];
+
+        while(fgets(line, sizeof(line), cpu_info) != NULL)
+        {
+            const char *value = strchr(line, ':');
+
+            if( (strncmp(line, "model name", strlen("model name")) != 0) || (value == NULL) )
+                continue;
+
+            // Skip ": " & drop the new line.
+            value += strspn(value + 1, " \t") + 1;
+            snprintf(name, name_len, "%.*s", (int) strcspn(value, "\r\n"), value);
+            break;
+        }
+
+        fclose(cpu_info);
+    }
+#endif
+
+    if(name[0] == '\0')
+        snprintf(name, name_len, "unknown");
+
+    return;
+}//end get_cpu_name.
+
+/**
+ * @brief Function to get the name of a status code.
+ * 
+ * @param status 
+ * @return const char* 
+ */
+const char *ANN_Status_Name(ANN_Status_t status)
+{
+    switch(status)
+    {
+        case ANN_OK:            return "OK";
+        case ANN_ERROR_NULL:    return "ERROR:NULL";
+        case ANN_ERROR_INVALID: return "ERROR:INVALID";
+        case ANN_ERROR_LIMIT:   return "ERROR:MAX_LIMIT";
+        case ANN_ERROR_SHAPE:   return "ERROR:SHAPE";
+        case ANN_ERROR_IO:      return "ERROR:IO";
+    }
+
+    return "ERROR:UNKNOWN";
+}//end ANN_Status_Name.
+
 //!=============================> .END
\ No newline at end of file
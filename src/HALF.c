@@ -0,0 +1,291 @@
+/**
+ * @file HALF.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief 16 bits weights storage functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "HALF.H"
+#define CURRENT_C "HALF.C"
+
+/*
+    - 16 bits weights overview:
+        Compress_Network rounds every weight to bfloat16 or to IEEE half & keeps them in one
+        contiguous [out x in] block per layer. The products widen them in the loop & sum in
+        double, so the passes read 2 bytes per weight instead of 8. (No calibration: Each
+        weight is rounded on its own)
+
+        bf16: The float range, 8 significant bits.   (Any weights)
+        fp16: |w| <= 65504, 11 significant bits.     (More precise for the usual weights)
+
+    - Widening a weight costs more than reading its 8 bytes from the cache: A small layer or a
+      single sample can run slower on the 16 bits weights. Like Sparsify_Network, each layer
+      times both kernels, for one sample & for a batch, and keeps the faster one of each path.
+
+    - The double weights are replaced by the rounded ones & kept: The trained, saved & cached
+      models are the compressed one, and the paths that kept the double kernel run on them.
+      The 16 bits copy adds a quarter of the double bytes. It belongs to that model version:
+      Once the weights change the double weights run until Compress_Network is called again.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to time the product of a layer. (The fastest of PRUNE_TIMING_ROUNDS rounds)
+ *
+ * @param weights The double weights.
+ * @param half    The 16 bits weights. (NULL: The double kernel)
+ * @param batch        [HALF_TIMING_ROWS x weights col]
+ * @param batch_result [HALF_TIMING_ROWS x weights row]
+ * @param batch_rows The rows of the batched product. (0: One sample, the first row)
+ * @return double The ns per product.
+ */
+static double half_time_kernel(Type_t *weights, const Half_Matrix_t *half, Type_t *batch, Type_t *batch_result, uint16_t batch_rows)
+{
+    Type_t vector = {.Vector_t = {.len = weights->Matrix_t.col, .Vector = batch->Matrix_t.Matrix[0]}};
+    double *output = batch_result->Matrix_t.Matrix[0];
+    uint64_t fastest = UINT64_MAX;
+
+    for(uint8_t round = 0; round < PRUNE_TIMING_ROUNDS; round++)
+    {
+        const uint64_t start = Profile_Now_Ns();
+
+        for(uint16_t run = 0; run < PRUNE_TIMING_RUNS; run++)
+        {
+            if(batch_rows == 0)
+            {
+                if(half == NULL)
+                    VxM_DotProduct_Unchecked(&vector, weights, output);
+                else
+                    VxHM_DotProduct_Unchecked(vector.Vector_t.Vector, half, output);
+            }
+            else
+            {
+                if(half == NULL)
+                    BxM_DotProduct_Unchecked(batch, weights, batch_result, batch_rows);
+                else
+                    BxHM_DotProduct_Unchecked(batch, half, batch_result, batch_rows);
+            }
+        }
+
+        const uint64_t elapsed = Profile_Now_Ns() - start;
+        fastest = (elapsed < fastest) ? (elapsed) : (fastest);
+    }
+
+    return (double) fastest / PRUNE_TIMING_RUNS;
+}//end half_time_kernel.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to store the weights of a network in a 16 bits format & to pick the kernel of
+ *        each layer, for one sample & for the batched passes.
+ *
+ * @param myNetwork
+ * @param format
+ * @return ANN_Status_t (ANN_ERROR_LIMIT: A weight past the fp16 range or NaN, nothing changed)
+ */
+ANN_Status_t Compress_Network(DNN_Network *myNetwork, Half_Format_t format)
+{
+    // Error Handeling.
+    if( (myNetwork == NULL) || (myNetwork->network_layers == NULL) )
+        return ANN_ERROR_NULL;
+
+    if( (format != HALF_FORMAT_BF16) && (format != HALF_FORMAT_FP16) )
+        return ANN_ERROR_INVALID;
+
+    Layer_t *layers = myNetwork->network_layers; // (Temporary variable for readbility).
+    const uint16_t layers_num = myNetwork->network_topology->hidden_layer_num + 1;
+
+    // Check the fp16 range first, NaN included. (Nothing is rounded on an error)
+    if(format == HALF_FORMAT_FP16)
+    {
+        for(uint16_t layer = 0; layer < layers_num; layer++)
+        {
+            Type_t *weights = layers->Layer_weights[layer].layer_weights;
+
+            for(uint16_t i = 0; i < weights->Matrix_t.row; i++)
+            {
+                for(uint16_t j = 0; j < weights->Matrix_t.col; j++)
+                {
+                    if( !(fabs(weights->Matrix_t.Matrix[i][j]) <= HALF_FP16_MAX) )
+                        return ANN_ERROR_LIMIT;
+                }
+            }
+        }
+    }
+
+    Free_Half_Weights(layers->Half_weights);
+    layers->Half_weights = NULL;
+
+    const Memory_Context_t previous_context = Memory_Enter(layers->Memory_stats, MEMORY_WEIGHTS);
+
+    Half_Weights_t *half_weights = (Half_Weights_t *) Memory_Alloc(sizeof(Half_Weights_t), MEMORY_WEIGHTS);
+    half_weights->format = format;
+    half_weights->layers_num = layers_num;
+    half_weights->layers = (Half_Layer_t *) Memory_Calloc(sizeof(Half_Layer_t) * layers_num, MEMORY_WEIGHTS);
+
+    Memory_Leave(previous_context);
+
+    // The timing batches. (Any values: The kernels don't depend on them)
+    Type_t *timing_batch  = create_matrix(HALF_TIMING_ROWS, MAX_MATRIX_COL, false);
+    Type_t *timing_result = create_matrix(HALF_TIMING_ROWS, MAX_MATRIX_ROW, false);
+
+    for(uint16_t r = 0; r < HALF_TIMING_ROWS; r++)
+    {
+        for(uint16_t j = 0; j < MAX_MATRIX_COL; j++)
+            timing_batch->Matrix_t.Matrix[r][j] = 1.0 / (r + j + 1);
+    }
+
+    Memory_Enter(layers->Memory_stats, MEMORY_WEIGHTS);
+
+    for(uint16_t layer = 0; layer < layers_num; layer++)
+    {
+        Type_t *weights = layers->Layer_weights[layer].layer_weights;
+        Half_Layer_t *half_layer = &half_weights->layers[layer];
+
+        half_layer->weights = Half_Matrix_Create(weights, format);
+
+        // Replace the weights by their rounded values.
+        double error = 0.0, total = 0.0;
+
+        for(uint16_t i = 0; i < weights->Matrix_t.row; i++)
+        {
+            for(uint16_t j = 0; j < weights->Matrix_t.col; j++)
+            {
+                const double weight  = weights->Matrix_t.Matrix[i][j];
+                const double rounded = Half_Decode(half_layer->weights->values[((size_t) i * weights->Matrix_t.col) + j], format);
+
+                half_layer->max_error = fmax(half_layer->max_error, fabs(weight - rounded));
+                error += (weight - rounded) * (weight - rounded);
+                total += weight * weight;
+
+                weights->Matrix_t.Matrix[i][j] = rounded;
+            }
+        }
+
+        half_layer->relative_error = (total > 0.0) ? (sqrt(error / total)) : (0.0);
+
+        // Keep the faster kernel of each path. (The double one on a tie: Nothing to widen)
+        Type_t batch  = {.Matrix_t = {.row = HALF_TIMING_ROWS, .col = weights->Matrix_t.col, .Matrix = timing_batch->Matrix_t.Matrix}};
+        Type_t result = {.Matrix_t = {.row = HALF_TIMING_ROWS, .col = weights->Matrix_t.row, .Matrix = timing_result->Matrix_t.Matrix}};
+
+        half_layer->single_double_ns = half_time_kernel(weights, NULL, &batch, &result, 0);
+        half_layer->single_half_ns   = half_time_kernel(weights, half_layer->weights, &batch, &result, 0);
+        half_layer->batch_double_ns  = half_time_kernel(weights, NULL, &batch, &result, HALF_TIMING_ROWS);
+        half_layer->batch_half_ns    = half_time_kernel(weights, half_layer->weights, &batch, &result, HALF_TIMING_ROWS);
+
+        half_layer->single_half = (half_layer->single_half_ns < half_layer->single_double_ns);
+        half_layer->batch_half  = (half_layer->batch_half_ns < half_layer->batch_double_ns);
+    }
+
+    Memory_Leave(previous_context);
+
+    free_matrix(timing_batch);
+    free_matrix(timing_result);
+
+    Weights_Changed(myNetwork);
+    half_weights->version = Model_Version(myNetwork);
+    layers->Half_weights = half_weights;
+
+    return ANN_OK;
+}//end Compress_Network.
+
+/**
+ * @brief Function to free the 16 bits weights of a network. (Free_Network)
+ *
+ * @param half_weights (NULL: Nothing)
+ */
+void Free_Half_Weights(Half_Weights_t *half_weights)
+{
+    if(half_weights == NULL)
+        return;
+
+    for(uint16_t layer = 0; layer < half_weights->layers_num; layer++)
+        Half_Matrix_Free(half_weights->layers[layer].weights);
+
+    Memory_Free(half_weights->layers);
+    Memory_Free(half_weights);
+
+    return;
+}//end Free_Half_Weights.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the name of a 16 bits format.
+ *
+ * @param format
+ * @return const char*
+ */
+const char *Half_Format_Name(Half_Format_t format)
+{
+    switch(format)
+    {
+        case HALF_FORMAT_BF16: return "bf16";
+        case HALF_FORMAT_FP16: return "fp16";
+        default:               return "unknown";
+    }
+}//end Half_Format_Name.
+
+/**
+ * @brief Function to print the bytes, the rounding errors & the kernels of each layer.
+ *
+ * @param myNetwork
+ */
+void print_half_report(DNN_Network *myNetwork)
+{
+    // Error Handeling.
+    if(myNetwork == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    const Half_Weights_t *half_weights = myNetwork->network_layers->Half_weights;
+
+    if(half_weights == NULL)
+    {
+        printf("\nHALF: Not compressed (Double weights)\n");
+        return;
+    }
+
+    const bool stale = (half_weights->version != Model_Version(myNetwork));
+
+    printf("\nHALF: %s%s\n", Half_Format_Name(half_weights->format), (stale) ? (", stale, the weights changed (Double weights)") : (""));
+    printf("%-6s %10s %12s %12s %12s %12s %7s %10s %10s %7s %10s %10s\n", "LAYER", "SHAPE", "DOUBLE_BYTES", "HALF_BYTES", "MAX_ERROR", "REL_ERROR",
+           "SINGLE", "DOUBLE_NS", "HALF_NS", "BATCH", "DOUBLE_NS", "HALF_NS");
+
+    for(uint16_t layer = 0; layer < half_weights->layers_num; layer++)
+    {
+        const Half_Layer_t *half_layer = &half_weights->layers[layer];
+        const size_t weights_num = (size_t) half_layer->weights->row * half_layer->weights->col;
+        char shape[16];
+
+        snprintf(shape, sizeof(shape), "%ux%u", half_layer->weights->row, half_layer->weights->col);
+
+        printf("%-6u %10s %12zu %12zu %12.3e %12.3e %7s %10.1f %10.1f %7s %10.1f %10.1f\n", layer, shape,
+               sizeof(double) * weights_num, sizeof(uint16_t) * weights_num, half_layer->max_error, half_layer->relative_error,
+               (half_layer->single_half) ? ("half") : ("double"), half_layer->single_double_ns, half_layer->single_half_ns,
+               (half_layer->batch_half) ? ("half") : ("double"), half_layer->batch_double_ns, half_layer->batch_half_ns);
+    }
+
+    return;
+}//end print_half_report.
+
+//!=============================> .END
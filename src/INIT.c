@@ -0,0 +1,404 @@
+/**
+ * @file INIT.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Weights initialization functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "INIT.H"
+#define CURRENT_C "INIT.C"
+
+/*
+    - Initialization overview:
+        Element [i][j] of a matrix takes the random numbers at index (i * col + j) of the
+        (seed, stream) Philox stream. No generator state is carried from one element to
+        the next, so:
+            - The rows can be split between threads in any way. (Same result, bit for bit)
+            - The same seed always gives the same network.
+            - Every weights layer has its own stream. (stream = layer index)
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+// Salt of the initialization keys. ("INIT") Keeps them apart from the dropout keys.
+#define INIT_KEY_SALT ((const uint64_t) 0x494E4954u)
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// The process seed of vector_init/matrix_init. (The threads without their own seed)
+static atomic_uint_fast64_t init_process_seed   = 0;
+static atomic_bool          init_process_seeded = false;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for one thread's share of a matrix initialization
+ *
+ */
+typedef struct _Init_Job_t
+{
+    Type_t *matrix;
+    Init_Scheme_t scheme;
+    double scale;
+
+    uint64_t key;
+    uint64_t stream;
+
+    uint16_t first_row;
+    uint16_t last_row; // (Excluded)
+}Init_Job_t;
+
+/**
+ * @brief Struct for the vector_init/matrix_init state of one thread
+ *
+ */
+typedef struct _Init_Thread_State_t
+{
+    uint64_t seed;
+    bool seeded;       // (false: The process seed)
+
+    uint64_t stream;   // The next stream.
+}Init_Thread_State_t;
+
+static _Thread_local Init_Thread_State_t init_thread_state = {.seed = 0, .seeded = false, .stream = 0};
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the limit (uniform) or the standard deviation (normal) of a scheme.
+ *
+ * @param scheme
+ * @param fan_in
+ * @param fan_out
+ * @return double
+ */
+static double init_scheme_scale(Init_Scheme_t scheme, uint16_t fan_in, uint16_t fan_out)
+{
+    switch(scheme)
+    {
+        case INIT_UNIFORM:        return INIT_UNIFORM_LIMIT;
+        case INIT_NORMAL:         return INIT_NORMAL_STDDEV;
+        case INIT_XAVIER_UNIFORM: return sqrt(6.0 / (fan_in + fan_out));
+        case INIT_XAVIER_NORMAL:  return sqrt(2.0 / (fan_in + fan_out));
+        case INIT_HE_UNIFORM:     return sqrt(6.0 / fan_in);
+        case INIT_HE_NORMAL:      return sqrt(2.0 / fan_in);
+        case INIT_DEFAULT:        return private.factor;
+        default:                  error_exit(CURRENT_C, "INIT_SCHEME:INVALID");
+    }
+}//end init_scheme_scale.
+
+/**
+ * @brief Function to check if a scheme draws from a normal distribution.
+ *
+ * @param scheme
+ * @return true
+ * @return false
+ */
+static inline bool init_scheme_normal(Init_Scheme_t scheme)
+{
+    return (scheme == INIT_NORMAL) || (scheme == INIT_XAVIER_NORMAL) || (scheme == INIT_HE_NORMAL);
+}//end init_scheme_normal.
+
+/**
+ * @brief Function to fill (count) values from the stream elements [first_element, first_element + count).
+ *          - Uniform schemes use one random number per element, normal schemes use two. (Box-Muller)
+ *
+ * @param values
+ * @param count (<= MAX_MATRIX_COL)
+ * @param scheme
+ * @param scale
+ * @param key
+ * @param stream
+ * @param first_element
+ */
+static void init_fill(double *values, uint16_t count, Init_Scheme_t scheme, double scale,
+                      uint64_t key, uint64_t stream, uint64_t first_element)
+{
+    uint32_t randoms[2 * MAX_MATRIX_COL];
+
+    if(init_scheme_normal(scheme))
+    {
+        Random_Fill_U32(key, stream, 2 * first_element, randoms, 2 * count);
+
+        for(uint16_t i = 0; i < count; i++)
+        {
+            // (0, 1] & [0, 1) uniforms. (log() never sees a zero)
+            const double u1 = ((double) randoms[(2 * i) + 0] + 1.0) * (1.0 / 4294967296.0);
+            const double u2 = RANDOM_TO_UNIT(randoms[(2 * i) + 1]);
+
+            values[i] = scale * sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+        }
+    }
+    else if(scheme == INIT_DEFAULT)
+    {
+        Random_Fill_U32(key, stream, first_element, randoms, count);
+
+        for(uint16_t i = 0; i < count; i++)
+            values[i] = (randoms[i] % private.range) * scale;
+    }
+    else
+    {
+        Random_Fill_U32(key, stream, first_element, randoms, count);
+
+        for(uint16_t i = 0; i < count; i++)
+            values[i] = scale * ((2.0 * RANDOM_TO_UNIT(randoms[i])) - 1.0);
+    }
+
+    return;
+}//end init_fill.
+
+/**
+ * @brief Function to initialize the rows of one job. (Thread entry)
+ *
+ * @param arg The Init_Job_t.
+ * @return void*
+ */
+static void *init_job_worker(void *arg)
+{
+    Init_Job_t *job = (Init_Job_t *) arg;
+
+    const uint16_t col = job->matrix->Matrix_t.col; // Temporary variable for readability.
+
+    for(uint16_t i = job->first_row; i < job->last_row; i++)
+    {
+        init_fill(job->matrix->Matrix_t.Matrix[i], col, job->scheme, job->scale,
+                  job->key, job->stream, (uint64_t) i * col);
+    }
+
+    return NULL;
+}//end init_job_worker.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to initialize a weights matrix with a scheme.
+ *          - Large matrices are split by rows between threads. (Same result as one thread)
+ *
+ * @param matrix [fan_out x fan_in]
+ * @param scheme
+ * @param seed
+ * @param stream
+ */
+void Init_Matrix(Type_t *matrix, Init_Scheme_t scheme, uint64_t seed, uint64_t stream)
+{
+    // Error Handler.
+    if( (matrix == NULL) || (matrix->Matrix_t.Matrix == NULL) )
+        error_exit(CURRENT_C, "MATRIX:NULL");
+
+    if( (matrix->Matrix_t.row <= 0) || (matrix->Matrix_t.col <= 0) )
+        error_exit(CURRENT_C, "MATRIX_ROW_COL:INVALID");
+
+    const uint16_t row = matrix->Matrix_t.row; // Temporary variable for readability.
+    const uint16_t col = matrix->Matrix_t.col; // Temporary variable for readability.
+
+    Init_Job_t job = {.matrix = matrix, .scheme = scheme, .scale = init_scheme_scale(scheme, col, row),
+                      .key = Random_Key(seed, INIT_KEY_SALT), .stream = stream,
+                      .first_row = 0, .last_row = row};
+
+    // Small matrices: One thread.
+    uint16_t threads_num = get_threads_num();
+
+    if(threads_num > INIT_MAX_THREADS)
+        threads_num = INIT_MAX_THREADS;
+
+    if(threads_num > row)
+        threads_num = row;
+
+    if( ((uint32_t) row * col < INIT_PARALLEL_MIN) || (threads_num <= 1) )
+    {
+        init_job_worker(&job);
+        return;
+    }
+
+    // Split the rows. (The calling thread takes the last share)
+    pthread_t threads[INIT_MAX_THREADS];
+    Init_Job_t jobs[INIT_MAX_THREADS];
+
+    const uint16_t rows_per_thread = (row + threads_num - 1) / threads_num;
+
+    for(uint16_t t = 0; t < threads_num; t++)
+    {
+        jobs[t] = job;
+        jobs[t].first_row = t * rows_per_thread;
+        jobs[t].last_row  = ((t + 1) * rows_per_thread < row) ? ((t + 1) * rows_per_thread) : (row);
+    }
+
+    for(uint16_t t = 0; t < threads_num - 1; t++)
+    {
+        if(pthread_create(&threads[t], NULL, init_job_worker, &jobs[t]) != 0)
+            error_exit(CURRENT_C, "INIT_THREAD:CREATE_FAILED");
+    }
+
+    init_job_worker(&jobs[threads_num - 1]);
+
+    for(uint16_t t = 0; t < threads_num - 1; t++)
+        pthread_join(threads[t], NULL);
+
+    return;
+}//end Init_Matrix.
+
+/**
+ * @brief Function to initialize a vector with a scheme. (fan_in = fan_out = vector length)
+ *
+ * @param vector
+ * @param scheme
+ * @param seed
+ * @param stream
+ */
+void Init_Vector(Type_t *vector, Init_Scheme_t scheme, uint64_t seed, uint64_t stream)
+{
+    // Error Handler.
+    if( (vector == NULL) || (vector->Vector_t.Vector == NULL) )
+        error_exit(CURRENT_C, "VECTOR:NULL");
+
+    if(vector->Vector_t.len <= 0)
+        error_exit(CURRENT_C, "VECTOR_LEN:INVALID");
+
+    const uint16_t vector_len = vector->Vector_t.len; // Temporary variable for readability.
+
+    init_fill(vector->Vector_t.Vector, vector_len, scheme, init_scheme_scale(scheme, vector_len, vector_len),
+              Random_Key(seed, INIT_KEY_SALT), stream, 0);
+
+    return;
+}//end Init_Vector.
+
+/**
+ * @brief Function to initialize all the weights & the biases of a network.
+ *          - Weights[layer] uses stream (layer), the biases use stream (number of weights layers).
+ *          - The biases start at zero, except with the INIT_DEFAULT scheme.
+ *
+ * @param dnn_network
+ * @param layer_schemes One scheme per weights layer. (NULL: The network config schemes)
+ * @param seed
+ */
+void Init_Network(DNN_Network *dnn_network, const Init_Scheme_t *layer_schemes, uint64_t seed)
+{
+    // Error Handler.
+    if(dnn_network == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    Network_Config_t *network_config = dnn_network->network_config; // (Temporary variable for readbility).
+    const uint16_t number_of_matrices = dnn_network->network_topology->hidden_layer_num + 1;
+
+    for(uint16_t layer = 0; layer < number_of_matrices; layer++)
+    {
+        Init_Scheme_t scheme = network_config->weight_init;
+
+        if(layer_schemes != NULL)
+            scheme = layer_schemes[layer];
+        else if( (layer == number_of_matrices - 1) && (network_config->output_weight_init != INIT_DEFAULT) )
+            scheme = network_config->output_weight_init;
+
+        Init_Matrix(dnn_network->network_layers->Layer_weights[layer].layer_weights, scheme, seed, layer);
+    }
+
+    Type_t *biases = dnn_network->network_layers->Layers_biases->layers_biases;
+    const Init_Scheme_t biases_scheme = (layer_schemes != NULL) ? (layer_schemes[0]) : (network_config->weight_init);
+
+    if(biases_scheme == INIT_DEFAULT)
+        Init_Vector(biases, INIT_DEFAULT, seed, number_of_matrices);
+    else
+        memset(biases->Vector_t.Vector, 0, sizeof(double) * biases->Vector_t.len);
+
+    Weights_Changed(dnn_network);
+
+    return;
+}//end Init_Network.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to set the seed of vector_init & matrix_init, for the calling thread.
+ *          - Also the default of the threads that never set one. Its streams restart at 0.
+ *
+ * @param seed
+ */
+void Init_Set_Seed(uint64_t seed)
+{
+    atomic_store(&init_process_seed, seed);
+    atomic_store(&init_process_seeded, true);
+
+    init_thread_state.seed   = seed;
+    init_thread_state.seeded = true;
+    init_thread_state.stream = 0;
+
+    return;
+}//end Init_Set_Seed.
+
+/**
+ * @brief Function to set the next stream of vector_init & matrix_init, for the calling thread.
+ *          - Give each thread of one seed its own range of streams. (Ex: worker << 32)
+ *
+ * @param stream
+ */
+void Init_Set_Stream(uint64_t stream)
+{
+    init_thread_state.stream = stream;
+
+    return;
+}//end Init_Set_Stream.
+
+/**
+ * @brief Function to get the seed of the calling thread. (Its own, else the process seed: Taken
+ *        from the clock once if randoming & never set)
+ *
+ * @return uint64_t
+ */
+uint64_t Init_Get_Seed(void)
+{
+    if(init_thread_state.seeded == true)
+        return init_thread_state.seed;
+
+    if(atomic_load(&init_process_seeded) == false)
+    {
+        const uint64_t seed = (private.randoming == true) ? ((uint64_t) time(NULL) ^ (uint64_t) clock()) : (0);
+
+        uint_fast64_t expected = 0;
+        atomic_compare_exchange_strong(&init_process_seed, &expected, seed);
+        atomic_store(&init_process_seeded, true);
+    }
+
+    return atomic_load(&init_process_seed);
+}//end Init_Get_Seed.
+
+/**
+ * @brief Function to get the next stream of the calling thread. (Every call gets different numbers)
+ *          - The other threads' calls don't move it: The values of one seed only depend on the
+ *            calls of this thread.
+ *
+ * @return uint64_t
+ */
+uint64_t Init_Next_Stream(void)
+{
+    return init_thread_state.stream++;
+}//end Init_Next_Stream.
+
+//!=============================> .END
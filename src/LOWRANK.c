@@ -0,0 +1,397 @@
+/**
+ * @file LOWRANK.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Low rank factorized layers functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "LOWRANK.H"
+#define CURRENT_C "LOWRANK.C"
+
+/*
+    - Factorized layers overview:
+        Weights [out x in] = Sum(p) Singular[p] * Left[p] (outer) Right[p]    (Matrix_SVD)
+                          ~ Up [out x r] x Down [r x in]                     (The r largest terms)
+
+        The product runs as Down x input into r values, then Up x them: r x (out + in) multiply
+        adds instead of out x in. A layer is factorized only if its rank saves some of them.
+
+    - Factorize_Network replaces the dense weights by Up x Down, so the trained, saved & cached
+      models are the factorized one. The factors belong to that model version: Once the weights
+      change again the dense weights run until Factorize_Network is called again.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to choose the rank of a layer.
+ *
+ * @param singular [k] (Decreasing)
+ * @param k
+ * @param out
+ * @param in
+ * @param target
+ * @param value    The relative error or the speedup.
+ * @return uint16_t (0: No rank saves multiply adds)
+ */
+static uint16_t lowrank_choose_rank(const double *singular, uint16_t k, uint16_t out, uint16_t in, LowRank_Target_t target, double value)
+{
+    uint16_t rank;
+
+    if(target == LOWRANK_TARGET_SPEEDUP)
+    {
+        rank = (uint16_t) (((double) out * in) / (value * (out + in)));
+    }
+    else
+    {
+        double total = 0.0;
+
+        for(uint16_t p = 0; p < k; p++)
+            total += singular[p] * singular[p];
+
+        // Drop the smallest values while the dropped energy stays under the error.
+        double tail = 0.0;
+        rank = k;
+
+        while( (rank > 1) && ((tail + (singular[rank - 1] * singular[rank - 1])) <= (value * value * total)) )
+        {
+            tail += singular[rank - 1] * singular[rank - 1];
+            rank--;
+        }
+    }
+
+    rank = (rank < 1) ? (1) : ((rank > k) ? (k) : (rank));
+
+    // No gain: The dense product is as cheap.
+    if( ((uint32_t) rank * (out + in)) >= ((uint32_t) out * in) )
+        return 0;
+
+    return rank;
+}//end lowrank_choose_rank.
+
+/**
+ * @brief Function to factorize one weights layer & to replace its weights by the product of the factors.
+ *
+ * @param layers
+ * @param weights [out x in]
+ * @param target
+ * @param value
+ * @param lowrank_layer
+ */
+static void lowrank_layer(Layer_t *layers, Type_t *weights, LowRank_Target_t target, double value, LowRank_Layer_t *lowrank_layer)
+{
+    const uint16_t out = weights->Matrix_t.row; // Temporary variable for readability.
+    const uint16_t in  = weights->Matrix_t.col; // Temporary variable for readability.
+    const uint16_t k   = (out < in) ? (out) : (in);
+
+    // The decomposition. (Temporary)
+    const Memory_Context_t previous_context = Memory_Enter(layers->Memory_stats, MEMORY_TEMPORARY);
+    Type_t *left  = create_matrix(k, out, false);
+    Type_t *right = create_matrix(k, in, false);
+    double singular[MAX_MATRIX_ROW];
+    Memory_Leave(previous_context);
+
+    Matrix_SVD(weights, left, singular, right);
+
+    const uint16_t rank = lowrank_choose_rank(singular, k, out, in, target, value);
+
+    double total = 0.0, tail = 0.0;
+
+    for(uint16_t p = 0; p < k; p++)
+    {
+        total += singular[p] * singular[p];
+        tail  += (p >= rank) ? (singular[p] * singular[p]) : (0.0);
+    }
+
+    lowrank_layer->rank  = rank;
+    lowrank_layer->error = ( (rank > 0) && (total > 0.0) ) ? (sqrt(tail / total)) : (0.0);
+
+    if(rank > 0)
+    {
+        // The factors. (Charged to the weights)
+        const Memory_Context_t weights_context = Memory_Enter(layers->Memory_stats, MEMORY_WEIGHTS);
+        lowrank_layer->down = create_matrix(rank, in, false);
+        lowrank_layer->up   = create_matrix(out, rank, false);
+        Memory_Leave(weights_context);
+
+        for(uint16_t p = 0; p < rank; p++)
+        {
+            for(uint16_t j = 0; j < in; j++)
+                lowrank_layer->down->Matrix_t.Matrix[p][j] = singular[p] * right->Matrix_t.Matrix[p][j];
+
+            for(uint16_t i = 0; i < out; i++)
+                lowrank_layer->up->Matrix_t.Matrix[i][p] = left->Matrix_t.Matrix[p][i];
+        }
+
+        // Weights = Up x Down.
+        for(uint16_t i = 0; i < out; i++)
+        {
+            for(uint16_t j = 0; j < in; j++)
+            {
+                double sum = 0.0;
+
+                for(uint16_t p = 0; p < rank; p++)
+                    sum += lowrank_layer->up->Matrix_t.Matrix[i][p] * lowrank_layer->down->Matrix_t.Matrix[p][j];
+
+                weights->Matrix_t.Matrix[i][j] = sum;
+            }
+        }
+    }
+
+    free_matrix(left);
+    free_matrix(right);
+
+    return;
+}//end lowrank_layer.
+
+/**
+ * @brief Function to compare the outputs of the factorized network with the original ones.
+ *
+ * @param original   [samples x output_layer_dense]
+ * @param factorized [samples x output_layer_dense]
+ * @param samples
+ * @param drift
+ */
+static void lowrank_drift(Type_t *original, Type_t *factorized, uint16_t samples, LowRank_Drift_t *drift)
+{
+    const uint16_t outputs = original->Matrix_t.col; // Temporary variable for readability.
+    double sum = 0.0;
+    uint16_t agreements = 0;
+
+    drift->samples = samples;
+    drift->max_abs = 0.0;
+
+    for(uint16_t r = 0; r < samples; r++)
+    {
+        const double *x = original->Matrix_t.Matrix[r];
+        const double *y = factorized->Matrix_t.Matrix[r];
+        uint16_t x_max = 0, y_max = 0;
+
+        for(uint16_t i = 0; i < outputs; i++)
+        {
+            const double diff = fabs(y[i] - x[i]);
+
+            drift->max_abs = fmax(drift->max_abs, diff);
+            sum += diff;
+
+            x_max = (x[i] > x[x_max]) ? (i) : (x_max);
+            y_max = (y[i] > y[y_max]) ? (i) : (y_max);
+        }
+
+        agreements += (x_max == y_max) ? (1) : (0);
+    }
+
+    drift->mean_abs = sum / ((double) samples * outputs);
+    drift->argmax_agreement = (double) agreements / samples;
+
+    return;
+}//end lowrank_drift.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to factorize the weights layers of a network into two smaller ones.
+ *          - The rank of each layer is chosen from the target. The layers it doesn't make
+ *            cheaper stay dense.
+ *
+ * @param myNetwork
+ * @param target
+ * @param value      The relative weights error (0, 1) or the speedup (> 1) of each layer.
+ * @param validation [samples x input_layer_dense] Inputs to measure the drift on. (NULL: None)
+ * @param samples
+ * @param drift      The outputs drift on the validation inputs. (NULL: Not needed)
+ * @return ANN_Status_t
+ */
+ANN_Status_t Factorize_Network(DNN_Network *myNetwork, LowRank_Target_t target, double value,
+                               Type_t *validation, uint16_t samples, LowRank_Drift_t *drift)
+{
+    // Error Handeling.
+    if( (myNetwork == NULL) || (myNetwork->network_layers == NULL) )
+        return ANN_ERROR_NULL;
+
+    if( (target == LOWRANK_TARGET_ERROR) && !((value > 0.0) && (value < 1.0)) )
+        return ANN_ERROR_INVALID;
+
+    if( (target == LOWRANK_TARGET_SPEEDUP) && !(value > 1.0) )
+        return ANN_ERROR_INVALID;
+
+    if( (target != LOWRANK_TARGET_ERROR) && (target != LOWRANK_TARGET_SPEEDUP) )
+        return ANN_ERROR_INVALID;
+
+    const bool measure = (validation != NULL) && (samples > 0);
+
+    if(samples > MAX_MATRIX_ROW)
+        return ANN_ERROR_LIMIT;
+
+    Layer_t *layers = myNetwork->network_layers; // (Temporary variable for readbility).
+    const uint16_t layers_num = myNetwork->network_topology->hidden_layer_num + 1;
+    const uint16_t output_dense = myNetwork->network_topology->output_layer_dense;
+
+    // The original outputs. (Before any weight changes)
+    Type_t *original = NULL, *factorized = NULL;
+
+    if(measure)
+    {
+        const Memory_Context_t temporary_context = Memory_Enter(layers->Memory_stats, MEMORY_TEMPORARY);
+        original   = create_matrix(samples, output_dense, false);
+        factorized = create_matrix(samples, output_dense, false);
+        Memory_Leave(temporary_context);
+
+        const ANN_Status_t status = Predict_Batch_Network(myNetwork, validation, original, samples);
+
+        if(status != ANN_OK)
+        {
+            free_matrix(original);
+            free_matrix(factorized);
+            return status;
+        }
+    }
+
+    Free_LowRank_Weights(layers->LowRank_weights);
+    layers->LowRank_weights = NULL;
+
+    const Memory_Context_t previous_context = Memory_Enter(layers->Memory_stats, MEMORY_WEIGHTS);
+    LowRank_Weights_t *lowrank = (LowRank_Weights_t *) Memory_Calloc(sizeof(LowRank_Weights_t), MEMORY_WEIGHTS);
+    lowrank->layers_num = layers_num;
+    lowrank->layers = (LowRank_Layer_t *) Memory_Calloc(sizeof(LowRank_Layer_t) * layers_num, MEMORY_WEIGHTS);
+    Memory_Leave(previous_context);
+
+    for(uint16_t layer = 0; layer < layers_num; layer++)
+    {
+        lowrank_layer(layers, layers->Layer_weights[layer].layer_weights, target, value, &lowrank->layers[layer]);
+
+        lowrank->max_rank = (lowrank->layers[layer].rank > lowrank->max_rank) ? (lowrank->layers[layer].rank) : (lowrank->max_rank);
+    }
+
+    // The vector between the two products.
+    if(lowrank->max_rank > 0)
+    {
+        const Memory_Context_t activations_context = Memory_Enter(layers->Memory_stats, MEMORY_ACTIVATIONS);
+        lowrank->rank_vector = create_vector(lowrank->max_rank, false);
+        Memory_Leave(activations_context);
+    }
+
+    Weights_Changed(myNetwork);
+    lowrank->version = Model_Version(myNetwork);
+    layers->LowRank_weights = lowrank;
+
+    if(measure)
+    {
+        Predict_Batch_Network(myNetwork, validation, factorized, samples);
+
+        if(drift != NULL)
+            lowrank_drift(original, factorized, samples, drift);
+
+        free_matrix(original);
+        free_matrix(factorized);
+    }
+    else if(drift != NULL)
+    {
+        memset(drift, 0, sizeof(LowRank_Drift_t));
+    }
+
+    return ANN_OK;
+}//end Factorize_Network.
+
+/**
+ * @brief Function to free the factorized layers of a network. (Free_Network)
+ *
+ * @param lowrank (NULL: Nothing)
+ */
+void Free_LowRank_Weights(LowRank_Weights_t *lowrank)
+{
+    if(lowrank == NULL)
+        return;
+
+    for(uint16_t layer = 0; layer < lowrank->layers_num; layer++)
+    {
+        if(lowrank->layers[layer].rank > 0)
+        {
+            free_matrix(lowrank->layers[layer].down);
+            free_matrix(lowrank->layers[layer].up);
+        }
+    }
+
+    if(lowrank->rank_vector != NULL)
+        free_vector(lowrank->rank_vector);
+
+    if(lowrank->batch_workspace != NULL)
+        free_matrix(lowrank->batch_workspace);
+
+    Memory_Free(lowrank->layers);
+    Memory_Free(lowrank);
+
+    return;
+}//end Free_LowRank_Weights.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to print the rank, the error & the multiply adds of each layer & the outputs drift.
+ *
+ * @param myNetwork
+ * @param drift (NULL: Not printed)
+ */
+void print_lowrank_report(DNN_Network *myNetwork, LowRank_Drift_t *drift)
+{
+    // Error Handeling.
+    if(myNetwork == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    const LowRank_Weights_t *lowrank = myNetwork->network_layers->LowRank_weights;
+
+    if(lowrank == NULL)
+    {
+        printf("\nLOWRANK: Not factorized (Dense weights)\n");
+        return;
+    }
+
+    const bool stale = (lowrank->version != Model_Version(myNetwork));
+
+    printf("\nLOWRANK:%s\n", (stale) ? (" Stale, the weights changed (Dense weights)") : (""));
+    printf("%-6s %10s %6s %10s %12s %12s %8s\n", "LAYER", "SHAPE", "RANK", "ERROR", "DENSE_MACS", "RANK_MACS", "SPEEDUP");
+
+    for(uint16_t layer = 0; layer < lowrank->layers_num; layer++)
+    {
+        const LowRank_Layer_t *lowrank_layer = &lowrank->layers[layer];
+        Type_t *weights = myNetwork->network_layers->Layer_weights[layer].layer_weights;
+
+        const uint32_t dense_macs = (uint32_t) weights->Matrix_t.row * weights->Matrix_t.col;
+        const uint32_t rank_macs  = (lowrank_layer->rank > 0) ? ((uint32_t) lowrank_layer->rank * (weights->Matrix_t.row + weights->Matrix_t.col)) : (dense_macs);
+        char shape[16];
+
+        snprintf(shape, sizeof(shape), "%ux%u", weights->Matrix_t.row, weights->Matrix_t.col);
+
+        if(lowrank_layer->rank > 0)
+            printf("%-6u %10s %6u %10.2e %12u %12u %7.2fx\n", layer, shape, lowrank_layer->rank, lowrank_layer->error,
+                   dense_macs, rank_macs, (double) dense_macs / rank_macs);
+        else
+            printf("%-6u %10s %6s %10s %12u %12u %7.2fx\n", layer, shape, "dense", "-", dense_macs, rank_macs, 1.0);
+    }
+
+    if( (drift != NULL) && (drift->samples > 0) )
+        printf("DRIFT: %u samples, MAX |diff|: %.3e, MEAN |diff|: %.3e, ARGMAX AGREEMENT: %.1f%%\n",
+               drift->samples, drift->max_abs, drift->mean_abs, 100.0 * drift->argmax_agreement);
+
+    return;
+}//end print_lowrank_report.
+
+//!=============================> .END
@@ -14,6 +14,144 @@
 #define CURRENT_H "MATRIX.H"
 #define CURRENT_C "MATRIX.C"
 
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Union to read the bits of a float.
+ * 
+ */
+typedef union
+{
+    uint32_t u;
+    float f;
+}Matrix_Float_Bits_t;
+
+/**
+ * @brief Union to read the bits of a double.
+ * 
+ */
+typedef union
+{
+    uint64_t u;
+    double d;
+}Matrix_Double_Bits_t;
+
+/**
+ * @brief Function to widen a bfloat16. (Its bits are the high half of the float)
+ * 
+ * @param half 
+ * @return double 
+ */
+static inline double matrix_bf16_to_double(uint16_t half)
+{
+    const Matrix_Float_Bits_t bits = {.u = (uint32_t) half << 16};
+
+    return bits.f;
+}//end matrix_bf16_to_double.
+
+/**
+ * @brief Function to widen a finite IEEE half. (No branches for the products loops)
+ *          - Its bits at the top of a double are the half x 2^-1008: One product rebiases
+ *            the exponent, the subnormals too. (Inf & NaN: Half_Decode)
+ * 
+ * @param half 
+ * @return double 
+ */
+static inline double matrix_fp16_to_double(uint16_t half)
+{
+    Matrix_Double_Bits_t bits = {.u = ((uint64_t) (half & 0x8000u) << 48) | ((uint64_t) (half & 0x7FFFu) << 42)};
+
+    return bits.d * 0x1p1008;
+}//end matrix_fp16_to_double.
+
+/**
+ * @brief Function to round a float to a bfloat16. (To the nearest, ties to even)
+ * 
+ * @param value 
+ * @return uint16_t 
+ */
+static inline uint16_t matrix_float_to_bf16(float value)
+{
+    Matrix_Float_Bits_t bits = {.f = value};
+
+    // NaN: Keep it a (quiet) NaN.
+    if( (bits.u & 0x7FFFFFFFu) > 0x7F800000u )
+        return (uint16_t) ((bits.u >> 16) | 0x0040u);
+
+    bits.u += 0x7FFFu + ((bits.u >> 16) & 1u);
+
+    return (uint16_t) (bits.u >> 16);
+}//end matrix_float_to_bf16.
+
+/**
+ * @brief Function to round a float to an IEEE half. (To the nearest, ties to even)
+ * 
+ * @param value 
+ * @return uint16_t 
+ */
+static inline uint16_t matrix_float_to_fp16(float value)
+{
+    const Matrix_Float_Bits_t infinity     = {.u = 255u << 23};
+    const Matrix_Float_Bits_t half_max     = {.u = (127u + 16u) << 23};
+    const Matrix_Float_Bits_t denorm_magic = {.u = ((127u - 15u) + (23u - 10u) + 1u) << 23};
+
+    Matrix_Float_Bits_t bits = {.f = value};
+    const uint32_t sign = bits.u & 0x80000000u;
+    uint16_t half;
+
+    bits.u ^= sign;
+
+    if(bits.u >= half_max.u)
+    {
+        // Overflow: Inf. (NaN: A quiet NaN)
+        half = (bits.u > infinity.u) ? (0x7E00u) : (0x7C00u);
+    }
+    else if(bits.u < (113u << 23))
+    {
+        // Subnormals & zero: The float addition rounds the mantissa.
+        bits.f += denorm_magic.f;
+        half = (uint16_t) (bits.u - denorm_magic.u);
+    }
+    else
+    {
+        const uint32_t mantissa_odd = (bits.u >> 13) & 1u;
+
+        bits.u += (uint32_t) ((15 - 127) * (1 << 23)) + 0xFFFu;
+        bits.u += mantissa_odd;
+        half = (uint16_t) (bits.u >> 13);
+    }
+
+    return half | (uint16_t) (sign >> 16);
+}//end matrix_float_to_fp16.
+
+/**
+ * @brief Function to widen a row of 16 bits weights. (A loop without dependencies: Vectorized for bf16)
+ * 
+ * @param half    [col]
+ * @param format 
+ * @param col 
+ * @param weights [col]
+ */
+static inline void matrix_half_row(const uint16_t *half, Half_Format_t format, uint16_t col, double *weights)
+{
+    if(format == HALF_FORMAT_BF16)
+    {
+        for(uint16_t j = 0; j < col; j++)
+            weights[j] = matrix_bf16_to_double(half[j]);
+    }
+    else
+    {
+        for(uint16_t j = 0; j < col; j++)
+            weights[j] = matrix_fp16_to_double(half[j]);
+    }
+
+    return;
+}//end matrix_half_row.
+
 /*
 ----------------------------------------------------------------
 !-                       MAIN FUNCTIONS                        -
@@ -31,28 +169,60 @@
 
  * @param vector 
  * @param matrix 
- * @return double* 
+ * @return double* [matrix->row] (malloc: Free it with free)
  */
 double *VxM_DotProduct(Type_t *vector, Type_t *matrix)
 {
     // Error handeling function.
     dotProduct_Validity(vector, matrix);
     
-    // Allocating heap memory for the result vector.
+    // Allocating heap memory for the result vector. (The caller frees it with free: Not accounted)
     double *vector_result = (double *) malloc(sizeof(double) * matrix->Matrix_t.row);
-    //static vector_result[vector->len];
+
+    if(vector_result == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
     
-    /*
-        // Allocate memory for the union (New Vector)
-        Type_t *vector_result = (Type_t *) malloc(sizeof(Type_t));
-        
-        // Set the new vector parameters.
-        vector_result->len = vector->len;
-        // Allocacte memory for the Vector data.
-        vector_result->Vector = (double *) malloc(sizeof(double) * vector_result->len);
-        
-    */
+    VxM_DotProduct_Unchecked(vector, matrix, vector_result);
     
+    // Return the result vector as union.
+    return vector_result;
+}//end Matrix_X_Vector.
+
+/**
+ * @brief Function to multiply 1D array by 2D array into a preallocated array.
+ *          - Same as VxM_DotProduct without allocating, so the forward pass reuses its layers.
+ *
+ * @param vector 
+ * @param matrix 
+ * @param vector_result [matrix->row] (Must not be the vector data)
+ */
+void VxM_DotProduct_Into(Type_t *vector, Type_t *matrix, double *vector_result)
+{
+    // Error handeling function.
+    dotProduct_Validity(vector, matrix);
+
+    if(vector_result == NULL)
+        error_exit(CURRENT_C, "VECTOR_RESULT:NULL");
+    
+    VxM_DotProduct_Unchecked(vector, matrix, vector_result);
+    
+    return;
+}//end VxM_DotProduct_Into.
+
+/**
+ * @brief Function to multiply 1D array by 2D array without any check.
+ *          - For the hot paths: The shapes are validated once (dotProduct_Check) when the
+ *            network is built. Built with ANN_DEBUG_CHECKS, they are checked again here.
+ *
+ * @param vector 
+ * @param matrix 
+ * @param vector_result [matrix->row] (Must not be the vector data)
+ */
+void VxM_DotProduct_Unchecked(Type_t *vector, Type_t *matrix, double *vector_result)
+{
+    ANN_ASSERT(dotProduct_Check(vector, matrix) == ANN_OK, "VECTOR_MATRIX:INVALID");
+    ANN_ASSERT(vector_result != NULL, "VECTOR_RESULT:NULL");
+
     double sum = 0.0;
     
     for(uint16_t i = 0; i < matrix->Matrix_t.row; i++)
@@ -68,9 +238,388 @@ double *VxM_DotProduct(Type_t *vector, Type_t *matrix)
         sum = 0.0;
     }
     
-    // Return the result vector as union.
-    return vector_result;
-}//end Matrix_X_Vector.
+    return;
+}//end VxM_DotProduct_Unchecked.
+
+/**
+ * @brief Function to multiply every row of a batch by a 2D array.
+ * - Quick Math Recap:
+        Batch[r] (dot product) Matrix => Result[r]  (For r in rows)
+        - Four batch rows share every loaded matrix row, so the weights are read
+          from the memory once per four samples instead of once per sample.
+        - Data Block:
+            (Batch_Layer[LAYER]->Matrix * Weights[LAYER]->Matrix) = BATCH_LAYER[LAYER->NEXT]->Matrix.
+
+ * @param batch  [rows x matrix->col]
+ * @param matrix [row x col]
+ * @param result [rows x matrix->row] (Preallocated)
+ * @param rows   The number of batch rows to multiply.
+ */
+void BxM_DotProduct(Type_t *batch, Type_t *matrix, Type_t *result, uint16_t rows)
+{
+    // Error Handeling.
+    const ANN_Status_t status = BxM_DotProduct_Check(batch, matrix, result, rows);
+
+    if(status != ANN_OK)
+        error_exit(CURRENT_C, ANN_Status_Name(status));
+
+    BxM_DotProduct_Unchecked(batch, matrix, result, rows);
+
+    return;
+}//end BxM_DotProduct.
+
+/**
+ * @brief Function to multiply every row of a batch by a 2D array without any check.
+ *          - Same as BxM_DotProduct. The shapes are validated once (BxM_DotProduct_Check)
+ *            by the caller. Built with ANN_DEBUG_CHECKS, they are checked again here.
+ *
+ * @param batch  [rows x matrix->col]
+ * @param matrix [row x col]
+ * @param result [rows x matrix->row] (Preallocated)
+ * @param rows   The number of batch rows to multiply.
+ */
+void BxM_DotProduct_Unchecked(Type_t *batch, Type_t *matrix, Type_t *result, uint16_t rows)
+{
+    ANN_ASSERT(BxM_DotProduct_Check(batch, matrix, result, rows) == ANN_OK, "BATCH_MATRIX_RESULT:INVALID");
+
+    const uint16_t matrix_row = matrix->Matrix_t.row; // Temporary variable for readability.
+    const uint16_t matrix_col = matrix->Matrix_t.col; // Temporary variable for readability.
+
+    uint16_t r = 0;
+
+    // Four samples at a time.
+    for(; (r + 4) <= rows; r += 4)
+    {
+        const double *x0 = batch->Matrix_t.Matrix[r + 0];
+        const double *x1 = batch->Matrix_t.Matrix[r + 1];
+        const double *x2 = batch->Matrix_t.Matrix[r + 2];
+        const double *x3 = batch->Matrix_t.Matrix[r + 3];
+
+        for(uint16_t i = 0; i < matrix_row; i++)
+        {
+            const double *weights = matrix->Matrix_t.Matrix[i];
+            double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+
+            for(uint16_t j = 0; j < matrix_col; j++)
+            {
+                sum0 += weights[j] * x0[j];
+                sum1 += weights[j] * x1[j];
+                sum2 += weights[j] * x2[j];
+                sum3 += weights[j] * x3[j];
+            }
+
+            result->Matrix_t.Matrix[r + 0][i] = sum0;
+            result->Matrix_t.Matrix[r + 1][i] = sum1;
+            result->Matrix_t.Matrix[r + 2][i] = sum2;
+            result->Matrix_t.Matrix[r + 3][i] = sum3;
+        }
+    }
+
+    // The remaining samples.
+    for(; r < rows; r++)
+    {
+        const double *x = batch->Matrix_t.Matrix[r];
+
+        for(uint16_t i = 0; i < matrix_row; i++)
+        {
+            const double *weights = matrix->Matrix_t.Matrix[i];
+            double sum = 0.0;
+
+            for(uint16_t j = 0; j < matrix_col; j++)
+                sum += weights[j] * x[j];
+
+            result->Matrix_t.Matrix[r][i] = sum;
+        }
+    }
+
+    return;
+}//end BxM_DotProduct_Unchecked.
+
+/**
+ * @brief Function to multiply a borrowed vector by a 2D array without any check.
+ *          - Same as VxM_DotProduct_Unchecked, read in place from the view. (No copy)
+ *
+ * @param view   [matrix->col] values.
+ * @param matrix 
+ * @param vector_result [matrix->row]
+ */
+void ViewxM_DotProduct_Unchecked(const Tensor_View_t *view, Type_t *matrix, double *vector_result)
+{
+    ANN_ASSERT(Tensor_View_Check(view) == ANN_OK, "TENSOR_VIEW:INVALID");
+    ANN_ASSERT(view->len == matrix->Matrix_t.col, "VIEW_MATRIX:INVALID");
+
+    // Contiguous: The vector kernel reads it as it is.
+    if(view->stride <= 1)
+    {
+        Type_t vector = {.Vector_t = {.len = (uint8_t) view->len, .Vector = (double *) view->data}};
+        VxM_DotProduct_Unchecked(&vector, matrix, vector_result);
+        return;
+    }
+
+    const uint32_t stride = view->stride; // Temporary variable for readability.
+
+    for(uint16_t i = 0; i < matrix->Matrix_t.row; i++)
+    {
+        double sum = 0.0;
+
+        for(uint16_t j = 0; j < matrix->Matrix_t.col; j++)
+            sum += matrix->Matrix_t.Matrix[i][j] * view->data[(size_t) j * stride];
+
+        vector_result[i] = sum;
+    }
+
+    return;
+}//end ViewxM_DotProduct_Unchecked.
+
+/**
+ * @brief Function to multiply a sparse vector by a 2D array without any check.
+ * - Quick Math Recap:
+        Result[i] = Sum(k) Matrix[i][indices[k]] * values[k]    (Gather & sum of the active columns)
+        - O(row x nnz) instead of O(row x col): The zeros are never multiplied.
+ *
+ * @param sparse [matrix->col] long.
+ * @param matrix 
+ * @param vector_result [matrix->row]
+ */
+void SparsexM_DotProduct_Unchecked(const Sparse_Vector_t *sparse, Type_t *matrix, double *vector_result)
+{
+    ANN_ASSERT(Sparse_Vector_Check(sparse) == ANN_OK, "SPARSE_VECTOR:INVALID");
+    ANN_ASSERT(sparse->len == matrix->Matrix_t.col, "SPARSE_MATRIX:INVALID");
+
+    const uint16_t *indices = sparse->indices; // Temporary variable for readability.
+    const double *values    = sparse->values;  // Temporary variable for readability.
+
+    for(uint16_t i = 0; i < matrix->Matrix_t.row; i++)
+    {
+        const double *matrix_row = matrix->Matrix_t.Matrix[i];
+        double sum = 0.0;
+
+        if(values == NULL)
+        {
+            for(uint16_t k = 0; k < sparse->nnz; k++)
+                sum += matrix_row[indices[k]];
+        }
+        else
+        {
+            for(uint16_t k = 0; k < sparse->nnz; k++)
+                sum += matrix_row[indices[k]] * values[k];
+        }
+
+        vector_result[i] = sum;
+    }
+
+    return;
+}//end SparsexM_DotProduct_Unchecked.
+
+/**
+ * @brief Function to multiply 1D array by a sparse 2D array without any check.
+ * - Quick Math Recap:
+        Result[i] = Sum(k in row i) Values[k] * Vector[Columns[k]]    (CSR: Only the non zero weights)
+        Result[i] = Sum(blocks in row i) Values[k][0..3] . Vector[Columns[k] + 0..3]
+        - BSR: Each block is SPARSE_BLOCK_COLS contiguous weights & inputs, summed in as many
+          independent lanes. (One SIMD multiply add per block, no gather)
+        - O(nnz) instead of O(row x col): The pruned weights are never read.
+ *
+ * @param vector [matrix->col]
+ * @param matrix 
+ * @param vector_result [matrix->row] (Must not be the vector data)
+ */
+void VxSM_DotProduct_Unchecked(const double *vector, const Sparse_Matrix_t *matrix, double *vector_result)
+{
+    ANN_ASSERT( (vector != NULL) && (matrix != NULL) && (vector_result != NULL), "SPARSE_MATRIX:NULL");
+
+    const uint32_t *row_start = matrix->row_start; // Temporary variable for readability.
+    const uint16_t *columns   = matrix->columns;   // Temporary variable for readability.
+    const double *values      = matrix->values;    // Temporary variable for readability.
+
+    if(matrix->format == SPARSE_FORMAT_CSR)
+    {
+        for(uint16_t i = 0; i < matrix->row; i++)
+        {
+            double sum = 0.0;
+
+            for(uint32_t k = row_start[i]; k < row_start[i + 1]; k++)
+                sum += values[k] * vector[columns[k]];
+
+            vector_result[i] = sum;
+        }
+
+        return;
+    }
+
+    // The blocks starting before this column are whole. (The last one of a row may be padded)
+    const uint16_t whole_col = matrix->col - (matrix->col % SPARSE_BLOCK_COLS);
+
+    for(uint16_t i = 0; i < matrix->row; i++)
+    {
+        double lanes[SPARSE_BLOCK_COLS] = {0.0};
+
+        for(uint32_t k = row_start[i]; k < row_start[i + 1]; k++)
+        {
+            const double *weights = &values[(size_t) k * SPARSE_BLOCK_COLS];
+            const double *inputs  = &vector[columns[k]];
+
+            if(columns[k] < whole_col)
+            {
+                for(uint8_t l = 0; l < SPARSE_BLOCK_COLS; l++)
+                    lanes[l] += weights[l] * inputs[l];
+            }
+            else
+            {
+                for(uint8_t l = 0; (columns[k] + l) < matrix->col; l++)
+                    lanes[l] += weights[l] * inputs[l];
+            }
+        }
+
+        double sum = 0.0;
+
+        for(uint8_t l = 0; l < SPARSE_BLOCK_COLS; l++)
+            sum += lanes[l];
+
+        vector_result[i] = sum;
+    }
+
+    return;
+}//end VxSM_DotProduct_Unchecked.
+
+/**
+ * @brief Function to multiply every row of a batch by a sparse 2D array without any check.
+ *
+ * @param batch  [rows x matrix->col]
+ * @param matrix 
+ * @param result [rows x matrix->row] (Preallocated)
+ * @param rows   The number of batch rows to multiply.
+ */
+void BxSM_DotProduct_Unchecked(Type_t *batch, const Sparse_Matrix_t *matrix, Type_t *result, uint16_t rows)
+{
+    ANN_ASSERT( (batch != NULL) && (result != NULL), "BATCH_RESULT:NULL");
+    ANN_ASSERT( (batch->Matrix_t.col == matrix->col) && (result->Matrix_t.col == matrix->row), "BATCH_SPARSE_MATRIX:INVALID");
+
+    // (The sparse rows are small enough to stay in the cache between the samples)
+    for(uint16_t r = 0; r < rows; r++)
+        VxSM_DotProduct_Unchecked(batch->Matrix_t.Matrix[r], matrix, result->Matrix_t.Matrix[r]);
+
+    return;
+}//end BxSM_DotProduct_Unchecked.
+
+/**
+ * @brief Function to multiply 1D array by a 16 bits 2D array without any check.
+ * - Quick Math Recap:
+        Result[i] = Sum(j) Double(Values[i][j]) * Vector[j]
+        - The weights are widened in the loop & summed in double: Only the storage is 16 bits,
+          so the product reads a quarter of the weights bytes.
+        - Four independent sums hide the widening behind the additions latency.
+ *
+ * @param vector [matrix->col]
+ * @param matrix 
+ * @param vector_result [matrix->row] (Must not be the vector data)
+ */
+void VxHM_DotProduct_Unchecked(const double *vector, const Half_Matrix_t *matrix, double *vector_result)
+{
+    ANN_ASSERT( (vector != NULL) && (matrix != NULL) && (vector_result != NULL), "HALF_MATRIX:NULL");
+
+    const uint16_t col = matrix->col; // Temporary variable for readability.
+
+    for(uint16_t i = 0; i < matrix->row; i++)
+    {
+        const uint16_t *half = &matrix->values[(size_t) i * col];
+        double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+        uint16_t j = 0;
+
+        if(matrix->format == HALF_FORMAT_BF16)
+        {
+            for(; (j + 4) <= col; j += 4)
+            {
+                sum0 += matrix_bf16_to_double(half[j + 0]) * vector[j + 0];
+                sum1 += matrix_bf16_to_double(half[j + 1]) * vector[j + 1];
+                sum2 += matrix_bf16_to_double(half[j + 2]) * vector[j + 2];
+                sum3 += matrix_bf16_to_double(half[j + 3]) * vector[j + 3];
+            }
+
+            for(; j < col; j++)
+                sum0 += matrix_bf16_to_double(half[j]) * vector[j];
+        }
+        else
+        {
+            for(; (j + 4) <= col; j += 4)
+            {
+                sum0 += matrix_fp16_to_double(half[j + 0]) * vector[j + 0];
+                sum1 += matrix_fp16_to_double(half[j + 1]) * vector[j + 1];
+                sum2 += matrix_fp16_to_double(half[j + 2]) * vector[j + 2];
+                sum3 += matrix_fp16_to_double(half[j + 3]) * vector[j + 3];
+            }
+
+            for(; j < col; j++)
+                sum0 += matrix_fp16_to_double(half[j]) * vector[j];
+        }
+
+        vector_result[i] = (sum0 + sum1) + (sum2 + sum3);
+    }
+
+    return;
+}//end VxHM_DotProduct_Unchecked.
+
+/**
+ * @brief Function to multiply every row of a batch by a 16 bits 2D array without any check.
+ *          - Each weights row is widened once for the whole batch.
+ *
+ * @param batch  [rows x matrix->col]
+ * @param matrix 
+ * @param result [rows x matrix->row] (Preallocated)
+ * @param rows   The number of batch rows to multiply.
+ */
+void BxHM_DotProduct_Unchecked(Type_t *batch, const Half_Matrix_t *matrix, Type_t *result, uint16_t rows)
+{
+    ANN_ASSERT( (batch != NULL) && (result != NULL), "BATCH_RESULT:NULL");
+    ANN_ASSERT( (batch->Matrix_t.col == matrix->col) && (result->Matrix_t.col == matrix->row), "BATCH_HALF_MATRIX:INVALID");
+
+    const uint16_t col = matrix->col; // Temporary variable for readability.
+    double weights[MAX_MATRIX_COL];
+
+    for(uint16_t i = 0; i < matrix->row; i++)
+    {
+        matrix_half_row(&matrix->values[(size_t) i * col], matrix->format, col, weights);
+
+        uint16_t r = 0;
+
+        // Four samples at a time. (As BxM_DotProduct_Unchecked)
+        for(; (r + 4) <= rows; r += 4)
+        {
+            const double *x0 = batch->Matrix_t.Matrix[r + 0];
+            const double *x1 = batch->Matrix_t.Matrix[r + 1];
+            const double *x2 = batch->Matrix_t.Matrix[r + 2];
+            const double *x3 = batch->Matrix_t.Matrix[r + 3];
+            double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+
+            for(uint16_t j = 0; j < col; j++)
+            {
+                sum0 += weights[j] * x0[j];
+                sum1 += weights[j] * x1[j];
+                sum2 += weights[j] * x2[j];
+                sum3 += weights[j] * x3[j];
+            }
+
+            result->Matrix_t.Matrix[r + 0][i] = sum0;
+            result->Matrix_t.Matrix[r + 1][i] = sum1;
+            result->Matrix_t.Matrix[r + 2][i] = sum2;
+            result->Matrix_t.Matrix[r + 3][i] = sum3;
+        }
+
+        // The remaining samples.
+        for(; r < rows; r++)
+        {
+            const double *x = batch->Matrix_t.Matrix[r];
+            double sum = 0.0;
+
+            for(uint16_t j = 0; j < col; j++)
+                sum += weights[j] * x[j];
+
+            result->Matrix_t.Matrix[r][i] = sum;
+        }
+    }
+
+    return;
+}//end BxHM_DotProduct_Unchecked.
 
 /*
 ----------------------------------------------------------------
@@ -86,46 +635,546 @@ double *VxM_DotProduct(Type_t *vector, Type_t *matrix)
  */
 void dotProduct_Validity(Type_t *vector, Type_t *matrix)
 {
-    // - Error Handeling:
+    const ANN_Status_t status = dotProduct_Check(vector, matrix);
+
+    if(status != ANN_OK)
+        error_exit(CURRENT_C, ANN_Status_Name(status));
+
+    return;
+}//end dotProduct_Validity.
+
+/**
+ * @brief Function to check a (vector x matrix) dot product without exiting.
+ * 
+ * @param vector 
+ * @param matrix 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t dotProduct_Check(Type_t *vector, Type_t *matrix)
+{
     // Check if ethier the Vector or the Matrix is NULL.
     if( (vector == NULL) || (matrix == NULL) )
-        error_exit(CURRENT_C, "VECTOR_MATRIX:NULL");
-    // assert(vector != NULL); assert(matrix != NULL); // For strictly exit.
+        return ANN_ERROR_NULL;
     
-    // Data Checking.
     // 1- Check the vector elements.
-    // Check the vector data.
     if((vector->Vector_t.Vector) == NULL)
-        error_exit(CURRENT_C, "VECTOR->VECTOR:NULL");
-    // assert(vector->Vector != NULL); // For strictly exit.
+        return ANN_ERROR_NULL;
     
-    // Check the vector length & stricts.
     if(vector->Vector_t.len <= 0)
-    error_exit(CURRENT_C, "VECTOR_LEN:INVALID");
-    // assert(vector->len > 0) // For strictly exit.
+        return ANN_ERROR_INVALID;
     
-    // Check the vector length (MAX_VECTOR_LENGTH)
     if(vector->Vector_t.len > MAX_VECTOR_LEN)
-        error_exit(CURRENT_C, "VECTOR_LEN:MAX_LIMIT");
-    // assert(vector->len <= MAX_VECTOR_LEN); // For strictly exit.
+        return ANN_ERROR_LIMIT;
     
     // 2- Check the matrix elements.
     if((matrix->Matrix_t.Matrix) == NULL)
-        error_exit(CURRENT_C, "MATRIX->MATRIX:NULL");
-    // assert(matrix->Matrix != NULL) // For strictly exit.
+        return ANN_ERROR_NULL;
     
     if( (matrix->Matrix_t.row <= 0) || (matrix->Matrix_t.col <= 0) )
-        error_exit(CURRENT_C, "MATRIX_ROW_COL:INVALID");
-    // assert(matrix->row > 0); assert(matrix->col > 0); // For strictly exit.
+        return ANN_ERROR_INVALID;
     
     if( (matrix->Matrix_t.row > MAX_MATRIX_ROW) || (matrix->Matrix_t.col > MAX_MATRIX_COL) )
-        error_exit(CURRENT_C, "MATRIX_ROW_COL:MAX_LIMIT");
-    // assert(matrix->row < MAX_MATRIX_ROW); assert(matrix->col < MAX_MATRIX_COL); // For strictly exit.
+        return ANN_ERROR_LIMIT;
     
     // Dot product math validity conditions.
     if(matrix->Matrix_t.col != vector->Vector_t.len)
-        error_exit(CURRENT_C, "VECTOR_LEN_MATRIX_COL:INVALID");
-    // assert(matrix->col == vector->len); // For strictly exit.
-}//end dotProduct_Validity.
+        return ANN_ERROR_SHAPE;
+
+    return ANN_OK;
+}//end dotProduct_Check.
+
+/**
+ * @brief Function to check a (batch x matrix) dot product without exiting.
+ * 
+ * @param batch 
+ * @param matrix 
+ * @param result 
+ * @param rows 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t BxM_DotProduct_Check(Type_t *batch, Type_t *matrix, Type_t *result, uint16_t rows)
+{
+    if( (batch == NULL) || (matrix == NULL) || (result == NULL) )
+        return ANN_ERROR_NULL;
+
+    if( (batch->Matrix_t.Matrix == NULL) || (matrix->Matrix_t.Matrix == NULL) || (result->Matrix_t.Matrix == NULL) )
+        return ANN_ERROR_NULL;
+
+    if( (batch->Matrix_t.col != matrix->Matrix_t.col) || (result->Matrix_t.col != matrix->Matrix_t.row) ||
+        (batch->Matrix_t.row < rows) || (result->Matrix_t.row < rows) )
+        return ANN_ERROR_SHAPE;
+
+    return ANN_OK;
+}//end BxM_DotProduct_Check.
+
+/**
+ * @brief Function to check a borrowed vector without exiting.
+ * 
+ * @param view 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Tensor_View_Check(const Tensor_View_t *view)
+{
+    if( (view == NULL) || (view->data == NULL) )
+        return ANN_ERROR_NULL;
+
+    if(view->len <= 0)
+        return ANN_ERROR_INVALID;
+
+    if(view->len > MAX_VECTOR_LEN)
+        return ANN_ERROR_LIMIT;
+
+    return ANN_OK;
+}//end Tensor_View_Check.
+
+/**
+ * @brief Function to check a sparse vector without exiting.
+ * 
+ * @param sparse 
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Sparse_Vector_Check(const Sparse_Vector_t *sparse)
+{
+    if( (sparse == NULL) || ((sparse->nnz > 0) && (sparse->indices == NULL)) )
+        return ANN_ERROR_NULL;
+
+    if(sparse->len <= 0)
+        return ANN_ERROR_INVALID;
+
+    if(sparse->len > MAX_VECTOR_LEN)
+        return ANN_ERROR_LIMIT;
+
+    for(uint16_t k = 0; k < sparse->nnz; k++)
+    {
+        if(sparse->indices[k] >= sparse->len)
+            return ANN_ERROR_SHAPE;
+    }
+
+    return ANN_OK;
+}//end Sparse_Vector_Check.
+
+/*
+----------------------------------------------------------------
+!-                       TENSOR VIEW FUNCTIONS                 -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to make a borrowed vector. (Nothing is allocated nor copied)
+ * 
+ * @param data   (Must outlive the view)
+ * @param len 
+ * @param stride (0, 1: Contiguous)
+ * @return Tensor_View_t 
+ */
+Tensor_View_t Tensor_View(const double *data, uint16_t len, uint32_t stride)
+{
+    const Tensor_View_t view = {.data = data, .len = len, .stride = (stride > 1) ? (stride) : (1)};
+
+    return view;
+}//end Tensor_View.
+
+/**
+ * @brief Function to make a borrowed vector of a matrix row.
+ * 
+ * @param matrix 
+ * @param row 
+ * @return Tensor_View_t 
+ */
+Tensor_View_t Tensor_View_Row(Type_t *matrix, uint16_t row)
+{
+    // Error Handeling.
+    if( (matrix == NULL) || (matrix->Matrix_t.Matrix == NULL) )
+        error_exit(CURRENT_C, "MATRIX:NULL");
+
+    if(row >= matrix->Matrix_t.row)
+        error_exit(CURRENT_C, "ROW:OUT_OF_RANGE");
+
+    return Tensor_View(matrix->Matrix_t.Matrix[row], matrix->Matrix_t.col, 1);
+}//end Tensor_View_Row.
+
+/**
+ * @brief Function to make a borrowed sparse vector. (Nothing is allocated nor copied)
+ * 
+ * @param indices [nnz] (Must outlive the vector)
+ * @param values  [nnz] (NULL: All 1.0, one-hot)
+ * @param nnz 
+ * @param len The dense length.
+ * @return Sparse_Vector_t 
+ */
+Sparse_Vector_t Sparse_Vector(const uint16_t *indices, const double *values, uint16_t nnz, uint16_t len)
+{
+    const Sparse_Vector_t sparse = {.indices = indices, .values = values, .nnz = nnz, .len = len};
+
+    return sparse;
+}//end Sparse_Vector.
+
+/*
+----------------------------------------------------------------
+!-                       SPARSE MATRIX FUNCTIONS               -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to create a sparse copy of the non zero elements of a matrix.
+ *          - BSR keeps every block holding at least one non zero element.
+ * 
+ * @param matrix 
+ * @param format 
+ * @return Sparse_Matrix_t* (Sparse_Matrix_Free)
+ */
+Sparse_Matrix_t *Sparse_Matrix_Create(Type_t *matrix, Sparse_Format_t format)
+{
+    // Error Handeling.
+    if( (matrix == NULL) || (matrix->Matrix_t.Matrix == NULL) )
+        error_exit(CURRENT_C, "MATRIX:NULL");
+
+    if( (format != SPARSE_FORMAT_CSR) && (format != SPARSE_FORMAT_BSR) )
+        error_exit(CURRENT_C, "SPARSE_FORMAT:INVALID");
+
+    const uint16_t row = matrix->Matrix_t.row; // Temporary variable for readability.
+    const uint16_t col = matrix->Matrix_t.col; // Temporary variable for readability.
+    const uint8_t width = (format == SPARSE_FORMAT_BSR) ? (SPARSE_BLOCK_COLS) : (1); // Columns per stored element.
+
+    // Count the stored elements first. (Sized allocations)
+    uint32_t stored = 0, nnz = 0;
+
+    for(uint16_t i = 0; i < row; i++)
+    {
+        for(uint16_t j = 0; j < col; j += width)
+        {
+            bool non_zero = false;
+
+            for(uint16_t l = j; (l < (j + width)) && (l < col); l++)
+            {
+                if(matrix->Matrix_t.Matrix[i][l] != 0.0)
+                {
+                    non_zero = true;
+                    nnz++;
+                }
+            }
+
+            stored += (non_zero) ? (1) : (0);
+        }
+    }
+
+    // Create the sparse matrix in the heap. (Charged to the thread memory context)
+    const Memory_Category_t category = Memory_Current_Category();
+    Sparse_Matrix_t *sparse = (Sparse_Matrix_t *) Memory_Alloc(sizeof(Sparse_Matrix_t), category);
+
+    sparse->format = format;
+    sparse->row    = row;
+    sparse->col    = col;
+    sparse->stored = stored;
+    sparse->nnz    = nnz;
+
+    // (One element at least: No zero sized blocks)
+    sparse->row_start = (uint32_t *) Memory_Alloc(sizeof(uint32_t) * (row + 1), category);
+    sparse->columns   = (uint16_t *) Memory_Alloc(sizeof(uint16_t) * ((stored > 0) ? (stored) : (1)), category);
+    sparse->values    = (double *) Memory_Calloc(sizeof(double) * width * ((stored > 0) ? (stored) : (1)), category);
+
+    // Copy the non zero elements row by row.
+    uint32_t k = 0;
+
+    for(uint16_t i = 0; i < row; i++)
+    {
+        sparse->row_start[i] = k;
+
+        for(uint16_t j = 0; j < col; j += width)
+        {
+            bool non_zero = false;
+
+            for(uint16_t l = j; (l < (j + width)) && (l < col); l++)
+                non_zero = (non_zero) || (matrix->Matrix_t.Matrix[i][l] != 0.0);
+
+            if(!non_zero)
+                continue;
+
+            sparse->columns[k] = j;
+
+            // (The padding past col stays zero)
+            for(uint16_t l = j; (l < (j + width)) && (l < col); l++)
+                sparse->values[((size_t) k * width) + (l - j)] = matrix->Matrix_t.Matrix[i][l];
+
+            k++;
+        }
+    }
+
+    sparse->row_start[row] = k;
+
+    return sparse;
+}//end Sparse_Matrix_Create.
+
+/**
+ * @brief Function to free a sparse matrix.
+ * 
+ * @param sparse (NULL: Nothing)
+ */
+void Sparse_Matrix_Free(Sparse_Matrix_t *sparse)
+{
+    if(sparse == NULL)
+        return;
+
+    Memory_Free(sparse->row_start);
+    Memory_Free(sparse->columns);
+    Memory_Free(sparse->values);
+    Memory_Free(sparse);
+
+    return;
+}//end Sparse_Matrix_Free.
+
+/**
+ * @brief Function to get the bytes a product reads from a sparse matrix.
+ * 
+ * @param sparse 
+ * @return size_t 
+ */
+size_t Sparse_Matrix_Bytes(const Sparse_Matrix_t *sparse)
+{
+    const size_t width = (sparse->format == SPARSE_FORMAT_BSR) ? (SPARSE_BLOCK_COLS) : (1);
+
+    return (sizeof(uint32_t) * (sparse->row + 1)) + ((size_t) sparse->stored * (sizeof(uint16_t) + (sizeof(double) * width)));
+}//end Sparse_Matrix_Bytes.
+
+/*
+----------------------------------------------------------------
+!-                       HALF MATRIX FUNCTIONS                 -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to create a 16 bits copy of a matrix.
+ *          - fp16: The products expect finite values, |value| <= 65504. (Compress_Network checks it)
+ * 
+ * @param matrix 
+ * @param format 
+ * @return Half_Matrix_t* (Half_Matrix_Free)
+ */
+Half_Matrix_t *Half_Matrix_Create(Type_t *matrix, Half_Format_t format)
+{
+    // Error Handeling.
+    if( (matrix == NULL) || (matrix->Matrix_t.Matrix == NULL) )
+        error_exit(CURRENT_C, "MATRIX:NULL");
+
+    if( (format != HALF_FORMAT_BF16) && (format != HALF_FORMAT_FP16) )
+        error_exit(CURRENT_C, "HALF_FORMAT:INVALID");
+
+    // Create the half matrix in the heap. (Charged to the thread memory context)
+    const Memory_Category_t category = Memory_Current_Category();
+    Half_Matrix_t *half = (Half_Matrix_t *) Memory_Alloc(sizeof(Half_Matrix_t), category);
+
+    half->format = format;
+    half->row    = matrix->Matrix_t.row;
+    half->col    = matrix->Matrix_t.col;
+    half->values = (uint16_t *) Memory_Alloc(sizeof(uint16_t) * half->row * half->col, category);
+
+    for(uint16_t i = 0; i < half->row; i++)
+    {
+        for(uint16_t j = 0; j < half->col; j++)
+            half->values[((size_t) i * half->col) + j] = Half_Encode(matrix->Matrix_t.Matrix[i][j], format);
+    }
+
+    return half;
+}//end Half_Matrix_Create.
+
+/**
+ * @brief Function to free a 16 bits matrix.
+ * 
+ * @param half (NULL: Nothing)
+ */
+void Half_Matrix_Free(Half_Matrix_t *half)
+{
+    if(half == NULL)
+        return;
+
+    Memory_Free(half->values);
+    Memory_Free(half);
+
+    return;
+}//end Half_Matrix_Free.
+
+/**
+ * @brief Function to round a value to a 16 bits format. (Through the float rounding)
+ * 
+ * @param value 
+ * @param format 
+ * @return uint16_t 
+ */
+uint16_t Half_Encode(double value, Half_Format_t format)
+{
+    return (format == HALF_FORMAT_BF16) ? (matrix_float_to_bf16((float) value)) : (matrix_float_to_fp16((float) value));
+}//end Half_Encode.
+
+/**
+ * @brief Function to widen a 16 bits value. (Exact)
+ * 
+ * @param half 
+ * @param format 
+ * @return double 
+ */
+double Half_Decode(uint16_t half, Half_Format_t format)
+{
+    if(format == HALF_FORMAT_BF16)
+        return matrix_bf16_to_double(half);
+
+    // The full exponent: Inf & NaN.
+    if( (half & 0x7C00u) == 0x7C00u )
+        return ((half & 0x03FFu) != 0) ? (NAN) : ( ((half & 0x8000u) != 0) ? (-INFINITY) : (INFINITY) );
+
+    return matrix_fp16_to_double(half);
+}//end Half_Decode.
+
+/*
+----------------------------------------------------------------
+!-                       DECOMPOSITION FUNCTIONS               -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the singular value decomposition of a matrix. (One sided Jacobi)
+ * - Quick Math Recap:
+        Matrix = Sum(p < k) Singular[p] * Left[p] (outer product) Right[p]    (k = min(row, col))
+        - The k shorter vectors (rows or columns) are rotated two by two until they are all
+          orthogonal: Their norms are the singular values, the accumulated rotations & the
+          normalized vectors are the singular vectors. (Accurate even for the small values)
+        - Sorted by decreasing singular values: The first r terms are the closest rank r matrix.
+ *
+ * @param matrix   [row x col]
+ * @param left     [k x row] The left singular vectors as rows. (Preallocated)
+ * @param singular [k]       (Preallocated)
+ * @param right    [k x col] The right singular vectors as rows. (Preallocated)
+ * @return ANN_Status_t 
+ */
+ANN_Status_t Matrix_SVD(Type_t *matrix, Type_t *left, double *singular, Type_t *right)
+{
+    // Error Handeling.
+    if( (matrix == NULL) || (left == NULL) || (singular == NULL) || (right == NULL) )
+        return ANN_ERROR_NULL;
+
+    if( (matrix->Matrix_t.Matrix == NULL) || (left->Matrix_t.Matrix == NULL) || (right->Matrix_t.Matrix == NULL) )
+        return ANN_ERROR_NULL;
+
+    const uint16_t row = matrix->Matrix_t.row; // Temporary variable for readability.
+    const uint16_t col = matrix->Matrix_t.col; // Temporary variable for readability.
+
+    // Rotate the rows when they are the fewer vectors, else the columns.
+    const bool by_rows = (row <= col);
+    const uint16_t k   = (by_rows) ? (row) : (col);   // The rotated vectors.
+    const uint16_t len = (by_rows) ? (col) : (row);   // Their length.
+
+    if( (left->Matrix_t.row != k) || (left->Matrix_t.col != row) || (right->Matrix_t.row != k) || (right->Matrix_t.col != col) )
+        return ANN_ERROR_SHAPE;
+
+    // (k x len) The vectors & (k x k) the rotations. (Rows: Contiguous rotations)
+    double *vectors   = (double *) Memory_Alloc(sizeof(double) * ((size_t) k * len + (size_t) k * k), MEMORY_TEMPORARY);
+    double *rotations = vectors + ((size_t) k * len);
+    uint16_t *order   = (uint16_t *) Memory_Alloc(sizeof(uint16_t) * k, MEMORY_TEMPORARY);
+
+    for(uint16_t p = 0; p < k; p++)
+    {
+        for(uint16_t i = 0; i < len; i++)
+            vectors[((size_t) p * len) + i] = (by_rows) ? (matrix->Matrix_t.Matrix[p][i]) : (matrix->Matrix_t.Matrix[i][p]);
+
+        for(uint16_t q = 0; q < k; q++)
+            rotations[((size_t) p * k) + q] = (p == q) ? (1.0) : (0.0);
+    }
+
+    // Sweep over every pair until they are all orthogonal.
+    for(uint8_t sweep = 0; sweep < SVD_MAX_SWEEPS; sweep++)
+    {
+        double off = 0.0; // The largest |cos| between two vectors.
+
+        for(uint16_t p = 0; p + 1 < k; p++)
+        {
+            double *x = &vectors[(size_t) p * len];
+
+            for(uint16_t q = p + 1; q < k; q++)
+            {
+                double *y = &vectors[(size_t) q * len];
+                double alpha = 0.0, beta = 0.0, gamma = 0.0;
+
+                for(uint16_t i = 0; i < len; i++)
+                {
+                    alpha += x[i] * x[i];
+                    beta  += y[i] * y[i];
+                    gamma += x[i] * y[i];
+                }
+
+                if( (alpha == 0.0) || (beta == 0.0) || (fabs(gamma) <= (SVD_TOLERANCE * sqrt(alpha * beta))) )
+                    continue;
+
+                off = fmax(off, fabs(gamma) / sqrt(alpha * beta));
+
+                // The rotation zeroing the dot product.
+                const double zeta = (beta - alpha) / (2.0 * gamma);
+                const double t = ((zeta >= 0.0) ? (1.0) : (-1.0)) / (fabs(zeta) + sqrt(1.0 + (zeta * zeta)));
+                const double c = 1.0 / sqrt(1.0 + (t * t));
+                const double s = c * t;
+
+                for(uint16_t i = 0; i < len; i++)
+                {
+                    const double xi = x[i];
+                    x[i] = (c * xi) - (s * y[i]);
+                    y[i] = (s * xi) + (c * y[i]);
+                }
+
+                double *rx = &rotations[(size_t) p * k];
+                double *ry = &rotations[(size_t) q * k];
+
+                for(uint16_t i = 0; i < k; i++)
+                {
+                    const double xi = rx[i];
+                    rx[i] = (c * xi) - (s * ry[i]);
+                    ry[i] = (s * xi) + (c * ry[i]);
+                }
+            }
+        }
+
+        if(off <= SVD_TOLERANCE)
+            break;
+    }
+
+    // The norms, then the decreasing order. (Insertion sort: k <= MAX_MATRIX_ROW)
+    double norms[MAX_MATRIX_ROW];
+
+    for(uint16_t p = 0; p < k; p++)
+    {
+        double sum = 0.0;
+
+        for(uint16_t i = 0; i < len; i++)
+            sum += vectors[((size_t) p * len) + i] * vectors[((size_t) p * len) + i];
+
+        norms[p] = sqrt(sum);
+
+        uint16_t at = p;
+
+        for(; (at > 0) && (norms[order[at - 1]] < norms[p]); at--)
+            order[at] = order[at - 1];
+
+        order[at] = p;
+    }
+
+    // Matrix = Q (rows) or Matrix^T = Q (columns) times the orthogonal vectors.
+    for(uint16_t p = 0; p < k; p++)
+    {
+        const uint16_t from = order[p];
+        const double norm = norms[from];
+        Type_t *normalized = (by_rows) ? (right) : (left);  // The rotated vectors / their norms.
+        Type_t *rotated    = (by_rows) ? (left) : (right);  // The columns of the rotations.
+
+        singular[p] = norm;
+
+        for(uint16_t i = 0; i < len; i++)
+            normalized->Matrix_t.Matrix[p][i] = (norm > 0.0) ? (vectors[((size_t) from * len) + i] / norm) : (0.0);
+
+        for(uint16_t i = 0; i < k; i++)
+            rotated->Matrix_t.Matrix[p][i] = rotations[((size_t) from * k) + i];
+    }
+
+    Memory_Free(vectors);
+    Memory_Free(order);
+
+    return ANN_OK;
+}//end Matrix_SVD.
 
 //!====================================>.END
\ No newline at end of file
@@ -0,0 +1,364 @@
+/**
+ * @file MEMORY.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Memory accounting functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "MEMORY.H"
+#define CURRENT_C "MEMORY.C"
+
+/*
+    - Accounting overview:
+        Every library block starts with a header holding its size, category & owner:
+            [Header (MEMORY_HEADER_SIZE)][User bytes ...]
+                                         ^ Returned pointer.
+        Memory_Free reads the header back, so a block is always uncharged from the
+        counters it was charged to. (The process & its network)
+
+    - The blocks come from the thread local size classes pool. (POOL.c)
+      The counters hold the requested bytes, not the class sizes.
+
+    - Owner & category of create_vector/create_matrix:
+        The thread context set by Memory_Enter. The network functions enter their own
+        context while they allocate, so their blocks are charged to the network.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+// The process counters.
+static Memory_Stats_t memory_process_stats;
+
+// The allocation context of the thread.
+static _Thread_local Memory_Context_t memory_context = {.owner = NULL, .category = MEMORY_OTHER};
+
+static const char *memory_categories_names[MEMORY_CATEGORIES_NUM] =
+{
+    "OTHER", "WEIGHTS", "ACTIVATIONS", "GRADIENTS", "OPTIMIZER", "TEMPORARY", "DATASET"
+};
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for the header of a block
+ *
+ */
+typedef struct _Memory_Header_t
+{
+    Memory_Stats_t *owner;
+    size_t size;
+    uint32_t category;
+    uint32_t magic;
+    uint8_t pool_class;
+}Memory_Header_t;
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to raise a peak counter to a value. (Lock free)
+ *
+ * @param peak
+ * @param value
+ */
+static inline void memory_raise_peak(atomic_int_fast64_t *peak, int_fast64_t value)
+{
+    int_fast64_t current_peak = atomic_load_explicit(peak, memory_order_relaxed);
+
+    while( (value > current_peak) &&
+           (atomic_compare_exchange_weak_explicit(peak, &current_peak, value, memory_order_relaxed, memory_order_relaxed) == false) );
+
+    return;
+}//end memory_raise_peak.
+
+/**
+ * @brief Function to charge (or uncharge: negative size) a block to a set of counters.
+ *
+ * @param stats
+ * @param category
+ * @param size
+ */
+static void memory_charge(Memory_Stats_t *stats, Memory_Category_t category, int64_t size)
+{
+    const int_fast64_t category_bytes = atomic_fetch_add_explicit(&stats->current[category], size, memory_order_relaxed) + size;
+    const int_fast64_t total_bytes    = atomic_fetch_add_explicit(&stats->total_current, size, memory_order_relaxed) + size;
+
+    if(size > 0)
+    {
+        memory_raise_peak(&stats->peak[category], category_bytes);
+        memory_raise_peak(&stats->total_peak, total_bytes);
+        atomic_fetch_add_explicit(&stats->allocations, 1, memory_order_relaxed);
+    }
+    else
+    {
+        atomic_fetch_add_explicit(&stats->frees, 1, memory_order_relaxed);
+    }
+
+    return;
+}//end memory_charge.
+
+/**
+ * @brief Function to take a snapshot of a set of counters.
+ *
+ * @param stats
+ * @param report
+ */
+static void memory_snapshot(Memory_Stats_t *stats, Memory_Report_t *report)
+{
+    for(uint8_t c = 0; c < MEMORY_CATEGORIES_NUM; c++)
+    {
+        report->current[c] = atomic_load(&stats->current[c]);
+        report->peak[c]    = atomic_load(&stats->peak[c]);
+    }
+
+    report->total_current = atomic_load(&stats->total_current);
+    report->total_peak    = atomic_load(&stats->total_peak);
+    report->allocations   = atomic_load(&stats->allocations);
+    report->frees         = atomic_load(&stats->frees);
+
+    return;
+}//end memory_snapshot.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to allocate a counted block. (Owner: The thread context)
+ *
+ * @param size
+ * @param category
+ * @return void* (Free it with Memory_Free)
+ */
+void *Memory_Alloc(size_t size, Memory_Category_t category)
+{
+    // Error Handeling.
+    if(category >= MEMORY_CATEGORIES_NUM)
+        error_exit(CURRENT_C, "MEMORY_CATEGORY:INVALID");
+
+    uint8_t pool_class;
+    Memory_Header_t *header = (Memory_Header_t *) Pool_Get(MEMORY_HEADER_SIZE + size, &pool_class);
+
+    header->owner      = memory_context.owner;
+    header->size       = size;
+    header->category   = category;
+    header->magic      = MEMORY_BLOCK_MAGIC;
+    header->pool_class = pool_class;
+
+    memory_charge(&memory_process_stats, category, (int64_t) size);
+
+    if(header->owner != NULL)
+        memory_charge(header->owner, category, (int64_t) size);
+
+    return (uint8_t *) header + MEMORY_HEADER_SIZE;
+}//end Memory_Alloc.
+
+/**
+ * @brief Function to allocate a zeroed counted block.
+ *
+ * @param size
+ * @param category
+ * @return void* (Free it with Memory_Free)
+ */
+void *Memory_Calloc(size_t size, Memory_Category_t category)
+{
+    void *block = Memory_Alloc(size, category);
+
+    memset(block, 0, size);
+
+    return block;
+}//end Memory_Calloc.
+
+/**
+ * @brief Function to free a block of Memory_Alloc & uncharge it.
+ *
+ * @param block (NULL: Nothing)
+ */
+void Memory_Free(void *block)
+{
+    if(block == NULL)
+        return;
+
+    Memory_Header_t *header = (Memory_Header_t *) ((uint8_t *) block - MEMORY_HEADER_SIZE);
+
+    // A block that doesn't come from Memory_Alloc. (Or freed twice)
+    if(header->magic != MEMORY_BLOCK_MAGIC)
+        error_exit(CURRENT_C, "MEMORY_BLOCK:INVALID");
+
+    header->magic = 0;
+
+    memory_charge(&memory_process_stats, header->category, -(int64_t) header->size);
+
+    if(header->owner != NULL)
+        memory_charge(header->owner, header->category, -(int64_t) header->size);
+
+    Pool_Put(header, header->pool_class);
+
+    return;
+}//end Memory_Free.
+
+/**
+ * @brief Function to get the counters of the process.
+ *
+ * @param report
+ */
+void Memory_Get_Process_Report(Memory_Report_t *report)
+{
+    // Error Handeling.
+    if(report == NULL)
+        error_exit(CURRENT_C, "REPORT:NULL");
+
+    memory_snapshot(&memory_process_stats, report);
+
+    return;
+}//end Memory_Get_Process_Report.
+
+/**
+ * @brief Function to get the counters of a network.
+ *
+ * @param dnn_network
+ * @param report
+ */
+void Memory_Get_Network_Report(DNN_Network *dnn_network, Memory_Report_t *report)
+{
+    // Error Handeling.
+    if( (dnn_network == NULL) || (report == NULL) )
+        error_exit(CURRENT_C, "DNN_NETWORK_REPORT:NULL");
+
+    memory_snapshot(dnn_network->network_layers->Memory_stats, report);
+
+    return;
+}//end Memory_Get_Network_Report.
+
+/**
+ * @brief Function to print the counters of a network. (NULL: Of the process)
+ *
+ * @param dnn_network
+ */
+void print_memory_report(DNN_Network *dnn_network)
+{
+    Memory_Report_t report;
+
+    if(dnn_network == NULL)
+        Memory_Get_Process_Report(&report);
+    else
+        Memory_Get_Network_Report(dnn_network, &report);
+
+    printf("\n%-12s %14s %14s\n", "CATEGORY", "CURRENT (B)", "PEAK (B)");
+
+    for(uint8_t c = 0; c < MEMORY_CATEGORIES_NUM; c++)
+    {
+        if(report.peak[c] == 0)
+            continue;
+
+        printf("%-12s %14lld %14lld\n", Memory_Category_Name(c), (long long) report.current[c], (long long) report.peak[c]);
+    }
+
+    printf("%-12s %14lld %14lld\n", "TOTAL", (long long) report.total_current, (long long) report.total_peak);
+    printf("ALLOCATIONS: %llu, FREES: %llu\n", (unsigned long long) report.allocations, (unsigned long long) report.frees);
+
+    return;
+}//end print_memory_report.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to set the allocation context of the thread.
+ *
+ * @param owner The counters to charge besides the process. (NULL: None)
+ * @param category
+ * @return Memory_Context_t The previous context. (Give it to Memory_Leave)
+ */
+Memory_Context_t Memory_Enter(Memory_Stats_t *owner, Memory_Category_t category)
+{
+    const Memory_Context_t previous = memory_context;
+
+    memory_context.owner    = owner;
+    memory_context.category = category;
+
+    return previous;
+}//end Memory_Enter.
+
+/**
+ * @brief Function to restore the allocation context of the thread.
+ *
+ * @param previous
+ */
+void Memory_Leave(Memory_Context_t previous)
+{
+    memory_context = previous;
+
+    return;
+}//end Memory_Leave.
+
+/**
+ * @brief Function to get the category of the thread context.
+ *
+ * @return Memory_Category_t
+ */
+Memory_Category_t Memory_Current_Category(void)
+{
+    return memory_context.category;
+}//end Memory_Current_Category.
+
+/**
+ * @brief Function to create the zeroed counters of a network. (Not counted itself)
+ *
+ * @return Memory_Stats_t*
+ */
+Memory_Stats_t *Memory_Create_Stats(void)
+{
+    Memory_Stats_t *stats = (Memory_Stats_t *) calloc(1, sizeof(Memory_Stats_t));
+
+    if(stats == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    return stats;
+}//end Memory_Create_Stats.
+
+/**
+ * @brief Function to get the number of allocations done by the process.
+ *          - The same number before & after a code section: It doesn't allocate. (Steady state)
+ *
+ * @return uint64_t
+ */
+uint64_t Memory_Allocations(void)
+{
+    return atomic_load(&memory_process_stats.allocations);
+}//end Memory_Allocations.
+
+/**
+ * @brief Function to get the name of a category.
+ *
+ * @param category
+ * @return const char*
+ */
+const char *Memory_Category_Name(Memory_Category_t category)
+{
+    return (category < MEMORY_CATEGORIES_NUM) ? (memory_categories_names[category]) : ("UNKNOWN");
+}//end Memory_Category_Name.
+
+//!=============================> .END
@@ -0,0 +1,261 @@
+/**
+ * @file MODEL.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Model files (save & load trained networks) functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "MODEL.H"
+#define CURRENT_C "MODEL.C"
+
+/*
+    - Model files overview:
+        Save_Network writes the shapes, the function kinds & the trained weights of a network.
+        Load_Network creates the same network from them. (Its topology & config are owned by
+        the network & freed by Free_Network)
+
+    - The loss & optimizer functions are saved as their index in the tables below.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define MODEL_LOSSES_NUM     ((const uint8_t) 6)
+#define MODEL_OPTIMIZERS_NUM ((const uint8_t) 1)
+#define MODEL_NO_FUNCTION    ((const uint8_t) 0xFF)
+
+static double (*const model_losses[MODEL_LOSSES_NUM]) (Type_t *, Type_t *) =
+{
+    &MSE, &MAE, &BC, &BCE, &MCC, &MCCE
+};
+
+static void (*const model_optimizers[MODEL_OPTIMIZERS_NUM]) (DNN_Network *) =
+{
+    &GradientDescent
+};
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the saved index of a loss function.
+ *
+ * @param loss_function
+ * @return uint8_t (MODEL_NO_FUNCTION: Not a library loss)
+ */
+static uint8_t model_loss_index(double (*loss_function) (Type_t *, Type_t *))
+{
+    for(uint8_t i = 0; i < MODEL_LOSSES_NUM; i++)
+    {
+        if(model_losses[i] == loss_function)
+            return i;
+    }
+
+    return MODEL_NO_FUNCTION;
+}//end model_loss_index.
+
+/**
+ * @brief Function to get the saved index of an optimizer function.
+ *
+ * @param optimizer_function
+ * @return uint8_t (MODEL_NO_FUNCTION: Not a library optimizer)
+ */
+static uint8_t model_optimizer_index(void (*optimizer_function) (DNN_Network *))
+{
+    for(uint8_t i = 0; i < MODEL_OPTIMIZERS_NUM; i++)
+    {
+        if(model_optimizers[i] == optimizer_function)
+            return i;
+    }
+
+    return MODEL_NO_FUNCTION;
+}//end model_optimizer_index.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to save a network into a model file.
+ *
+ * @param dnn_network
+ * @param path
+ * @return ANN_Status_t (ANN_ERROR_INVALID: Custom functions, ANN_ERROR_IO: File errors)
+ */
+ANN_Status_t Save_Network(DNN_Network *dnn_network, const char *path)
+{
+    if( (dnn_network == NULL) || (path == NULL) )
+        return ANN_ERROR_NULL;
+
+    Network_Topology_t *network_topology = dnn_network->network_topology; // (Temporary variable for readbility).
+    const Activation_Plan_t plan = dnn_network->network_layers->Activation_plan;
+
+    // Only the library functions can be found again by Load_Network.
+    const uint8_t loss      = model_loss_index(network_topology->loss_function);
+    const uint8_t optimizer = model_optimizer_index(network_topology->optimizer_function);
+
+    if( (plan.hidden == ACTIVATION_CUSTOM) || (plan.output == ACTIVATION_CUSTOM) ||
+        (loss == MODEL_NO_FUNCTION) || (optimizer == MODEL_NO_FUNCTION) )
+        return ANN_ERROR_INVALID;
+
+    Model_Header_t header;
+    memset(&header, 0, sizeof(Model_Header_t));
+    memcpy(header.magic, MODEL_FILE_MAGIC, sizeof(header.magic));
+    header.version            = MODEL_FILE_VERSION;
+    header.input_dense        = network_topology->input_layer_dense;
+    header.output_dense       = network_topology->output_layer_dense;
+    header.hidden_layer_num   = network_topology->hidden_layer_num;
+    header.hidden_layer_dense = network_topology->hidden_layer_dense;
+    header.activation         = (uint8_t) plan.hidden;
+    header.output_activation  = (uint8_t) plan.output;
+    header.loss               = loss;
+    header.optimizer          = optimizer;
+    header.activation_alpha   = network_topology->activation_alpha;
+    header.learning_rate      = dnn_network->network_config->learning_rate;
+    header.seed               = dnn_network->network_config->seed;
+
+    FILE *model_file = fopen(path, "wb");
+
+    if(model_file == NULL)
+        return ANN_ERROR_IO;
+
+    bool written = (fwrite(&header, sizeof(Model_Header_t), 1, model_file) == 1);
+
+    // The weights, row by row.
+    for(uint16_t layer = 0; (written) && (layer <= header.hidden_layer_num); layer++)
+    {
+        Type_t *layer_weights = dnn_network->network_layers->Layer_weights[layer].layer_weights;
+
+        for(uint16_t r = 0; (written) && (r < layer_weights->Matrix_t.row); r++)
+            written = (fwrite(layer_weights->Matrix_t.Matrix[r], sizeof(double), layer_weights->Matrix_t.col, model_file) == layer_weights->Matrix_t.col);
+    }
+
+    // The biases.
+    Type_t *biases = dnn_network->network_layers->Layers_biases->layers_biases;
+
+    if(written)
+        written = (fwrite(biases->Vector_t.Vector, sizeof(double), biases->Vector_t.len, model_file) == biases->Vector_t.len);
+
+    if(fclose(model_file) != 0)
+        written = false;
+
+    return (written) ? (ANN_OK) : (ANN_ERROR_IO);
+}//end Save_Network.
+
+/**
+ * @brief Function to create a network from a model file.
+ *          - Free it with Free_Network. (Its topology & config too)
+ *
+ * @param path
+ * @param dnn_network (NULL on errors)
+ * @return ANN_Status_t (ANN_ERROR_INVALID: Not a model file, ANN_ERROR_IO: File errors)
+ */
+ANN_Status_t Load_Network(const char *path, DNN_Network **dnn_network)
+{
+    if( (path == NULL) || (dnn_network == NULL) )
+        return ANN_ERROR_NULL;
+
+    *dnn_network = NULL;
+
+    FILE *model_file = fopen(path, "rb");
+
+    if(model_file == NULL)
+        return ANN_ERROR_IO;
+
+    // Check the header.
+    Model_Header_t header;
+
+    if(fread(&header, sizeof(Model_Header_t), 1, model_file) != 1)
+    {
+        fclose(model_file);
+        return ANN_ERROR_IO;
+    }
+
+    if( (memcmp(header.magic, MODEL_FILE_MAGIC, sizeof(header.magic)) != 0) || (header.version != MODEL_FILE_VERSION) ||
+        (header.activation == ACTIVATION_CUSTOM) || (header.activation >= ACTIVATIONS_NUM) ||
+        (header.output_activation == ACTIVATION_CUSTOM) || (header.output_activation >= ACTIVATIONS_NUM) ||
+        (header.loss >= MODEL_LOSSES_NUM) || (header.optimizer >= MODEL_OPTIMIZERS_NUM) )
+    {
+        fclose(model_file);
+        return ANN_ERROR_INVALID;
+    }
+
+    // The settings of the network. (Its const fields are set once, here)
+    const Network_Settings_t loaded_settings =
+    {
+        .network_topology = {.input_layer_dense  = header.input_dense,
+                             .output_layer_dense = header.output_dense,
+                             .hidden_layer_num   = header.hidden_layer_num,
+                             .hidden_layer_dense = header.hidden_layer_dense,
+                             .activation         = (Activation_t) header.activation,
+                             .output_activation  = (Activation_t) header.output_activation,
+                             .activation_alpha   = header.activation_alpha,
+                             .loss_function      = model_losses[header.loss],
+                             .optimizer_function = model_optimizers[header.optimizer]},
+        .network_config   = {.learning_rate = header.learning_rate,
+                             .epochs        = 1,
+                             .seed          = header.seed}
+    };
+
+    Network_Settings_t *settings = (Network_Settings_t *) Memory_Alloc(sizeof(Network_Settings_t), MEMORY_OTHER);
+    memcpy(settings, &loaded_settings, sizeof(Network_Settings_t));
+
+    DNN_Network *new_dnnNetwork;
+    const ANN_Status_t status = Create_Network_Checked(&settings->network_topology, &settings->network_config, &new_dnnNetwork);
+
+    if(status != ANN_OK)
+    {
+        Memory_Free(settings);
+        fclose(model_file);
+        return status;
+    }
+
+    new_dnnNetwork->network_layers->Owned_settings = settings;
+
+    // Read the weights over the initialized ones.
+    bool read = true;
+
+    for(uint16_t layer = 0; (read) && (layer <= header.hidden_layer_num); layer++)
+    {
+        Type_t *layer_weights = new_dnnNetwork->network_layers->Layer_weights[layer].layer_weights;
+
+        for(uint16_t r = 0; (read) && (r < layer_weights->Matrix_t.row); r++)
+            read = (fread(layer_weights->Matrix_t.Matrix[r], sizeof(double), layer_weights->Matrix_t.col, model_file) == layer_weights->Matrix_t.col);
+    }
+
+    Type_t *biases = new_dnnNetwork->network_layers->Layers_biases->layers_biases;
+
+    if(read)
+        read = (fread(biases->Vector_t.Vector, sizeof(double), biases->Vector_t.len, model_file) == biases->Vector_t.len);
+
+    fclose(model_file);
+
+    // A truncated file.
+    if(read == false)
+    {
+        Free_Network(new_dnnNetwork);
+        return ANN_ERROR_IO;
+    }
+
+    Weights_Changed(new_dnnNetwork);
+
+    *dnn_network = new_dnnNetwork;
+
+    return ANN_OK;
+}//end Load_Network.
+
+//!=============================> .END
@@ -0,0 +1,317 @@
+/**
+ * @file POOL.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Thread local size classes pool functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "POOL.H"
+#define CURRENT_C "POOL.C"
+
+/*
+    - Pool overview:
+        Memory_Alloc takes its blocks from here. A block is rounded up to a power of 2 class
+        (64 .. 8192 bytes) & Memory_Free gives it back to the free list of its class in the
+        calling thread cache. The next block of the same class is taken from that list without
+        any lock or heap call, so creating & freeing networks again & again stays off the heap.
+        (Every vector, matrix row & struct of the library fits in a class)
+
+    - A thread keeps at most POOL_MAX_CACHED_BYTES free bytes per class, the extra blocks go
+      back to the heap. The cache of a thread is released when it exits, or by Pool_Trim.
+
+    - A block freed by another thread than its allocator joins the cache of the freeing thread.
+
+    - Built with ANN_DISABLE_POOL, every block comes from & goes back to the heap. (Memory checkers)
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for a free block. (The link is written in the block itself)
+ *
+ */
+typedef struct _Pool_Block_t
+{
+    struct _Pool_Block_t *next;
+}Pool_Block_t;
+
+/**
+ * @brief Struct for the cache of a thread
+ *
+ */
+typedef struct _Pool_Cache_t
+{
+    Pool_Block_t *free_lists[POOL_CLASSES_NUM];
+    uint32_t free_counts[POOL_CLASSES_NUM];
+
+    uint64_t hits;
+    uint64_t misses;
+
+    bool registered;
+}Pool_Cache_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+static _Thread_local Pool_Cache_t pool_cache;
+
+// Releases the cache of an exiting thread.
+static pthread_key_t pool_exit_key;
+static pthread_once_t pool_exit_once = PTHREAD_ONCE_INIT;
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to allocate an aligned block from the heap.
+ *
+ * @param size
+ * @return void*
+ */
+static void *pool_heap_alloc(size_t size)
+{
+#ifdef _WIN32
+    void *block = _aligned_malloc(size, POOL_ALIGNMENT);
+#else
+    void *block = NULL;
+
+    if(posix_memalign(&block, POOL_ALIGNMENT, size) != 0)
+        block = NULL;
+#endif
+
+    if(block == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    return block;
+}//end pool_heap_alloc.
+
+/**
+ * @brief Function to give an aligned block back to the heap.
+ *
+ * @param block
+ */
+static void pool_heap_free(void *block)
+{
+#ifdef _WIN32
+    _aligned_free(block);
+#else
+    free(block);
+#endif
+
+    return;
+}//end pool_heap_free.
+
+/**
+ * @brief Function to get the class of a size.
+ *
+ * @param size
+ * @return uint8_t (POOL_NO_CLASS: Bigger than the last class)
+ */
+static inline uint8_t pool_class_of(size_t size)
+{
+    uint8_t class_index = 0;
+
+    while( (class_index < POOL_CLASSES_NUM) && (Pool_Class_Size(class_index) < size) )
+        class_index++;
+
+    return (class_index < POOL_CLASSES_NUM) ? (class_index) : (POOL_NO_CLASS);
+}//end pool_class_of.
+
+/**
+ * @brief Function to release the cache of an exiting thread.
+ *
+ * @param cache
+ */
+static void pool_thread_exit(void *cache)
+{
+    (void) cache;
+    Pool_Trim();
+
+    return;
+}//end pool_thread_exit.
+
+static void pool_exit_key_create(void)
+{
+    if(pthread_key_create(&pool_exit_key, pool_thread_exit) != 0)
+        error_exit(CURRENT_C, "POOL_KEY:CREATE_FAILED");
+
+    return;
+}//end pool_exit_key_create.
+
+/**
+ * @brief Function to release the cache of the thread when it exits. (Once per thread)
+ *
+ */
+static void pool_register_thread(void)
+{
+    pthread_once(&pool_exit_once, pool_exit_key_create);
+    pthread_setspecific(pool_exit_key, &pool_cache);
+
+    pool_cache.registered = true;
+
+    return;
+}//end pool_register_thread.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get a POOL_ALIGNMENT aligned block of at least (size) bytes.
+ *
+ * @param size
+ * @param class_index Set to the class of the block. (Give it to Pool_Put)
+ * @return void*
+ */
+void *Pool_Get(size_t size, uint8_t *class_index)
+{
+    // Error Handeling.
+    if(class_index == NULL)
+        error_exit(CURRENT_C, "CLASS_INDEX:NULL");
+
+#ifdef ANN_DISABLE_POOL
+    *class_index = POOL_NO_CLASS;
+    return pool_heap_alloc(size);
+#else
+    const uint8_t block_class = pool_class_of(size);
+    *class_index = block_class;
+
+    if(block_class == POOL_NO_CLASS)
+    {
+        pool_cache.misses++;
+        return pool_heap_alloc(size);
+    }
+
+    Pool_Block_t *block = pool_cache.free_lists[block_class];
+
+    if(block != NULL)
+    {
+        pool_cache.free_lists[block_class] = block->next;
+        pool_cache.free_counts[block_class]--;
+        pool_cache.hits++;
+
+        return block;
+    }
+
+    pool_cache.misses++;
+
+    return pool_heap_alloc(Pool_Class_Size(block_class));
+#endif
+}//end Pool_Get.
+
+/**
+ * @brief Function to give a block of Pool_Get back. (To the calling thread cache)
+ *
+ * @param block (NULL: Nothing)
+ * @param class_index The class set by Pool_Get.
+ */
+void Pool_Put(void *block, uint8_t class_index)
+{
+    if(block == NULL)
+        return;
+
+    // Big blocks & full classes go back to the heap.
+    if( (class_index >= POOL_CLASSES_NUM) ||
+        ((size_t) (pool_cache.free_counts[class_index] + 1) * Pool_Class_Size(class_index) > POOL_MAX_CACHED_BYTES) )
+    {
+        pool_heap_free(block);
+        return;
+    }
+
+    if(pool_cache.registered == false)
+        pool_register_thread();
+
+    Pool_Block_t *free_block = (Pool_Block_t *) block;
+
+    free_block->next = pool_cache.free_lists[class_index];
+    pool_cache.free_lists[class_index] = free_block;
+    pool_cache.free_counts[class_index]++;
+
+    return;
+}//end Pool_Put.
+
+/**
+ * @brief Function to give the free blocks of the calling thread back to the heap.
+ *
+ */
+void Pool_Trim(void)
+{
+    for(uint8_t c = 0; c < POOL_CLASSES_NUM; c++)
+    {
+        Pool_Block_t *block = pool_cache.free_lists[c];
+
+        while(block != NULL)
+        {
+            Pool_Block_t *next = block->next;
+            pool_heap_free(block);
+            block = next;
+        }
+
+        pool_cache.free_lists[c]  = NULL;
+        pool_cache.free_counts[c] = 0;
+    }
+
+    return;
+}//end Pool_Trim.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the pool counters of the calling thread.
+ *
+ * @param stats
+ */
+void Pool_Get_Stats(Pool_Stats_t *stats)
+{
+    // Error Handeling.
+    if(stats == NULL)
+        error_exit(CURRENT_C, "POOL_STATS:NULL");
+
+    stats->hits          = pool_cache.hits;
+    stats->misses        = pool_cache.misses;
+    stats->cached_blocks = 0;
+    stats->cached_bytes  = 0;
+
+    for(uint8_t c = 0; c < POOL_CLASSES_NUM; c++)
+    {
+        stats->cached_blocks += pool_cache.free_counts[c];
+        stats->cached_bytes  += (uint64_t) pool_cache.free_counts[c] * Pool_Class_Size(c);
+    }
+
+    return;
+}//end Pool_Get_Stats.
+
+/**
+ * @brief Function to get the block size of a class.
+ *
+ * @param class_index
+ * @return size_t
+ */
+size_t Pool_Class_Size(uint8_t class_index)
+{
+    return (size_t) 1 << (POOL_MIN_CLASS_SHIFT + class_index);
+}//end Pool_Class_Size.
+
+//!=============================> .END
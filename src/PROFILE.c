@@ -0,0 +1,236 @@
+/**
+ * @file PROFILE.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Per layer profiling counters functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "PROFILE.H"
+#define CURRENT_C "PROFILE.C"
+
+/*
+    - Profiling overview:
+        Built with ANN_ENABLE_PROFILING, the forward pass, the back propagation & the
+        optimizer add (ticks, flops, bytes) to a counter per (layer, phase) of the network.
+        Built without it, the PROFILE_BEGIN/PROFILE_END macros are empty & the counters
+        are never created.
+
+    - The ticks are read from the time stamp counter. (A few cycles per read, no system call)
+      They are converted to nanoseconds with a rate measured once against the monotonic clock.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+// Time used to measure the ticks rate.
+#define PROFILE_CALIBRATION_NS ((const uint64_t) 10000000)
+
+static const char *profile_phases_names[PROFILE_PHASES_NUM] =
+{
+    "GEMM", "BIAS", "ACTIVATION", "DROPOUT", "LOSS", "GRADIENT", "DELTA", "OPTIMIZER"
+};
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get a copy of the profiling counters of a network.
+ *          - All zeros & (enabled = false) if the library was built without ANN_ENABLE_PROFILING.
+ *
+ * @param dnn_network
+ * @param stats
+ */
+void Get_Network_Stats(DNN_Network *dnn_network, Network_Stats_t *stats)
+{
+    // Error Handeling.
+    if( (dnn_network == NULL) || (stats == NULL) )
+        error_exit(CURRENT_C, "DNN_NETWORK_STATS:NULL");
+
+    Network_Stats_t *network_stats = dnn_network->network_layers->Network_stats; // (Temporary variable for readbility).
+
+    if(network_stats == NULL)
+    {
+        memset(stats, 0, sizeof(Network_Stats_t));
+        stats->layers_num = dnn_network->network_topology->hidden_layer_num + 1;
+        return;
+    }
+
+    memcpy(stats, network_stats, sizeof(Network_Stats_t));
+    stats->ticks_per_ns = Profile_Ticks_Per_Ns();
+
+    return;
+}//end Get_Network_Stats.
+
+/**
+ * @brief Function to clear the profiling counters of a network.
+ *
+ * @param dnn_network
+ */
+void Reset_Network_Stats(DNN_Network *dnn_network)
+{
+    // Error Handeling.
+    if(dnn_network == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    Network_Stats_t *network_stats = dnn_network->network_layers->Network_stats; // (Temporary variable for readbility).
+
+    if(network_stats != NULL)
+        memset(network_stats->counters, 0, sizeof(network_stats->counters));
+
+    return;
+}//end Reset_Network_Stats.
+
+/**
+ * @brief Function to print the profiling counters of a network. (One line per used (layer, phase))
+ *
+ * @param dnn_network
+ */
+void print_network_stats(DNN_Network *dnn_network)
+{
+    Network_Stats_t stats;
+    Get_Network_Stats(dnn_network, &stats);
+
+    if(stats.enabled == false)
+    {
+        printf("\n NETWORK_STATS: Built without ANN_ENABLE_PROFILING\n");
+        return;
+    }
+
+    printf("\n%-6s %-11s %12s %14s %12s %10s %10s\n", "LAYER", "PHASE", "CALLS", "TOTAL (us)", "NS/CALL", "GFLOP/s", "GB/s");
+
+    for(uint16_t layer = 0; layer < stats.layers_num; layer++)
+    {
+        for(uint16_t phase = 0; phase < PROFILE_PHASES_NUM; phase++)
+        {
+            const Profile_Counter_t *counter = &stats.counters[layer][phase];
+
+            if(counter->calls == 0)
+                continue;
+
+            const double ns = (double) counter->ticks / stats.ticks_per_ns;
+
+            printf("%-6u %-11s %12llu %14.2f %12.1f %10.3f %10.3f\n", layer, Profile_Phase_Name(phase),
+                   (unsigned long long) counter->calls, ns * 1e-3, ns / counter->calls,
+                   (ns > 0.0) ? (counter->flops / ns) : (0.0), (ns > 0.0) ? (counter->bytes / ns) : (0.0));
+        }
+    }
+
+    return;
+}//end print_network_stats.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to create the zeroed counters of a network. (NULL without ANN_ENABLE_PROFILING)
+ *
+ * @param layers_num The number of weights layers.
+ * @return Network_Stats_t*
+ */
+Network_Stats_t *Profile_Create_Stats(uint16_t layers_num)
+{
+#ifdef ANN_ENABLE_PROFILING
+    if( (layers_num <= 0) || (layers_num > MAX_HIDDEN_LAYER_NUM + 1) )
+        error_exit(CURRENT_C, "LAYERS_NUM:INVALID");
+
+    Network_Stats_t *stats = (Network_Stats_t *) calloc(1, sizeof(Network_Stats_t));
+
+    if(stats == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    stats->enabled    = true;
+    stats->layers_num = layers_num;
+
+    // Calibrate now, not inside the first profiled pass.
+    stats->ticks_per_ns = Profile_Ticks_Per_Ns();
+
+    return stats;
+#else
+    (void) layers_num;
+
+    return NULL;
+#endif
+}//end Profile_Create_Stats.
+
+/**
+ * @brief Function to get the name of a phase.
+ *
+ * @param phase
+ * @return const char*
+ */
+const char *Profile_Phase_Name(Profile_Phase_t phase)
+{
+    return (phase < PROFILE_PHASES_NUM) ? (profile_phases_names[phase]) : ("UNKNOWN");
+}//end Profile_Phase_Name.
+
+/**
+ * @brief Function to get the rate of the profiling ticks. (Measured once)
+ *
+ * @return double Ticks per nanosecond.
+ */
+double Profile_Ticks_Per_Ns(void)
+{
+#ifdef ANN_ENABLE_PROFILING
+    static _Atomic double ticks_per_ns = 0.0;
+
+    double rate = atomic_load(&ticks_per_ns);
+
+    if(rate > 0.0)
+        return rate;
+
+    const uint64_t start_ns    = Profile_Now_Ns();
+    const uint64_t start_ticks = Profile_Ticks();
+
+    uint64_t now_ns;
+
+    do
+    {
+        now_ns = Profile_Now_Ns();
+    }while( (now_ns - start_ns) < PROFILE_CALIBRATION_NS );
+
+    rate = (double) (Profile_Ticks() - start_ticks) / (double) (now_ns - start_ns);
+    atomic_store(&ticks_per_ns, rate);
+
+    return rate;
+#else
+    return 1.0;
+#endif
+}//end Profile_Ticks_Per_Ns.
+
+/**
+ * @brief Function to get a monotonic time in nanoseconds.
+ *
+ * @return uint64_t
+ */
+uint64_t Profile_Now_Ns(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (uint64_t) ((double) counter.QuadPart * (1e9 / (double) frequency.QuadPart));
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t) now.tv_sec * 1000000000ull) + (uint64_t) now.tv_nsec;
+#endif
+}//end Profile_Now_Ns.
+
+//!=============================> .END
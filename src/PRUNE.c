@@ -0,0 +1,352 @@
+/**
+ * @file PRUNE.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Weights pruning & sparse inference functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "PRUNE.H"
+#define CURRENT_C "PRUNE.C"
+
+/*
+    - Pruning overview:
+        Prune_Network zeros the given fraction of every weights layer, then Sparsify_Network
+        copies the non zero weights into the sparse formats:
+
+        CSR: [w w . . w . . .]    => (column, value) per weight. (Any pattern, one gather per weight)
+        BSR: [w w w w . . . .]    => (first column, 4 values) per block. (Contiguous, no gather)
+
+    - Each layer runs the fastest of its dense, CSR & BSR products, measured on this machine
+      by Sparsify_Network. (A sparse kernel only pays off below some density)
+
+    - The sparse weights belong to one model version: Once the weights change (training,
+      Load_Network, ..) the dense kernels run again until Sparsify_Network is called again.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to compare two scores. (qsort)
+ *
+ * @param a
+ * @param b
+ * @return int
+ */
+static int prune_compare(const void *a, const void *b)
+{
+    const double x = *(const double *) a;
+    const double y = *(const double *) b;
+
+    return (x > y) - (x < y);
+}//end prune_compare.
+
+/**
+ * @brief Function to zero the smallest groups of a weights matrix.
+ *          - A group is width contiguous weights of a row, scored by its squared L2 norm.
+ *            (width 1: The magnitude of each weight)
+ *
+ * @param weights
+ * @param sparsity The fraction of the groups to zero.
+ * @param width
+ */
+static void prune_layer(Type_t *weights, double sparsity, uint8_t width)
+{
+    const uint16_t row = weights->Matrix_t.row; // Temporary variable for readability.
+    const uint16_t col = weights->Matrix_t.col; // Temporary variable for readability.
+    const uint16_t groups_per_row = (col + width - 1) / width;
+    const uint32_t groups = (uint32_t) row * groups_per_row;
+    const uint32_t pruned = (uint32_t) (sparsity * groups);
+
+    if(pruned == 0)
+        return;
+
+    double *scores = (double *) Memory_Alloc(sizeof(double) * groups * 2, MEMORY_TEMPORARY);
+    double *sorted = scores + groups;
+
+    for(uint16_t i = 0; i < row; i++)
+    {
+        for(uint16_t g = 0; g < groups_per_row; g++)
+        {
+            double score = 0.0;
+
+            for(uint16_t j = g * width; (j < ((g + 1) * width)) && (j < col); j++)
+                score += weights->Matrix_t.Matrix[i][j] * weights->Matrix_t.Matrix[i][j];
+
+            scores[((uint32_t) i * groups_per_row) + g] = score;
+        }
+    }
+
+    memcpy(sorted, scores, sizeof(double) * groups);
+    qsort(sorted, groups, sizeof(double), &prune_compare);
+
+    // Zero the groups under the threshold, then the ties up to the pruned count.
+    const double threshold = sorted[pruned - 1];
+    uint32_t ties = pruned;
+
+    for(uint32_t k = 0; k < groups; k++)
+        ties -= (scores[k] < threshold) ? (1) : (0);
+
+    for(uint32_t k = 0; k < groups; k++)
+    {
+        if(scores[k] > threshold)
+            continue;
+
+        if(scores[k] == threshold)
+        {
+            if(ties == 0)
+                continue;
+
+            ties--;
+        }
+
+        const uint16_t i = k / groups_per_row;
+        const uint16_t g = k % groups_per_row;
+
+        for(uint16_t j = g * width; (j < ((g + 1) * width)) && (j < col); j++)
+            weights->Matrix_t.Matrix[i][j] = 0.0;
+    }
+
+    Memory_Free(scores);
+
+    return;
+}//end prune_layer.
+
+/**
+ * @brief Function to time the product of a layer. (The fastest of PRUNE_TIMING_ROUNDS rounds)
+ *
+ * @param weights The dense weights.
+ * @param sparse  The sparse weights. (NULL: The dense kernel)
+ * @param input  [weights col]
+ * @param output [weights row]
+ * @return double The ns per product.
+ */
+static double prune_time_kernel(Type_t *weights, const Sparse_Matrix_t *sparse, double *input, double *output)
+{
+    Type_t vector = {.Vector_t = {.len = weights->Matrix_t.col, .Vector = input}};
+    uint64_t fastest = UINT64_MAX;
+
+    for(uint8_t round = 0; round < PRUNE_TIMING_ROUNDS; round++)
+    {
+        const uint64_t start = Profile_Now_Ns();
+
+        for(uint16_t run = 0; run < PRUNE_TIMING_RUNS; run++)
+        {
+            if(sparse == NULL)
+                VxM_DotProduct_Unchecked(&vector, weights, output);
+            else
+                VxSM_DotProduct_Unchecked(input, sparse, output);
+        }
+
+        const uint64_t elapsed = Profile_Now_Ns() - start;
+        fastest = (elapsed < fastest) ? (elapsed) : (fastest);
+    }
+
+    return (double) fastest / PRUNE_TIMING_RUNS;
+}//end prune_time_kernel.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to prune every weights layer of a network, then to sparsify it.
+ *          - The pruned weights stay zero in the dense weights. (Save_Network keeps them)
+ *
+ * @param myNetwork
+ * @param sparsity The fraction of the weights to zero in each layer. [0, 1)
+ * @param method
+ * @return ANN_Status_t
+ */
+ANN_Status_t Prune_Network(DNN_Network *myNetwork, double sparsity, Prune_Method_t method)
+{
+    // Error Handeling.
+    if( (myNetwork == NULL) || (myNetwork->network_layers == NULL) )
+        return ANN_ERROR_NULL;
+
+    if( !(sparsity >= 0.0) || (sparsity >= 1.0) )
+        return ANN_ERROR_INVALID;
+
+    if( (method != PRUNE_MAGNITUDE) && (method != PRUNE_BLOCK) )
+        return ANN_ERROR_INVALID;
+
+    const uint8_t width = (method == PRUNE_BLOCK) ? (SPARSE_BLOCK_COLS) : (1);
+
+    for(uint16_t layer = 0; layer <= myNetwork->network_topology->hidden_layer_num; layer++)
+        prune_layer(myNetwork->network_layers->Layer_weights[layer].layer_weights, sparsity, width);
+
+    Weights_Changed(myNetwork);
+
+    return Sparsify_Network(myNetwork);
+}//end Prune_Network.
+
+/**
+ * @brief Function to build the sparse weights of a network & to pick the kernel of each layer.
+ *          - For a pruned or a loaded pruned network. Call it again after the weights change.
+ *
+ * @param myNetwork
+ * @return ANN_Status_t
+ */
+ANN_Status_t Sparsify_Network(DNN_Network *myNetwork)
+{
+    // Error Handeling.
+    if( (myNetwork == NULL) || (myNetwork->network_layers == NULL) )
+        return ANN_ERROR_NULL;
+
+    Layer_t *layers = myNetwork->network_layers; // (Temporary variable for readbility).
+    const uint16_t layers_num = myNetwork->network_topology->hidden_layer_num + 1;
+
+    Free_Sparse_Weights(layers->Sparse_weights);
+    layers->Sparse_weights = NULL;
+
+    const Memory_Context_t previous_context = Memory_Enter(layers->Memory_stats, MEMORY_WEIGHTS);
+
+    Sparse_Weights_t *sparse_weights = (Sparse_Weights_t *) Memory_Alloc(sizeof(Sparse_Weights_t), MEMORY_WEIGHTS);
+    sparse_weights->layers_num = layers_num;
+    sparse_weights->layers = (Sparse_Layer_t *) Memory_Calloc(sizeof(Sparse_Layer_t) * layers_num, MEMORY_WEIGHTS);
+
+    // The timing vectors. (Any values: The kernels don't depend on them)
+    double input[MAX_MATRIX_COL], output[MAX_MATRIX_ROW];
+
+    for(uint16_t j = 0; j < MAX_MATRIX_COL; j++)
+        input[j] = 1.0 / (j + 1);
+
+    for(uint16_t layer = 0; layer < layers_num; layer++)
+    {
+        Type_t *weights = layers->Layer_weights[layer].layer_weights;
+        Sparse_Layer_t *sparse_layer = &sparse_weights->layers[layer];
+
+        Sparse_Matrix_t *csr = Sparse_Matrix_Create(weights, SPARSE_FORMAT_CSR);
+        Sparse_Matrix_t *bsr = Sparse_Matrix_Create(weights, SPARSE_FORMAT_BSR);
+
+        sparse_layer->density  = (double) csr->nnz / ((double) weights->Matrix_t.row * weights->Matrix_t.col);
+        sparse_layer->dense_ns = prune_time_kernel(weights, NULL, input, output);
+        sparse_layer->csr_ns   = prune_time_kernel(weights, csr, input, output);
+        sparse_layer->bsr_ns   = prune_time_kernel(weights, bsr, input, output);
+
+        // Keep the fastest. (Dense on a tie: Nothing more to hold)
+        sparse_layer->kernel = SPARSE_KERNEL_DENSE;
+        double fastest = sparse_layer->dense_ns;
+
+        if(sparse_layer->csr_ns < fastest)
+        {
+            sparse_layer->kernel = SPARSE_KERNEL_CSR;
+            fastest = sparse_layer->csr_ns;
+        }
+
+        if(sparse_layer->bsr_ns < fastest)
+            sparse_layer->kernel = SPARSE_KERNEL_BSR;
+
+        sparse_layer->weights = (sparse_layer->kernel == SPARSE_KERNEL_CSR) ? (csr) :
+                                (sparse_layer->kernel == SPARSE_KERNEL_BSR) ? (bsr) : (NULL);
+
+        if(sparse_layer->weights != csr)
+            Sparse_Matrix_Free(csr);
+
+        if(sparse_layer->weights != bsr)
+            Sparse_Matrix_Free(bsr);
+    }
+
+    Memory_Leave(previous_context);
+
+    sparse_weights->version = Model_Version(myNetwork);
+    layers->Sparse_weights = sparse_weights;
+
+    return ANN_OK;
+}//end Sparsify_Network.
+
+/**
+ * @brief Function to free the sparse weights of a network. (Free_Network)
+ *
+ * @param sparse_weights (NULL: Nothing)
+ */
+void Free_Sparse_Weights(Sparse_Weights_t *sparse_weights)
+{
+    if(sparse_weights == NULL)
+        return;
+
+    for(uint16_t layer = 0; layer < sparse_weights->layers_num; layer++)
+        Sparse_Matrix_Free(sparse_weights->layers[layer].weights);
+
+    Memory_Free(sparse_weights->layers);
+    Memory_Free(sparse_weights);
+
+    return;
+}//end Free_Sparse_Weights.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the name of a kernel.
+ *
+ * @param kernel
+ * @return const char*
+ */
+const char *Sparse_Kernel_Name(Sparse_Kernel_t kernel)
+{
+    switch(kernel)
+    {
+        case SPARSE_KERNEL_DENSE: return "dense";
+        case SPARSE_KERNEL_CSR:   return "csr";
+        case SPARSE_KERNEL_BSR:   return "bsr";
+        default:                  return "unknown";
+    }
+}//end Sparse_Kernel_Name.
+
+/**
+ * @brief Function to print the density, the kernel & the product times of each layer.
+ *
+ * @param myNetwork
+ */
+void print_sparse_report(DNN_Network *myNetwork)
+{
+    // Error Handeling.
+    if(myNetwork == NULL)
+        error_exit(CURRENT_C, "DNN_NETWORK:NULL");
+
+    const Sparse_Weights_t *sparse_weights = myNetwork->network_layers->Sparse_weights;
+
+    if(sparse_weights == NULL)
+    {
+        printf("\nSPARSE: Not sparsified (Dense kernels)\n");
+        return;
+    }
+
+    const bool stale = (sparse_weights->version != Model_Version(myNetwork));
+
+    printf("\nSPARSE:%s\n", (stale) ? (" Stale, the weights changed (Dense kernels)") : (""));
+    printf("%-6s %8s %7s %12s %12s %12s %12s %12s\n",
+           "LAYER", "DENSITY", "KERNEL", "DENSE_NS", "CSR_NS", "BSR_NS", "DENSE_BYTES", "KERNEL_BYTES");
+
+    for(uint16_t layer = 0; layer < sparse_weights->layers_num; layer++)
+    {
+        const Sparse_Layer_t *sparse_layer = &sparse_weights->layers[layer];
+        Type_t *weights = myNetwork->network_layers->Layer_weights[layer].layer_weights;
+
+        const size_t dense_bytes = sizeof(double) * weights->Matrix_t.row * weights->Matrix_t.col;
+        const size_t kernel_bytes = (sparse_layer->weights != NULL) ? (Sparse_Matrix_Bytes(sparse_layer->weights)) : (dense_bytes);
+
+        printf("%-6u %7.1f%% %7s %12.1f %12.1f %12.1f %12zu %12zu\n",
+               layer, 100.0 * sparse_layer->density, Sparse_Kernel_Name(sparse_layer->kernel),
+               sparse_layer->dense_ns, sparse_layer->csr_ns, sparse_layer->bsr_ns, dense_bytes, kernel_bytes);
+    }
+
+    return;
+}//end print_sparse_report.
+
+//!=============================> .END
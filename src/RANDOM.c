@@ -0,0 +1,258 @@
+/**
+ * @file RANDOM.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Counter based random numbers functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "RANDOM.H"
+#define CURRENT_C "RANDOM.C"
+
+/*
+    - Generator overview: (Philox4x32-10)
+        Random = Philox(Counter, Key). There is no hidden state: the n-th number of a stream
+        is computed directly from n, so:
+            - Threads never share (or lock) a generator state.
+            - Any range of a stream can be (re)generated in any order, in parallel chunks.
+            - The same (Key, Counter) always gives the same numbers. (Reproducible)
+
+    - Counter layout:
+        Counter = [Block index (64 bits)][Stream (64 bits)], every block holds 4 numbers.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define PHILOX_M0 ((const uint32_t) 0xD2511F53u)
+#define PHILOX_M1 ((const uint32_t) 0xCD9E8D57u)
+#define PHILOX_W0 ((const uint32_t) 0x9E3779B9u)
+#define PHILOX_W1 ((const uint32_t) 0xBB67AE85u)
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to generate (RANDOM_LANES) consecutive blocks side by side.
+ *          - Every lane runs the same instructions on its own counter, so the
+ *            compiler maps the lanes onto the SIMD registers.
+ *
+ * @param key
+ * @param stream
+ * @param first_block
+ * @param out [RANDOM_LANES x 4] numbers. (Lane major)
+ */
+static void random_philox_lanes(uint64_t key, uint64_t stream, uint64_t first_block, uint32_t *out)
+{
+    uint32_t c0[RANDOM_LANES], c1[RANDOM_LANES], c2[RANDOM_LANES], c3[RANDOM_LANES];
+
+    for(uint8_t l = 0; l < RANDOM_LANES; l++)
+    {
+        const uint64_t block = first_block + l;
+
+        c0[l] = (uint32_t) block;
+        c1[l] = (uint32_t) (block >> 32);
+        c2[l] = (uint32_t) stream;
+        c3[l] = (uint32_t) (stream >> 32);
+    }
+
+    uint32_t k0 = (uint32_t) key;
+    uint32_t k1 = (uint32_t) (key >> 32);
+
+    for(uint8_t round = 0; round < RANDOM_PHILOX_ROUNDS; round++)
+    {
+        for(uint8_t l = 0; l < RANDOM_LANES; l++)
+        {
+            const uint64_t product0 = (uint64_t) PHILOX_M0 * c0[l];
+            const uint64_t product1 = (uint64_t) PHILOX_M1 * c2[l];
+
+            const uint32_t new_c0 = (uint32_t) (product1 >> 32) ^ c1[l] ^ k0;
+            const uint32_t new_c2 = (uint32_t) (product0 >> 32) ^ c3[l] ^ k1;
+
+            c1[l] = (uint32_t) product1;
+            c3[l] = (uint32_t) product0;
+            c0[l] = new_c0;
+            c2[l] = new_c2;
+        }
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    for(uint8_t l = 0; l < RANDOM_LANES; l++)
+    {
+        out[(l * 4) + 0] = c0[l];
+        out[(l * 4) + 1] = c1[l];
+        out[(l * 4) + 2] = c2[l];
+        out[(l * 4) + 3] = c3[l];
+    }
+
+    return;
+}//end random_philox_lanes.
+
+/**
+ * @brief Function to mix a 64 bits number. (splitmix64 finalizer)
+ *
+ * @param value
+ * @return uint64_t
+ */
+static uint64_t random_mix(uint64_t value)
+{
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+
+    return value ^ (value >> 31);
+}//end random_mix.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to generate one Philox4x32-10 block.
+ *
+ * @param counter_lo
+ * @param counter_hi
+ * @param key
+ * @return Random_Block_t
+ */
+Random_Block_t Random_Philox(uint64_t counter_lo, uint64_t counter_hi, uint64_t key)
+{
+    uint32_t c0 = (uint32_t) counter_lo;
+    uint32_t c1 = (uint32_t) (counter_lo >> 32);
+    uint32_t c2 = (uint32_t) counter_hi;
+    uint32_t c3 = (uint32_t) (counter_hi >> 32);
+
+    uint32_t k0 = (uint32_t) key;
+    uint32_t k1 = (uint32_t) (key >> 32);
+
+    for(uint8_t round = 0; round < RANDOM_PHILOX_ROUNDS; round++)
+    {
+        const uint64_t product0 = (uint64_t) PHILOX_M0 * c0;
+        const uint64_t product1 = (uint64_t) PHILOX_M1 * c2;
+
+        const uint32_t new_c0 = (uint32_t) (product1 >> 32) ^ c1 ^ k0;
+        const uint32_t new_c2 = (uint32_t) (product0 >> 32) ^ c3 ^ k1;
+
+        c1 = (uint32_t) product1;
+        c3 = (uint32_t) product0;
+        c0 = new_c0;
+        c2 = new_c2;
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    Random_Block_t block = {.value = {c0, c1, c2, c3}};
+
+    return block;
+}//end Random_Philox.
+
+/**
+ * @brief Function to fill an array with the numbers [offset, offset + count) of a stream.
+ *          - Filling a range in one call or in several chunks gives the same numbers.
+ *
+ * @param key
+ * @param stream
+ * @param offset The index of the first number in the stream.
+ * @param out
+ * @param count
+ */
+void Random_Fill_U32(uint64_t key, uint64_t stream, uint64_t offset, uint32_t *out, uint32_t count)
+{
+    // Error Handeling.
+    if(out == NULL)
+        error_exit(CURRENT_C, "OUT:NULL");
+
+    uint32_t lanes_out[RANDOM_LANES * 4];
+    uint32_t filled = 0;
+
+    while(filled < count)
+    {
+        // Generate the lanes that hold the next needed number.
+        const uint64_t index       = offset + filled;
+        const uint64_t first_block = index / 4;
+        const uint32_t skip        = (uint32_t) (index % 4);
+
+        random_philox_lanes(key, stream, first_block, lanes_out);
+
+        uint32_t available = (RANDOM_LANES * 4) - skip;
+
+        if(available > (count - filled))
+            available = count - filled;
+
+        memcpy(&out[filled], &lanes_out[skip], sizeof(uint32_t) * available);
+
+        filled += available;
+    }
+
+    return;
+}//end Random_Fill_U32.
+
+/**
+ * @brief Function to get one random 64 bits number of a key.
+ *
+ * @param key
+ * @param counter
+ * @return uint64_t
+ */
+uint64_t Random_U64(uint64_t key, uint64_t counter)
+{
+    const Random_Block_t block = Random_Philox(counter, 0, key);
+
+    return ((uint64_t) block.value[1] << 32) | block.value[0];
+}//end Random_U64.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to derive an independent key from a seed. (Per thread, per layer, ..)
+ *
+ * @param seed
+ * @param stream
+ * @return uint64_t
+ */
+uint64_t Random_Key(uint64_t seed, uint64_t stream)
+{
+    return random_mix(seed ^ random_mix(stream));
+}//end Random_Key.
+
+/**
+ * @brief Function to get a small unique id of the calling thread. (0 for the first thread asking)
+ *
+ * @return uint32_t
+ */
+uint32_t Random_Thread_Id(void)
+{
+    static atomic_uint next_thread_id = 0;
+    static _Thread_local bool has_id = false;
+    static _Thread_local uint32_t thread_id = 0;
+
+    if(has_id == false)
+    {
+        thread_id = atomic_fetch_add(&next_thread_id, 1);
+        has_id = true;
+    }
+
+    return thread_id;
+}//end Random_Thread_Id.
+
+//!=============================> .END
@@ -0,0 +1,329 @@
+/**
+ * @file TRACE.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Chrome trace events timeline functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "TRACE.H"
+#define CURRENT_C "TRACE.C"
+
+/*
+    - Tracing overview:
+        Trace_Start(path) ... Trace_Stop() writes a Chrome/Perfetto trace events JSON file.
+        (chrome://tracing or ui.perfetto.dev)
+
+        Every thread pushes its begin/end events into its own ring buffer, without any lock.
+        A flush thread drains all the rings every TRACE_FLUSH_INTERVAL_MS & writes them, so
+        the traced threads never wait for the disk. Events pushed into a full ring are
+        dropped & counted. (Trace_Dropped)
+
+    - The rings are kept for the whole process & reused by the next trace.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define TRACE_RING_MASK ((const uint64_t) (TRACE_RING_SIZE - 1))
+
+atomic_bool trace_enabled = false;
+
+// All the threads rings. (Pushed at the front, never removed)
+static Trace_Ring_t *_Atomic trace_rings = NULL;
+static _Thread_local Trace_Ring_t *trace_thread_ring = NULL;
+static _Thread_local const char *trace_thread_name = NULL;
+
+static atomic_uint_fast64_t trace_dropped = 0;
+
+// The output file. (Written by the flush thread, then by Trace_Stop)
+static FILE *trace_file = NULL;
+static bool trace_first_event = true;
+static uint64_t trace_start_ns = 0;
+
+static pthread_t trace_flusher;
+static atomic_bool trace_stop = false;
+
+static const char *trace_layers_names[MAX_HIDDEN_LAYER_NUM + 1] =
+{
+    "layer_0", "layer_1", "layer_2", "layer_3", "layer_4", "layer_5", "layer_6", "layer_7", "layer_8"
+};
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the ring of the calling thread. (Created on its first event)
+ *
+ * @return Trace_Ring_t*
+ */
+static Trace_Ring_t *trace_get_ring(void)
+{
+    if(trace_thread_ring != NULL)
+        return trace_thread_ring;
+
+    Trace_Ring_t *ring = (Trace_Ring_t *) calloc(1, sizeof(Trace_Ring_t));
+
+    if(ring == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->thread_name, trace_thread_name);
+    ring->thread_id = Random_Thread_Id();
+
+    // Push it at the front of the list.
+    Trace_Ring_t *first = atomic_load(&trace_rings);
+
+    do
+    {
+        ring->next = first;
+    }while(atomic_compare_exchange_weak(&trace_rings, &first, ring) == false);
+
+    trace_thread_ring = ring;
+
+    return ring;
+}//end trace_get_ring.
+
+/**
+ * @brief Function to write the pending events of all the rings.
+ *
+ */
+static void trace_drain(void)
+{
+    for(Trace_Ring_t *ring = atomic_load(&trace_rings); ring != NULL; ring = ring->next)
+    {
+        // Name the thread once per trace.
+        const char *thread_name = atomic_load(&ring->thread_name);
+
+        if( (thread_name != NULL) && (ring->thread_name_written == false) )
+        {
+            fprintf(trace_file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                    (trace_first_event) ? ("\n") : (",\n"), ring->thread_id, thread_name);
+
+            trace_first_event = false;
+            ring->thread_name_written = true;
+        }
+
+        const uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+        for(; tail < head; tail++)
+        {
+            const Trace_Event_t *event = &ring->events[tail & TRACE_RING_MASK];
+
+            // (Events pushed before this trace started are skipped)
+            if(event->timestamp_ns < trace_start_ns)
+                continue;
+
+            fprintf(trace_file, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+                    (trace_first_event) ? ("\n") : (",\n"), event->name, event->category, event->phase,
+                    (double) (event->timestamp_ns - trace_start_ns) * 1e-3, ring->thread_id);
+
+            trace_first_event = false;
+        }
+
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    }
+
+    return;
+}//end trace_drain.
+
+/**
+ * @brief Function to sleep the calling thread.
+ *
+ * @param milliseconds
+ */
+static void trace_sleep_ms(uint32_t milliseconds)
+{
+#ifdef _WIN32
+    Sleep(milliseconds);
+#else
+    struct timespec duration = {.tv_sec = milliseconds / 1000, .tv_nsec = (long) (milliseconds % 1000) * 1000000L};
+    nanosleep(&duration, NULL);
+#endif
+
+    return;
+}//end trace_sleep_ms.
+
+/**
+ * @brief The flush thread. Drains the rings until Trace_Stop.
+ *
+ * @param arg (Unused)
+ * @return void*
+ */
+static void *trace_flush_worker(void *arg)
+{
+    (void) arg;
+
+    Trace_Thread_Name("trace_flush");
+
+    while(atomic_load(&trace_stop) == false)
+    {
+        trace_drain();
+        trace_sleep_ms(TRACE_FLUSH_INTERVAL_MS);
+    }
+
+    return NULL;
+}//end trace_flush_worker.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to start recording a trace into a file.
+ *
+ * @param path The Chrome trace events JSON file.
+ */
+void Trace_Start(const char *path)
+{
+    // Error Handeling.
+    if(path == NULL)
+        error_exit(CURRENT_C, "TRACE_PATH:NULL");
+
+    if(atomic_load(&trace_enabled) == true)
+        error_exit(CURRENT_C, "TRACE:ALREADY_STARTED");
+
+    trace_file = fopen(path, "w");
+
+    if(trace_file == NULL)
+        error_exit(CURRENT_C, "TRACE_FILE:OPEN_FAILED");
+
+    fprintf(trace_file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    // Forget the leftovers of the previous trace.
+    for(Trace_Ring_t *ring = atomic_load(&trace_rings); ring != NULL; ring = ring->next)
+    {
+        atomic_store(&ring->tail, atomic_load(&ring->head));
+        ring->thread_name_written = false;
+    }
+
+    trace_first_event = true;
+    trace_start_ns = Profile_Now_Ns();
+    atomic_store(&trace_dropped, 0);
+    atomic_store(&trace_stop, false);
+
+    if(pthread_create(&trace_flusher, NULL, trace_flush_worker, NULL) != 0)
+        error_exit(CURRENT_C, "TRACE_THREAD:CREATE_FAILED");
+
+    atomic_store(&trace_enabled, true);
+
+    return;
+}//end Trace_Start.
+
+/**
+ * @brief Function to stop the trace, write its last events & close its file.
+ *
+ */
+void Trace_Stop(void)
+{
+    if(atomic_load(&trace_enabled) == false)
+        return;
+
+    atomic_store(&trace_enabled, false);
+
+    atomic_store(&trace_stop, true);
+    pthread_join(trace_flusher, NULL);
+
+    // The events pushed since the last drain.
+    trace_drain();
+
+    fprintf(trace_file, "\n]}\n");
+    fclose(trace_file);
+    trace_file = NULL;
+
+    return;
+}//end Trace_Stop.
+
+/**
+ * @brief Function to push one event into the ring of the calling thread. (Lock free)
+ *          - Use the TRACE_BEGIN & TRACE_END macros, they skip the call when no trace is recorded.
+ *
+ * @param name     (Static string)
+ * @param category (Static string)
+ * @param phase    'B' or 'E'.
+ */
+void Trace_Record(const char *name, const char *category, char phase)
+{
+    Trace_Ring_t *ring = trace_get_ring();
+
+    const uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    const uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+    // Full ring: The flush thread is behind.
+    if( (head - tail) >= TRACE_RING_SIZE )
+    {
+        atomic_fetch_add_explicit(&trace_dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    Trace_Event_t *event = &ring->events[head & TRACE_RING_MASK];
+
+    event->name         = name;
+    event->category     = category;
+    event->timestamp_ns = Profile_Now_Ns();
+    event->phase        = phase;
+
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+
+    return;
+}//end Trace_Record.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to name the calling thread in the traces.
+ *
+ * @param name (Static string)
+ */
+void Trace_Thread_Name(const char *name)
+{
+    // (No ring is created for it, threads that never trace don't need one)
+    trace_thread_name = name;
+
+    if(trace_thread_ring != NULL)
+        atomic_store(&trace_thread_ring->thread_name, name);
+
+    return;
+}//end Trace_Thread_Name.
+
+/**
+ * @brief Function to get the event name of a weights layer.
+ *
+ * @param layer
+ * @return const char*
+ */
+const char *Trace_Layer_Name(uint16_t layer)
+{
+    return (layer <= MAX_HIDDEN_LAYER_NUM) ? (trace_layers_names[layer]) : ("layer");
+}//end Trace_Layer_Name.
+
+/**
+ * @brief Function to get the number of events dropped by the current trace. (Full rings)
+ *
+ * @return uint64_t
+ */
+uint64_t Trace_Dropped(void)
+{
+    return atomic_load(&trace_dropped);
+}//end Trace_Dropped.
+
+//!=============================> .END
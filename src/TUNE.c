@@ -0,0 +1,404 @@
+/**
+ * @file TUNE.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Batched passes autotuning functions.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "TUNE.H"
+#define CURRENT_C "TUNE.C"
+
+/*
+    - Autotuning overview:
+        Tune_Network times the batched pass of a network for each depth-first tile on this
+        machine & keeps the fastest one. (Set_Batch_Tile) The single sample kernels of the
+        pruned layers are already timed by Sparsify_Network.
+
+    - Tuning cache: (A text file, one tuning per line, tab separated)
+        cpu    input  hidden  hidden_num  output  batch  weights  tile  tile_ns  layerwise_ns
+
+        The cpu name, the shapes, the batch size & the weights kernels are the key: Another
+        network of the same key reads its tile instead of timing again.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+// The candidate tiles under the batch size. (The last candidate: MAX_MATRIX_ROW, layer by layer)
+static const uint16_t tune_tiles[] = {4, 8, 16, 32, 64, 128};
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get the kernels the weights of a network run.
+ *          - The same precedence as the forward passes: Factors, sparse, 16 bits, dense.
+ *
+ * @param myNetwork
+ * @return const char* (At most TUNE_WEIGHTS_NAME_LEN - 1 characters)
+ */
+static const char *tune_weights_name(DNN_Network *myNetwork)
+{
+    const Layer_t *layers = myNetwork->network_layers; // (Temporary variable for readbility).
+    const uint64_t version = Model_Version(myNetwork);
+
+    if( (layers->LowRank_weights != NULL) && (layers->LowRank_weights->version == version) && (layers->LowRank_weights->max_rank > 0) )
+        return "lowrank";
+
+    if( (layers->Sparse_weights != NULL) && (layers->Sparse_weights->version == version) )
+        return "pruned";
+
+    if( (layers->Half_weights != NULL) && (layers->Half_weights->version == version) )
+        return Half_Format_Name(layers->Half_weights->format);
+
+    return "dense";
+}//end tune_weights_name.
+
+/**
+ * @brief Function to check if two tunings have the same key.
+ *
+ * @param a
+ * @param b
+ * @return true
+ * @return false
+ */
+static bool tune_key_equal(const Tune_Key_t *a, const Tune_Key_t *b)
+{
+    return (strcmp(a->cpu_name, b->cpu_name) == 0) && (strcmp(a->weights, b->weights) == 0) &&
+           (a->input_dense  == b->input_dense)  && (a->hidden_dense == b->hidden_dense) &&
+           (a->hidden_num   == b->hidden_num)   && (a->output_dense == b->output_dense) &&
+           (a->batch_size   == b->batch_size);
+}//end tune_key_equal.
+
+/**
+ * @brief Function to time the batched pass of a network with a tile. (The fastest of TUNE_TIMING_ROUNDS passes)
+ *
+ * @param myNetwork
+ * @param inputs  [batch_size x input_layer_dense]
+ * @param outputs [batch_size x output_layer_dense]
+ * @param batch_size
+ * @param batch_tile
+ * @return double The ns per batched pass.
+ */
+static double tune_time_tile(DNN_Network *myNetwork, Type_t *inputs, Type_t *outputs, uint16_t batch_size, uint16_t batch_tile)
+{
+    Set_Batch_Tile(myNetwork, batch_tile);
+
+    // Warm up: The workspace of this tile & the caches.
+    forward_propagation_batch(myNetwork, inputs, outputs, batch_size);
+
+    uint64_t fastest = UINT64_MAX;
+
+    for(uint8_t round = 0; round < TUNE_TIMING_ROUNDS; round++)
+    {
+        const uint64_t start = Profile_Now_Ns();
+
+        forward_propagation_batch(myNetwork, inputs, outputs, batch_size);
+
+        const uint64_t elapsed = Profile_Now_Ns() - start;
+        fastest = (elapsed < fastest) ? (elapsed) : (fastest);
+    }
+
+    return (double) fastest;
+}//end tune_time_tile.
+
+/**
+ * @brief Function to read the tunings of a tuning cache file.
+ *
+ * @param path
+ * @param entries [TUNE_CACHE_MAX_ENTRIES]
+ * @return uint16_t The number of entries. (0: No file yet)
+ */
+static uint16_t tune_cache_read(const char *path, Tune_Result_t *entries)
+{
+    FILE *file = fopen(path, "r");
+
+    if(file == NULL)
+        return 0;
+
+    char line[TUNE_LINE_LEN];
+    uint16_t entries_num = 0;
+
+    while( (fgets(line, sizeof(line), file) != NULL) && (entries_num < TUNE_CACHE_MAX_ENTRIES) )
+    {
+        if(line[0] == '#')
+            continue;
+
+        Tune_Result_t *entry = &entries[entries_num];
+        memset(entry, 0, sizeof(Tune_Result_t));
+
+        // (The widths: TUNE_CPU_NAME_LEN - 1 & TUNE_WEIGHTS_NAME_LEN - 1)
+        const int fields = sscanf(line, "%95[^\t]\t%hu\t%hu\t%hu\t%hu\t%hu\t%7[^\t]\t%hu\t%lf\t%lf",
+                                  entry->key.cpu_name, &entry->key.input_dense, &entry->key.hidden_dense, &entry->key.hidden_num,
+                                  &entry->key.output_dense, &entry->key.batch_size, entry->key.weights,
+                                  &entry->batch_tile, &entry->tile_ns, &entry->layerwise_ns);
+
+        // Skip the broken lines.
+        if( (fields != 10) || (entry->batch_tile == 0) || (entry->batch_tile > MAX_MATRIX_ROW) )
+            continue;
+
+        entry->cached = true;
+        entries_num++;
+    }
+
+    fclose(file);
+
+    return entries_num;
+}//end tune_cache_read.
+
+/**
+ * @brief Function to write the tunings to a tuning cache file. (Replaces it)
+ *          - Written to a temporary file of this process, then renamed over the cache: Many
+ *            processes sharing one cache never read a truncated or interleaved file. (The
+ *            last rename wins)
+ *
+ * @param path
+ * @param entries [entries_num]
+ * @param entries_num
+ * @return ANN_Status_t
+ */
+static ANN_Status_t tune_cache_write(const char *path, const Tune_Result_t *entries, uint16_t entries_num)
+{
+    char temporary_path[TUNE_LINE_LEN];
+
+#ifdef _WIN32
+    const unsigned long process_id = (unsigned long) GetCurrentProcessId();
+#else
+    const unsigned long process_id = (unsigned long) getpid();
+#endif
+
+    if(snprintf(temporary_path, sizeof(temporary_path), "%s.%lu.tmp", path, process_id) >= (int) sizeof(temporary_path))
+        return ANN_ERROR_IO;
+
+    FILE *file = fopen(temporary_path, "w");
+
+    if(file == NULL)
+        return ANN_ERROR_IO;
+
+    fprintf(file, "# cpu\tinput\thidden\thidden_num\toutput\tbatch\tweights\ttile\ttile_ns\tlayerwise_ns\n");
+
+    for(uint16_t e = 0; e < entries_num; e++)
+    {
+        const Tune_Result_t *entry = &entries[e];
+
+        fprintf(file, "%s\t%u\t%u\t%u\t%u\t%u\t%s\t%u\t%.0f\t%.0f\n",
+                entry->key.cpu_name, entry->key.input_dense, entry->key.hidden_dense, entry->key.hidden_num,
+                entry->key.output_dense, entry->key.batch_size, entry->key.weights,
+                entry->batch_tile, entry->tile_ns, entry->layerwise_ns);
+    }
+
+    if(fclose(file) != 0)
+    {
+        remove(temporary_path);
+        return ANN_ERROR_IO;
+    }
+
+#ifdef _WIN32
+    const bool renamed = (MoveFileExA(temporary_path, path, MOVEFILE_REPLACE_EXISTING) != 0);
+#else
+    const bool renamed = (rename(temporary_path, path) == 0);
+#endif
+
+    if(renamed == false)
+    {
+        remove(temporary_path);
+        return ANN_ERROR_IO;
+    }
+
+    return ANN_OK;
+}//end tune_cache_write.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to set the fastest depth-first tile of a network for a batch size.
+ *          - Times the batched pass for each tile, or reads the tile of the same key from the
+ *            tuning cache. The tuned tile runs every batch size. (Set_Batch_Tile)
+ *          - Tune again after Sparsify_Network, Factorize_Network or Compress_Network: They
+ *            change the kernels, so the key.
+ *
+ * @param myNetwork
+ * @param batch_size The batch size to tune for.
+ * @param cache_path The tuning cache file. (NULL: Always time, nothing saved)
+ * @param result (NULL: Not needed)
+ * @return ANN_Status_t (ANN_ERROR_IO: The cache file couldn't be written, the tile is set even so)
+ */
+ANN_Status_t Tune_Network(DNN_Network *myNetwork, uint16_t batch_size, const char *cache_path, Tune_Result_t *result)
+{
+    // Error Handeling.
+    if( (myNetwork == NULL) || (myNetwork->network_layers == NULL) )
+        return ANN_ERROR_NULL;
+
+    if(batch_size == 0)
+        return ANN_ERROR_INVALID;
+
+    if(batch_size > MAX_MATRIX_ROW)
+        return ANN_ERROR_LIMIT;
+
+    Layer_t *layers = myNetwork->network_layers; // (Temporary variable for readbility).
+    const Network_Topology_t *topology = myNetwork->network_topology;
+
+    Tune_Result_t tuned;
+    memset(&tuned, 0, sizeof(Tune_Result_t));
+
+    get_cpu_name(tuned.key.cpu_name, sizeof(tuned.key.cpu_name));
+
+    // (The cache file is tab separated)
+    for(char *c = tuned.key.cpu_name; *c != '\0'; c++)
+    {
+        if(*c == '\t')
+            *c = ' ';
+    }
+
+    tuned.key.input_dense  = topology->input_layer_dense;
+    tuned.key.hidden_dense = topology->hidden_layer_dense;
+    tuned.key.hidden_num   = topology->hidden_layer_num;
+    tuned.key.output_dense = topology->output_layer_dense;
+    tuned.key.batch_size   = batch_size;
+    snprintf(tuned.key.weights, sizeof(tuned.key.weights), "%s", tune_weights_name(myNetwork));
+
+    const Memory_Context_t previous_context = Memory_Enter(layers->Memory_stats, MEMORY_TEMPORARY);
+
+    // Read the tuning of this key.
+    Tune_Result_t *entries = NULL;
+    uint16_t entries_num = 0;
+    bool found = false;
+
+    if(cache_path != NULL)
+    {
+        entries = (Tune_Result_t *) Memory_Alloc(sizeof(Tune_Result_t) * TUNE_CACHE_MAX_ENTRIES, MEMORY_TEMPORARY);
+        entries_num = tune_cache_read(cache_path, entries);
+
+        for(uint16_t e = 0; (e < entries_num) && (found == false); e++)
+        {
+            if(tune_key_equal(&entries[e].key, &tuned.key))
+            {
+                tuned = entries[e];
+                found = true;
+            }
+        }
+    }
+
+    // Or time the tiles.
+    if(found == false)
+    {
+        Type_t *inputs  = create_matrix(batch_size, topology->input_layer_dense, false);
+        Type_t *outputs = create_matrix(batch_size, topology->output_layer_dense, false);
+        Init_Matrix(inputs, INIT_UNIFORM, TUNE_INPUTS_SEED, 0);
+
+        // Time the passes, not the results cache. (Attach_Cache)
+        struct _Cache_t *cache = layers->Inference_cache;
+        layers->Inference_cache = NULL;
+
+        for(uint16_t t = 0; t < (sizeof(tune_tiles) / sizeof(tune_tiles[0])); t++)
+        {
+            if(tune_tiles[t] < batch_size)
+                tuned.tiles[tuned.tiles_num++] = tune_tiles[t];
+        }
+
+        tuned.tiles[tuned.tiles_num++] = MAX_MATRIX_ROW;
+
+        for(uint16_t t = 0; t < tuned.tiles_num; t++)
+            tuned.tiles_ns[t] = tune_time_tile(myNetwork, inputs, outputs, batch_size, tuned.tiles[t]);
+
+        // The fastest. (Layer by layer on a tie)
+        tuned.layerwise_ns = tuned.tiles_ns[tuned.tiles_num - 1];
+        tuned.batch_tile   = MAX_MATRIX_ROW;
+        tuned.tile_ns      = tuned.layerwise_ns;
+
+        for(uint16_t t = 0; t < (tuned.tiles_num - 1); t++)
+        {
+            if(tuned.tiles_ns[t] < tuned.tile_ns)
+            {
+                tuned.batch_tile = tuned.tiles[t];
+                tuned.tile_ns    = tuned.tiles_ns[t];
+            }
+        }
+
+        layers->Inference_cache = cache;
+
+        free_matrix(inputs);
+        free_matrix(outputs);
+    }
+
+    Set_Batch_Tile(myNetwork, tuned.batch_tile);
+
+    // Save the new tuning. (A full file drops its oldest one)
+    ANN_Status_t status = ANN_OK;
+
+    if( (cache_path != NULL) && (found == false) )
+    {
+        if(entries_num == TUNE_CACHE_MAX_ENTRIES)
+        {
+            memmove(&entries[0], &entries[1], sizeof(Tune_Result_t) * (entries_num - 1));
+            entries_num--;
+        }
+
+        entries[entries_num++] = tuned;
+        status = tune_cache_write(cache_path, entries, entries_num);
+    }
+
+    if(entries != NULL)
+        Memory_Free(entries);
+
+    Memory_Leave(previous_context);
+
+    if(result != NULL)
+        *result = tuned;
+
+    return status;
+}//end Tune_Network.
+
+/*
+----------------------------------------------------------------
+!-                       SUB FUNCTIONS                         -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to print the key, the tile & the timed tiles of a tuning.
+ *
+ * @param result
+ */
+void print_tune_report(const Tune_Result_t *result)
+{
+    // Error Handeling.
+    if(result == NULL)
+        error_exit(CURRENT_C, "TUNE_RESULT:NULL");
+
+    const Tune_Key_t *key = &result->key;
+
+    printf("\nTUNE: %s\n", key->cpu_name);
+    printf("Network %u-%ux%u-%u, batch %u, %s weights%s\n", key->input_dense, key->hidden_dense, key->hidden_num,
+           key->output_dense, key->batch_size, key->weights, (result->cached) ? (", from the tuning cache") : (""));
+    printf("%-6s %14s %9s\n", "TILE", "NS_PER_BATCH", "SPEEDUP");
+
+    for(uint16_t t = 0; t < result->tiles_num; t++)
+    {
+        printf("%-6u %14.0f %8.2fx%s\n", result->tiles[t], result->tiles_ns[t], result->layerwise_ns / result->tiles_ns[t],
+               (result->tiles[t] == result->batch_tile) ? ("  <=") : (""));
+    }
+
+    printf("Tile %u: %.0f ns per batch, %.2fx layer by layer\n", result->batch_tile, result->tile_ns,
+           (result->tile_ns > 0.0) ? (result->layerwise_ns / result->tile_ns) : (0.0));
+
+    return;
+}//end print_tune_report.
+
+//!=============================> .END
@@ -0,0 +1,1098 @@
+/**
+ * @file bench.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Benchmark suite of the kernels, the layers & the end-to-end networks. (ann_bench)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#define CURRENT_H "BENCH.H"
+#define CURRENT_C "BENCH.C"
+
+/*
+    - Usage:
+        ann_bench [--json FILE] [--filter TEXT] [--min-time MS] [--repeats N]
+            Runs every case whose name contains TEXT & prints one table line per case.
+            --json also writes the results to FILE. (One result object per line)
+
+        ann_bench --compare BASE.json NEW.json [--threshold PERCENT]
+            Prints the ns/op change of every case found in both runs & exits with 1 if
+            any case got slower than the threshold. (Default: 5%)
+
+    - Measurement:
+        Every case doubles its iterations until one run lasts (min-time), then runs
+        (repeats) times & keeps the fastest run. (The least disturbed one)
+
+    - Reported per operation:
+        ns/op, GFLOP/s (2 flops per multiply-add), bytes moved (the minimum traffic:
+        weights & activations read or written once), samples/sec & heap allocations.
+
+    - Steady state:
+        The inference cases must not allocate once warmed up. ann_bench exits with 1 if
+        one of them does.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define BENCH_NAME_LEN        ((const uint8_t) 96)
+#define BENCH_MAX_CASES       ((const uint16_t) 256)
+#define BENCH_MAX_THREADS     ((const uint16_t) 16)
+#define BENCH_MIN_TIME_MS     ((const double) 200.0)
+#define BENCH_REPEATS         ((const uint16_t) 3)
+#define BENCH_THRESHOLD       ((const double) 5.0)
+#define BENCH_SCHEMA_VERSION  ((const uint8_t) 1)
+#define BENCH_LINE_LEN        ((const uint16_t) 1024)
+#define BENCH_INCREMENTAL_CHANGES ((const uint16_t) 4)  // Changed inputs per incremental pass.
+#define BENCH_SPARSE_NNZ          ((const uint16_t) 8)  // Non zero inputs per sparse pass.
+#define BENCH_PRUNE_SPARSITY      ((const double) 0.9)  // Zeroed weights of the pruned networks.
+#define BENCH_LOWRANK_SPEEDUP     ((const double) 4.0)  // Multiply adds speedup of the factorized layers.
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for the state of one benchmark case
+ *
+ */
+typedef struct _Bench_State_t
+{
+    // Kernels.
+    Type_t *vector;
+    Type_t *matrix;
+    Type_t *batch;
+    Type_t *result;
+    double *(*activation_function) (Type_t *);
+
+    // Networks. (One per thread)
+    Network_Topology_t *topology;
+    Network_Config_t   *config;
+    DNN_Network *networks[BENCH_MAX_THREADS];
+    Type_t *inputs[BENCH_MAX_THREADS];
+    Type_t *outputs[BENCH_MAX_THREADS];
+    Type_t *desired;
+
+    uint16_t batch_size;
+    uint16_t threads;
+}Bench_State_t;
+
+/**
+ * @brief Struct for one benchmark case & its result
+ *
+ */
+typedef struct _Bench_Case_t
+{
+    char name[BENCH_NAME_LEN];
+
+    // Runs (iterations) operations.
+    void (*run) (Bench_State_t *, uint64_t);
+    Bench_State_t state;
+
+    // The work of one operation.
+    double flops_per_op;
+    double bytes_per_op;
+    double samples_per_op;
+
+    // Inference cases must not allocate after the warm up.
+    bool steady_state;
+
+    // The result.
+    uint64_t iterations;
+    double ns_per_op;
+    double allocs_per_op;
+}Bench_Case_t;
+
+/**
+ * @brief Struct for one thread of a threaded case
+ *
+ */
+typedef struct _Bench_Thread_t
+{
+    Bench_State_t *state;
+    uint16_t thread_index;
+    uint64_t iterations;
+
+    // Summed by the calling thread after the join.
+    double sink;
+}Bench_Thread_t;
+
+/**
+ * @brief Struct for one result read back from a JSON file
+ *
+ */
+typedef struct _Bench_Record_t
+{
+    char name[BENCH_NAME_LEN];
+    double ns_per_op;
+}Bench_Record_t;
+
+static Bench_Case_t bench_cases[BENCH_MAX_CASES];
+static uint16_t bench_cases_num = 0;
+
+// Keeps the compiler from dropping the benchmarked work.
+static volatile double bench_sink = 0.0;
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to get a monotonic time in nanoseconds.
+ *
+ * @return double
+ */
+static double bench_now_ns(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+
+    return (double) counter.QuadPart * (1e9 / (double) frequency.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((double) now.tv_sec * 1e9) + (double) now.tv_nsec;
+#endif
+}//end bench_now_ns.
+
+/**
+ * @brief Function to create a network for a benchmark case.
+ *
+ * @param dense The input, hidden & output layers dense.
+ * @param hidden_layer_num
+ * @param state
+ */
+static void bench_network_state(uint16_t dense, uint16_t hidden_layer_num, Bench_State_t *state)
+{
+    // The topology & the config are kept by the network, so they live in the heap.
+    state->topology = (Network_Topology_t *) malloc(sizeof(Network_Topology_t));
+    state->config   = (Network_Config_t *)   malloc(sizeof(Network_Config_t));
+
+    if( (state->topology == NULL) || (state->config == NULL) )
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    const Network_Topology_t topology = {.input_layer_dense  = dense,
+                                         .hidden_layer_dense = dense,
+                                         .hidden_layer_num   = hidden_layer_num,
+                                         .output_layer_dense = dense,
+                                         .activation_function        = &ELU,
+                                         .output_activation_function = &SoftMax,
+                                         .loss_function              = &MCCE,
+                                         .optimizer_function         = &GradientDescent};
+
+    const Network_Config_t config = {.learning_rate = 0.01,
+                                     .dropout = false,
+                                     .epochs = 1,
+                                     .seed = 42,
+                                     .weight_init = INIT_HE_NORMAL,
+                                     .output_weight_init = INIT_XAVIER_UNIFORM};
+
+    memcpy(state->topology, &topology, sizeof(Network_Topology_t));
+    memcpy(state->config, &config, sizeof(Network_Config_t));
+
+    const uint16_t threads = (state->threads > 0) ? (state->threads) : (1);
+
+    for(uint16_t t = 0; t < threads; t++)
+    {
+        state->networks[t] = Create_Network(state->topology, state->config);
+
+        if(state->batch_size > 0)
+        {
+            state->inputs[t]  = create_matrix(state->batch_size, dense, false);
+            state->outputs[t] = create_matrix(state->batch_size, dense, false);
+            Init_Matrix(state->inputs[t], INIT_UNIFORM, 7, t);
+        }
+    }
+
+    // One-hot desired output of the training steps.
+    state->desired = create_vector(dense, false);
+    memset(state->desired->Vector_t.Vector, 0, sizeof(double) * dense);
+    state->desired->Vector_t.Vector[0] = 1.0;
+
+    return;
+}//end bench_network_state.
+
+/**
+ * @brief Function to add a benchmark case.
+ *
+ * @param name
+ * @param run
+ * @param state
+ * @param flops_per_op
+ * @param bytes_per_op
+ * @param samples_per_op
+ * @return Bench_Case_t* 
+ */
+static Bench_Case_t *bench_add(const char *name, void (*run) (Bench_State_t *, uint64_t), Bench_State_t *state,
+                      double flops_per_op, double bytes_per_op, double samples_per_op)
+{
+    if(bench_cases_num >= BENCH_MAX_CASES)
+        error_exit(CURRENT_C, "BENCH_CASES:MAX_LIMIT");
+
+    Bench_Case_t *bench_case = &bench_cases[bench_cases_num++];
+
+    snprintf(bench_case->name, BENCH_NAME_LEN, "%s", name);
+    bench_case->run            = run;
+    bench_case->state          = *state;
+    bench_case->flops_per_op   = flops_per_op;
+    bench_case->bytes_per_op   = bytes_per_op;
+    bench_case->samples_per_op = samples_per_op;
+    bench_case->steady_state   = false;
+    bench_case->iterations     = 0;
+    bench_case->ns_per_op      = 0.0;
+    bench_case->allocs_per_op  = 0.0;
+
+    return bench_case;
+}//end bench_add.
+
+//===> Case runners:
+
+static void bench_run_vxm(Bench_State_t *state, uint64_t iterations)
+{
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        double *result = VxM_DotProduct(state->vector, state->matrix);
+        bench_sink += result[0];
+        free(result);
+    }
+
+    return;
+}//end bench_run_vxm.
+
+static void bench_run_bxm(Bench_State_t *state, uint64_t iterations)
+{
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        BxM_DotProduct(state->batch, state->matrix, state->result, state->batch_size);
+        bench_sink += state->result->Matrix_t.Matrix[0][0];
+    }
+
+    return;
+}//end bench_run_bxm.
+
+static void bench_run_activation(Bench_State_t *state, uint64_t iterations)
+{
+    const uint16_t vector_len = state->vector->Vector_t.len; // Temporary variable for readability.
+
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        // Reload the inputs, the activations work in place.
+        memcpy(state->vector->Vector_t.Vector, state->batch->Matrix_t.Matrix[0], sizeof(double) * vector_len);
+
+        state->activation_function(state->vector);
+        bench_sink += state->vector->Vector_t.Vector[0];
+    }
+
+    return;
+}//end bench_run_activation.
+
+static void bench_run_forward(Bench_State_t *state, uint64_t iterations)
+{
+    DNN_Network *dnn_network = state->networks[0]; // (Temporary variable for readbility).
+
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        forward_propagation(dnn_network);
+        bench_sink += dnn_network->network_layers->Output_layer->output_layer->Vector_t.Vector[0];
+    }
+
+    return;
+}//end bench_run_forward.
+
+static void bench_run_create_free(Bench_State_t *state, uint64_t iterations)
+{
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        DNN_Network *dnn_network = Create_Network(state->topology, state->config);
+        bench_sink += dnn_network->network_layers->Layers_biases->layers_biases->Vector_t.Vector[0];
+        Free_Network(dnn_network);
+    }
+
+    return;
+}//end bench_run_create_free.
+
+static void bench_run_forward_batch(Bench_State_t *state, uint64_t iterations)
+{
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        forward_propagation_batch(state->networks[0], state->inputs[0], state->outputs[0], state->batch_size);
+        bench_sink += state->outputs[0]->Matrix_t.Matrix[0][0];
+    }
+
+    return;
+}//end bench_run_forward_batch.
+
+static void bench_run_predict_batch(Bench_State_t *state, uint64_t iterations)
+{
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        Predict_Batch_Network(state->networks[0], state->inputs[0], state->outputs[0], state->batch_size);
+        bench_sink += state->outputs[0]->Matrix_t.Matrix[0][0];
+    }
+
+    return;
+}//end bench_run_predict_batch.
+
+static void bench_run_predict_incremental(Bench_State_t *state, uint64_t iterations)
+{
+    DNN_Network *dnn_network = state->networks[0]; // (Temporary variable for readbility).
+    const uint16_t input_dense = dnn_network->network_topology->input_layer_dense;
+    double *output = state->vector->Vector_t.Vector;
+
+    // The changes go back & forth: The input stays the same.
+    uint16_t indices[BENCH_INCREMENTAL_CHANGES];
+    double deltas[BENCH_INCREMENTAL_CHANGES];
+
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        for(uint16_t c = 0; c < BENCH_INCREMENTAL_CHANGES; c++)
+        {
+            indices[c] = (uint16_t) ((i * 31 + c * 7) % input_dense);
+            deltas[c]  = (i & 1) ? (-0.25) : (0.25);
+        }
+
+        Predict_Incremental(dnn_network, indices, deltas, BENCH_INCREMENTAL_CHANGES, output, state->vector->Vector_t.len);
+        bench_sink += output[0];
+    }
+
+    return;
+}//end bench_run_predict_incremental.
+
+static void bench_run_predict_sparse(Bench_State_t *state, uint64_t iterations)
+{
+    DNN_Network *dnn_network = state->networks[0]; // (Temporary variable for readbility).
+    const uint16_t input_dense = dnn_network->network_topology->input_layer_dense;
+    double *output = state->vector->Vector_t.Vector;
+
+    // Hashed features: (nnz) spread indices, all 1.0.
+    uint16_t indices[BENCH_SPARSE_NNZ];
+
+    for(uint16_t k = 0; k < BENCH_SPARSE_NNZ; k++)
+        indices[k] = (uint16_t) ((k * 37 + 11) % input_dense);
+
+    const Sparse_Vector_t sparse = Sparse_Vector(indices, NULL, BENCH_SPARSE_NNZ, input_dense);
+
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        Predict_Sparse_Network(dnn_network, &sparse, output, state->vector->Vector_t.len);
+        bench_sink += output[0];
+    }
+
+    return;
+}//end bench_run_predict_sparse.
+
+static void bench_run_train_step(Bench_State_t *state, uint64_t iterations)
+{
+    DNN_Network *dnn_network = state->networks[0]; // (Temporary variable for readbility).
+
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        forward_propagation_train(dnn_network);
+        bench_sink += back_propagation(dnn_network, state->desired);
+        dnn_network->network_topology->optimizer_function(dnn_network);
+    }
+
+    return;
+}//end bench_run_train_step.
+
+static void bench_run_train_accumulate(Bench_State_t *state, uint64_t iterations)
+{
+    DNN_Network *dnn_network = state->networks[0]; // (Temporary variable for readbility).
+
+    for(uint64_t i = 0; i < iterations; i++)
+    {
+        // One optimizer step per (batch_size) accumulated samples.
+        for(uint16_t s = 0; s < state->batch_size; s++)
+        {
+            forward_propagation_train(dnn_network);
+            bench_sink += back_propagation(dnn_network, state->desired);
+        }
+
+        dnn_network->network_topology->optimizer_function(dnn_network);
+    }
+
+    return;
+}//end bench_run_train_accumulate.
+
+/**
+ * @brief Function to run the batched forward pass of one thread. (Thread entry)
+ *
+ * @param arg The Bench_Thread_t.
+ * @return void*
+ */
+static void *bench_thread_worker(void *arg)
+{
+    Bench_Thread_t *thread = (Bench_Thread_t *) arg;
+    Bench_State_t *state = thread->state;
+    const uint16_t t = thread->thread_index;
+
+    double sink = 0.0;
+
+    for(uint64_t i = 0; i < thread->iterations; i++)
+    {
+        forward_propagation_batch(state->networks[t], state->inputs[t], state->outputs[t], state->batch_size);
+        sink += state->outputs[t]->Matrix_t.Matrix[0][0];
+    }
+
+    thread->sink = sink;
+
+    return NULL;
+}//end bench_thread_worker.
+
+/**
+ * @brief Function to run (iterations) batches on every thread. (One network per thread)
+ *
+ * @param state
+ * @param iterations
+ */
+static void bench_run_threads(Bench_State_t *state, uint64_t iterations)
+{
+    pthread_t threads[BENCH_MAX_THREADS];
+    Bench_Thread_t jobs[BENCH_MAX_THREADS];
+
+    for(uint16_t t = 0; t < state->threads; t++)
+    {
+        jobs[t].state        = state;
+        jobs[t].thread_index = t;
+        jobs[t].iterations   = iterations;
+
+        if(pthread_create(&threads[t], NULL, bench_thread_worker, &jobs[t]) != 0)
+            error_exit(CURRENT_C, "BENCH_THREAD:CREATE_FAILED");
+    }
+
+    for(uint16_t t = 0; t < state->threads; t++)
+    {
+        pthread_join(threads[t], NULL);
+        bench_sink += jobs[t].sink;
+    }
+
+    return;
+}//end bench_run_threads.
+
+/**
+ * @brief Function to get the work of one forward pass of a sample.
+ *
+ * @param dense
+ * @param hidden_layer_num
+ * @param weights_num The number of weights. (Output)
+ * @return double The flops.
+ */
+static double bench_forward_flops(uint16_t dense, uint16_t hidden_layer_num, double *weights_num)
+{
+    *weights_num = (double) dense * dense * (hidden_layer_num + 1);
+
+    return 2.0 * (*weights_num);
+}//end bench_forward_flops.
+
+/**
+ * @brief Function to register all the benchmark cases.
+ *
+ */
+static void bench_register(void)
+{
+    const uint16_t sizes[]        = {16, 32, 64, 128, 200};
+    const uint16_t batch_sizes[]  = {1, 8, 32, 128, 200};
+    const uint16_t batch_tiles[]  = {16, 64, 200};
+    const uint16_t sizes_num       = sizeof(sizes) / sizeof(sizes[0]);
+    const uint16_t batch_sizes_num = sizeof(batch_sizes) / sizeof(batch_sizes[0]);
+    const uint16_t batch_tiles_num = sizeof(batch_tiles) / sizeof(batch_tiles[0]);
+    const uint16_t hidden_layer_num = 2;
+
+    char name[BENCH_NAME_LEN];
+
+    //===> Kernels: VxM_DotProduct. (n x n)
+    for(uint16_t s = 0; s < sizes_num; s++)
+    {
+        const uint16_t n = sizes[s];
+        Bench_State_t state = {0};
+
+        state.vector = create_vector(n, false);
+        state.matrix = create_matrix(n, n, false);
+        Init_Vector(state.vector, INIT_UNIFORM, 1, 0);
+        Init_Matrix(state.matrix, INIT_UNIFORM, 1, 1);
+
+        snprintf(name, BENCH_NAME_LEN, "kernel/VxM_DotProduct/n=%u", n);
+        bench_add(name, bench_run_vxm, &state, 2.0 * n * n, sizeof(double) * ((double) n * n + 2.0 * n), 1.0);
+    }
+
+    //===> Kernels: BxM_DotProduct. (batch x 128) * (128 x 128)
+    for(uint16_t b = 0; b < batch_sizes_num; b++)
+    {
+        const uint16_t n = 128;
+        Bench_State_t state = {.batch_size = batch_sizes[b]};
+
+        state.batch  = create_matrix(state.batch_size, n, false);
+        state.matrix = create_matrix(n, n, false);
+        state.result = create_matrix(state.batch_size, n, false);
+        Init_Matrix(state.batch, INIT_UNIFORM, 1, 0);
+        Init_Matrix(state.matrix, INIT_UNIFORM, 1, 1);
+
+        snprintf(name, BENCH_NAME_LEN, "kernel/BxM_DotProduct/n=%u/batch=%u", n, state.batch_size);
+        bench_add(name, bench_run_bxm, &state, 2.0 * n * n * state.batch_size,
+                  sizeof(double) * ((double) n * n + 2.0 * n * state.batch_size), state.batch_size);
+    }
+
+    //===> Activation functions. (200 neurons)
+    struct {const char *name; double *(*function) (Type_t *);} activations[] =
+    {
+        {"ReLU", &ReLU}, {"ELU", &ELU}, {"Sigmoid", &Sigmoid}, {"Tanh", &Tanh}, {"SoftMax", &SoftMax}
+    };
+
+    for(uint16_t a = 0; a < sizeof(activations) / sizeof(activations[0]); a++)
+    {
+        const uint16_t n = MAX_VECTOR_LEN;
+        Bench_State_t state = {.activation_function = activations[a].function};
+
+        state.vector = create_vector(n, false);
+        state.batch  = create_matrix(1, n, false);
+        Init_Matrix(state.batch, INIT_NORMAL, 1, 0);
+
+        snprintf(name, BENCH_NAME_LEN, "activation/%s/n=%u", activations[a].name, n);
+        bench_add(name, bench_run_activation, &state, n, sizeof(double) * 2.0 * n, 1.0);
+    }
+
+    //===> Networks: forward_propagation & training steps. (One sample)
+    for(uint16_t s = 0; s < sizes_num; s++)
+    {
+        const uint16_t n = sizes[s];
+        double weights_num;
+        const double flops = bench_forward_flops(n, hidden_layer_num, &weights_num);
+
+        Bench_State_t state = {0};
+        bench_network_state(n, hidden_layer_num, &state);
+
+        snprintf(name, BENCH_NAME_LEN, "network/forward_propagation/dense=%u/layers=%u", n, hidden_layer_num);
+        bench_add(name, bench_run_forward, &state, flops, sizeof(double) * weights_num, 1.0)->steady_state = true;
+
+        Bench_State_t train_state = {0};
+        bench_network_state(n, hidden_layer_num, &train_state);
+
+        // Forward + deltas + weights gradients, then the update reads & writes weights & gradients.
+        snprintf(name, BENCH_NAME_LEN, "network/train_step/dense=%u/layers=%u", n, hidden_layer_num);
+        bench_add(name, bench_run_train_step, &train_state, (3.0 * flops) + (2.0 * weights_num),
+                  sizeof(double) * weights_num * 7.0, 1.0);
+
+        // The same samples with one update per 32 of them.
+        Bench_State_t accumulate_state = {0};
+        bench_network_state(n, hidden_layer_num, &accumulate_state);
+        accumulate_state.batch_size = 32;
+
+        snprintf(name, BENCH_NAME_LEN, "network/train_accumulate/dense=%u/layers=%u/batch=%u", n, hidden_layer_num, accumulate_state.batch_size);
+        bench_add(name, bench_run_train_accumulate, &accumulate_state, 
+                  accumulate_state.batch_size * (3.0 * flops) + (2.0 * weights_num),
+                  sizeof(double) * weights_num * (3.0 * accumulate_state.batch_size + 4.0), accumulate_state.batch_size);
+
+        // Construction & teardown. (The weights are written once by the initializer)
+        snprintf(name, BENCH_NAME_LEN, "network/create_free/dense=%u/layers=%u", n, hidden_layer_num);
+        bench_add(name, bench_run_create_free, &state, 0.0, sizeof(double) * weights_num, 1.0);
+    }
+
+    //===> Networks: forward_propagation_batch.
+    for(uint16_t b = 0; b < batch_sizes_num; b++)
+    {
+        const uint16_t n = 128;
+        double weights_num;
+        const double flops = bench_forward_flops(n, hidden_layer_num, &weights_num);
+
+        Bench_State_t state = {.batch_size = batch_sizes[b]};
+        bench_network_state(n, hidden_layer_num, &state);
+
+        snprintf(name, BENCH_NAME_LEN, "network/forward_propagation_batch/dense=%u/layers=%u/batch=%u",
+                 n, hidden_layer_num, state.batch_size);
+        bench_add(name, bench_run_forward_batch, &state, flops * state.batch_size,
+                  sizeof(double) * (weights_num + 2.0 * n * state.batch_size), state.batch_size)->steady_state = true;
+    }
+
+    //===> Networks: Depth-first batch tiles of a deep network. (tile=200: Layer by layer)
+    for(uint16_t t = 0; t < batch_tiles_num; t++)
+    {
+        const uint16_t n = 128;
+        double weights_num;
+        const double flops = bench_forward_flops(n, MAX_HIDDEN_LAYER_NUM, &weights_num);
+
+        Bench_State_t state = {.batch_size = 200};
+        bench_network_state(n, MAX_HIDDEN_LAYER_NUM, &state);
+        Set_Batch_Tile(state.networks[0], batch_tiles[t]);
+
+        snprintf(name, BENCH_NAME_LEN, "network/forward_batch_tiled/dense=%u/layers=%u/batch=%u/tile=%u",
+                 n, MAX_HIDDEN_LAYER_NUM, state.batch_size, batch_tiles[t]);
+        bench_add(name, bench_run_forward_batch, &state, flops * state.batch_size,
+                  sizeof(double) * (weights_num + 2.0 * n * state.batch_size), state.batch_size)->steady_state = true;
+    }
+
+    //===> Networks: The tile picked by the autotuner on this machine. (Timed here, no tuning cache)
+    {
+        const uint16_t n = 128;
+        double weights_num;
+        const double flops = bench_forward_flops(n, MAX_HIDDEN_LAYER_NUM, &weights_num);
+
+        Bench_State_t state = {.batch_size = 200};
+        bench_network_state(n, MAX_HIDDEN_LAYER_NUM, &state);
+        Tune_Network(state.networks[0], state.batch_size, NULL, NULL);
+
+        snprintf(name, BENCH_NAME_LEN, "network/forward_batch_tiled/dense=%u/layers=%u/batch=%u/tile=tuned",
+                 n, MAX_HIDDEN_LAYER_NUM, state.batch_size);
+        bench_add(name, bench_run_forward_batch, &state, flops * state.batch_size,
+                  sizeof(double) * (weights_num + 2.0 * n * state.batch_size), state.batch_size)->steady_state = true;
+    }
+
+    //===> Networks: Repeated inputs answered by the results cache. (All hits after the warm up)
+    {
+        const uint16_t n = 128;
+
+        Bench_State_t state = {.batch_size = 32};
+        bench_network_state(n, hidden_layer_num, &state);
+        Attach_Cache(state.networks[0], Cache_Create(1024, n, n));
+
+        snprintf(name, BENCH_NAME_LEN, "network/predict_batch_cached/dense=%u/layers=%u/batch=%u",
+                 n, hidden_layer_num, state.batch_size);
+        bench_add(name, bench_run_predict_batch, &state, 0.0,
+                  sizeof(double) * 2.0 * n * state.batch_size, state.batch_size)->steady_state = true;
+    }
+
+    //===> Networks: A few changed inputs per pass. (Incremental first layer, compare with forward_propagation)
+    {
+        const uint16_t n = 200;
+        double weights_num;
+        const double flops = bench_forward_flops(n, hidden_layer_num, &weights_num);
+        const double first_layer_flops = 2.0 * n * n;
+
+        Bench_State_t state = {0};
+        bench_network_state(n, hidden_layer_num, &state);
+        state.vector = create_vector(n, false);
+        Predict_Incremental_Reset(state.networks[0], state.desired->Vector_t.Vector, n, state.vector->Vector_t.Vector, n);
+
+        snprintf(name, BENCH_NAME_LEN, "network/predict_incremental/dense=%u/layers=%u/changes=%u",
+                 n, hidden_layer_num, BENCH_INCREMENTAL_CHANGES);
+        bench_add(name, bench_run_predict_incremental, &state, flops - first_layer_flops + (2.0 * BENCH_INCREMENTAL_CHANGES * n),
+                  sizeof(double) * (weights_num - (n * n) + (BENCH_INCREMENTAL_CHANGES * n)), 1.0)->steady_state = true;
+
+        // The same network with a sparse input. (The first layer reads nnz columns)
+        Bench_State_t sparse_state = {0};
+        bench_network_state(n, hidden_layer_num, &sparse_state);
+        sparse_state.vector = create_vector(n, false);
+
+        snprintf(name, BENCH_NAME_LEN, "network/predict_sparse/dense=%u/layers=%u/nnz=%u", n, hidden_layer_num, BENCH_SPARSE_NNZ);
+        bench_add(name, bench_run_predict_sparse, &sparse_state, flops - first_layer_flops + (2.0 * BENCH_SPARSE_NNZ * n),
+                  sizeof(double) * (weights_num - (n * n) + (BENCH_SPARSE_NNZ * n)), 1.0)->steady_state = true;
+    }
+
+    //===> Networks: Pruned weights. (The sparse kernels, compare with forward_propagation)
+    for(uint8_t m = 0; m < 2; m++)
+    {
+        const uint16_t n = 200;
+        const Prune_Method_t method = (m == 0) ? (PRUNE_MAGNITUDE) : (PRUNE_BLOCK);
+        double weights_num;
+        const double flops = bench_forward_flops(n, hidden_layer_num, &weights_num);
+        const double kept = 1.0 - BENCH_PRUNE_SPARSITY;
+
+        Bench_State_t state = {0};
+        bench_network_state(n, hidden_layer_num, &state);
+        Prune_Network(state.networks[0], BENCH_PRUNE_SPARSITY, method);
+
+        // (Each kept weight: Its value & its column)
+        snprintf(name, BENCH_NAME_LEN, "network/forward_pruned/dense=%u/layers=%u/sparsity=%.0f/%s", n, hidden_layer_num,
+                 100.0 * BENCH_PRUNE_SPARSITY, (method == PRUNE_BLOCK) ? ("block") : ("magnitude"));
+        bench_add(name, bench_run_forward, &state, flops * kept,
+                  (sizeof(double) + sizeof(uint16_t)) * weights_num * kept, 1.0)->steady_state = true;
+    }
+
+    //===> Networks: Low rank factorized weights. (Two smaller products per layer, compare with forward_propagation)
+    {
+        const uint16_t n = 200;
+        double weights_num;
+        const double flops = bench_forward_flops(n, hidden_layer_num, &weights_num);
+
+        Bench_State_t state = {0};
+        bench_network_state(n, hidden_layer_num, &state);
+        Factorize_Network(state.networks[0], LOWRANK_TARGET_SPEEDUP, BENCH_LOWRANK_SPEEDUP, NULL, 0, NULL);
+
+        snprintf(name, BENCH_NAME_LEN, "network/forward_lowrank/dense=%u/layers=%u/speedup=%.0f", n, hidden_layer_num, BENCH_LOWRANK_SPEEDUP);
+        bench_add(name, bench_run_forward, &state, flops / BENCH_LOWRANK_SPEEDUP,
+                  sizeof(double) * weights_num / BENCH_LOWRANK_SPEEDUP, 1.0)->steady_state = true;
+    }
+
+    //===> Networks: 16 bits weights. (Compare with forward_propagation & forward_propagation_batch)
+    for(uint8_t f = 0; f < 2; f++)
+    {
+        const Half_Format_t format = (f == 0) ? (HALF_FORMAT_BF16) : (HALF_FORMAT_FP16);
+
+        {
+            const uint16_t n = 200;
+            double weights_num;
+            const double flops = bench_forward_flops(n, hidden_layer_num, &weights_num);
+
+            Bench_State_t state = {0};
+            bench_network_state(n, hidden_layer_num, &state);
+            Compress_Network(state.networks[0], format);
+
+            snprintf(name, BENCH_NAME_LEN, "network/forward_half/dense=%u/layers=%u/%s", n, hidden_layer_num, Half_Format_Name(format));
+            bench_add(name, bench_run_forward, &state, flops, sizeof(uint16_t) * weights_num, 1.0)->steady_state = true;
+        }
+
+        {
+            const uint16_t n = 128;
+            double weights_num;
+            const double flops = bench_forward_flops(n, hidden_layer_num, &weights_num);
+
+            Bench_State_t state = {.batch_size = 32};
+            bench_network_state(n, hidden_layer_num, &state);
+            Compress_Network(state.networks[0], format);
+
+            snprintf(name, BENCH_NAME_LEN, "network/forward_half_batch/dense=%u/layers=%u/batch=%u/%s",
+                     n, hidden_layer_num, state.batch_size, Half_Format_Name(format));
+            bench_add(name, bench_run_forward_batch, &state, flops * state.batch_size,
+                      (sizeof(uint16_t) * weights_num) + (sizeof(double) * 2.0 * n * state.batch_size), state.batch_size)->steady_state = true;
+        }
+    }
+
+    //===> Threads: Independent batched forward passes. (Throughput scaling)
+    uint16_t max_threads = get_threads_num();
+
+    if(max_threads > BENCH_MAX_THREADS)
+        max_threads = BENCH_MAX_THREADS;
+
+    // 1, 2, 4, .. & the number of hardware threads.
+    for(uint16_t threads = 1; ; threads = (threads * 2 < max_threads) ? (threads * 2) : (max_threads))
+    {
+        const uint16_t n = 128;
+        double weights_num;
+        const double flops = bench_forward_flops(n, hidden_layer_num, &weights_num);
+
+        Bench_State_t state = {.batch_size = 32, .threads = threads};
+        bench_network_state(n, hidden_layer_num, &state);
+
+        const double samples = (double) state.batch_size * threads;
+
+        snprintf(name, BENCH_NAME_LEN, "threads/forward_propagation_batch/dense=%u/batch=%u/threads=%u",
+                 n, state.batch_size, threads);
+        bench_add(name, bench_run_threads, &state, flops * samples,
+                  sizeof(double) * (weights_num + 2.0 * n * state.batch_size) * threads, samples);
+
+        if(threads == max_threads)
+            break;
+    }
+
+    return;
+}//end bench_register.
+
+/**
+ * @brief Function to measure one benchmark case.
+ *
+ * @param bench_case
+ * @param min_time_ns
+ * @param repeats
+ */
+static void bench_measure(Bench_Case_t *bench_case, double min_time_ns, uint16_t repeats)
+{
+    // Warm up. (Lazy workspaces, caches & page faults)
+    bench_case->run(&bench_case->state, 1);
+
+    // Count the heap allocations of all the measured runs.
+    const uint64_t allocations_start = Memory_Allocations();
+    uint64_t total_iterations = 0;
+
+    // Find the iterations of one (min_time) run.
+    uint64_t iterations = 1;
+    double elapsed = 0.0;
+
+    for(;;)
+    {
+        const double start = bench_now_ns();
+        bench_case->run(&bench_case->state, iterations);
+        elapsed = bench_now_ns() - start;
+        total_iterations += iterations;
+
+        if(elapsed >= min_time_ns)
+            break;
+
+        // Jump close to the target, but never more than x10 at once.
+        double scale = (elapsed > 0.0) ? ((min_time_ns * 1.2) / elapsed) : (10.0);
+
+        if(scale > 10.0)
+            scale = 10.0;
+
+        if(scale < 2.0)
+            scale = 2.0;
+
+        iterations = (uint64_t) (iterations * scale);
+    }
+
+    // Keep the fastest run.
+    double best = elapsed;
+
+    for(uint16_t r = 1; r < repeats; r++)
+    {
+        const double start = bench_now_ns();
+        bench_case->run(&bench_case->state, iterations);
+        elapsed = bench_now_ns() - start;
+        total_iterations += iterations;
+
+        if(elapsed < best)
+            best = elapsed;
+    }
+
+    bench_case->iterations    = iterations;
+    bench_case->ns_per_op     = best / (double) iterations;
+    bench_case->allocs_per_op = (double) (Memory_Allocations() - allocations_start) / (double) total_iterations;
+
+    return;
+}//end bench_measure.
+
+/**
+ * @brief Function to print the result of a case as a table line.
+ *
+ * @param bench_case
+ */
+static void bench_print(const Bench_Case_t *bench_case)
+{
+    const double seconds_per_op = bench_case->ns_per_op * 1e-9;
+
+    printf("%-72s %14.1f ns/op %9.3f GFLOP/s %9.3f GB/s %14.1f samples/s %8.2f allocs/op\n",
+           bench_case->name, bench_case->ns_per_op,
+           (bench_case->flops_per_op / seconds_per_op) * 1e-9,
+           (bench_case->bytes_per_op / seconds_per_op) * 1e-9,
+           bench_case->samples_per_op / seconds_per_op, bench_case->allocs_per_op);
+
+    return;
+}//end bench_print.
+
+/**
+ * @brief Function to write the results as JSON. (One result object per line)
+ *
+ * @param path
+ * @param min_time_ms
+ * @param repeats
+ */
+static void bench_write_json(const char *path, double min_time_ms, uint16_t repeats)
+{
+    FILE *file = fopen(path, "w");
+
+    if(file == NULL)
+        error_exit(CURRENT_C, "JSON_FILE:OPEN_FAILED");
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"schema\": %u,\n", BENCH_SCHEMA_VERSION);
+    fprintf(file, "  \"timestamp\": %lld,\n", (long long) time(NULL));
+    fprintf(file, "  \"threads_available\": %u,\n", get_threads_num());
+    fprintf(file, "  \"min_time_ms\": %.1f,\n", min_time_ms);
+    fprintf(file, "  \"repeats\": %u,\n", repeats);
+    fprintf(file, "  \"results\": [\n");
+
+    bool first = true;
+
+    for(uint16_t c = 0; c < bench_cases_num; c++)
+    {
+        const Bench_Case_t *bench_case = &bench_cases[c];
+
+        // Filtered out.
+        if(bench_case->iterations == 0)
+            continue;
+
+        const double seconds_per_op = bench_case->ns_per_op * 1e-9;
+
+        fprintf(file, "%s    {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, \"gflops\": %.6f, "
+                      "\"bytes_per_op\": %.0f, \"gbytes_per_sec\": %.6f, \"samples_per_sec\": %.3f, \"allocs_per_op\": %.3f}",
+                (first) ? ("") : (",\n"), bench_case->name, (unsigned long long) bench_case->iterations,
+                bench_case->ns_per_op, (bench_case->flops_per_op / seconds_per_op) * 1e-9,
+                bench_case->bytes_per_op, (bench_case->bytes_per_op / seconds_per_op) * 1e-9,
+                bench_case->samples_per_op / seconds_per_op, bench_case->allocs_per_op);
+
+        first = false;
+    }
+
+    fprintf(file, "\n  ]\n}\n");
+    fclose(file);
+
+    return;
+}//end bench_write_json.
+
+/**
+ * @brief Function to read the (name, ns_per_op) of every result of a JSON file written by ann_bench.
+ *
+ * @param path
+ * @param records [BENCH_MAX_CASES]
+ * @return uint16_t The number of records.
+ */
+static uint16_t bench_read_json(const char *path, Bench_Record_t *records)
+{
+    FILE *file = fopen(path, "r");
+
+    if(file == NULL)
+        error_exit(CURRENT_C, "JSON_FILE:OPEN_FAILED");
+
+    char line[BENCH_LINE_LEN];
+    uint16_t records_num = 0;
+
+    while( (fgets(line, sizeof(line), file) != NULL) && (records_num < BENCH_MAX_CASES) )
+    {
+        const char *name = strstr(line, "\"name\": \"");
+        const char *ns_per_op = strstr(line, "\"ns_per_op\": ");
+
+        if( (name == NULL) || (ns_per_op == NULL) )
+            continue;
+
+        name += strlen("\"name\": \"");
+        const char *name_end = strchr(name, '"');
+
+        if( (name_end == NULL) || ((size_t) (name_end - name) >= BENCH_NAME_LEN) )
+            continue;
+
+        memcpy(records[records_num].name, name, name_end - name);
+        records[records_num].name[name_end - name] = '\0';
+        records[records_num].ns_per_op = strtod(ns_per_op + strlen("\"ns_per_op\": "), NULL);
+
+        records_num++;
+    }
+
+    fclose(file);
+
+    return records_num;
+}//end bench_read_json.
+
+/**
+ * @brief Function to compare two runs.
+ *
+ * @param base_path
+ * @param new_path
+ * @param threshold The allowed slow down. (Percent)
+ * @return int 1 if a case regressed, otherwise 0.
+ */
+static int bench_compare(const char *base_path, const char *new_path, double threshold)
+{
+    static Bench_Record_t base_records[BENCH_MAX_CASES];
+    static Bench_Record_t new_records[BENCH_MAX_CASES];
+
+    const uint16_t base_num = bench_read_json(base_path, base_records);
+    const uint16_t new_num  = bench_read_json(new_path, new_records);
+
+    uint16_t regressions = 0, compared = 0;
+
+    printf("%-72s %14s %14s %9s\n", "case", "base ns/op", "new ns/op", "change");
+
+    for(uint16_t n = 0; n < new_num; n++)
+    {
+        for(uint16_t b = 0; b < base_num; b++)
+        {
+            if(strcmp(new_records[n].name, base_records[b].name) != 0)
+                continue;
+
+            const double change = ((new_records[n].ns_per_op / base_records[b].ns_per_op) - 1.0) * 100.0;
+            const bool regressed = (change > threshold);
+
+            printf("%-72s %14.1f %14.1f %+8.1f%% %s\n", new_records[n].name, base_records[b].ns_per_op,
+                   new_records[n].ns_per_op, change, (regressed) ? ("REGRESSION") : (""));
+
+            regressions += regressed;
+            compared++;
+            break;
+        }
+    }
+
+    printf("\n%u cases compared, %u slower than %.1f%%\n", compared, regressions, threshold);
+
+    return (regressions > 0) ? (1) : (0);
+}//end bench_compare.
+
+/**
+ * @brief Function to print the usage.
+ *
+ */
+static void bench_usage(void)
+{
+    fprintf(stderr, "usage: ann_bench [--json FILE] [--filter TEXT] [--min-time MS] [--repeats N]\n"
+                    "       ann_bench --compare BASE.json NEW.json [--threshold PERCENT]\n");
+
+    return;
+}//end bench_usage.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTIONS                        -
+----------------------------------------------------------------
+*/
+
+int main(int argc, char **argv)
+{
+    const char *json_path = NULL, *filter = NULL;
+    const char *compare_paths[2] = {NULL, NULL};
+    double min_time_ms = BENCH_MIN_TIME_MS, threshold = BENCH_THRESHOLD;
+    uint16_t repeats = BENCH_REPEATS;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if( (strcmp(argv[i], "--json") == 0) && (i + 1 < argc) )
+            json_path = argv[++i];
+        else if( (strcmp(argv[i], "--filter") == 0) && (i + 1 < argc) )
+            filter = argv[++i];
+        else if( (strcmp(argv[i], "--min-time") == 0) && (i + 1 < argc) )
+            min_time_ms = strtod(argv[++i], NULL);
+        else if( (strcmp(argv[i], "--repeats") == 0) && (i + 1 < argc) )
+            repeats = (uint16_t) strtoul(argv[++i], NULL, 10);
+        else if( (strcmp(argv[i], "--threshold") == 0) && (i + 1 < argc) )
+            threshold = strtod(argv[++i], NULL);
+        else if( (strcmp(argv[i], "--compare") == 0) && (i + 2 < argc) )
+        {
+            compare_paths[0] = argv[++i];
+            compare_paths[1] = argv[++i];
+        }
+        else
+        {
+            bench_usage();
+            return 2;
+        }
+    }
+
+    // Compare mode.
+    if(compare_paths[0] != NULL)
+        return bench_compare(compare_paths[0], compare_paths[1], threshold);
+
+    if( (min_time_ms <= 0.0) || (repeats == 0) )
+    {
+        bench_usage();
+        return 2;
+    }
+
+    bench_register();
+
+    uint16_t steady_state_failures = 0;
+
+    for(uint16_t c = 0; c < bench_cases_num; c++)
+    {
+        if( (filter != NULL) && (strstr(bench_cases[c].name, filter) == NULL) )
+            continue;
+
+        bench_measure(&bench_cases[c], min_time_ms * 1e6, repeats);
+        bench_print(&bench_cases[c]);
+
+        if( (bench_cases[c].steady_state == true) && (bench_cases[c].allocs_per_op > 0.0) )
+        {
+            printf("STEADY STATE ALLOCATION: %s\n", bench_cases[c].name);
+            steady_state_failures++;
+        }
+
+        fflush(stdout);
+    }
+
+    if(json_path != NULL)
+        bench_write_json(json_path, min_time_ms, repeats);
+
+    return (steady_state_failures > 0) ? (1) : (0);
+}
+
+//!=============================> .END
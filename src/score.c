@@ -0,0 +1,908 @@
+/**
+ * @file score.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Offline bulk scoring pipeline of large input files. (ann_score)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#include <errno.h>
+
+#define CURRENT_H "SCORE.H"
+#define CURRENT_C "SCORE.C"
+
+/*
+    - Usage:
+        ann_score --model FILE --input FILE --output FILE [--output-format binary|csv]
+                  [--workers N] [--batch N]
+            Writes the predictions of every input row, in the input order, & reports rows/sec.
+
+    - Input files:
+        Binary: A dataset file. (Dataset_CSV_To_Binary) Its input_dense first values of every
+                row are scored, the outputs (if any) are ignored. The file is memory mapped.
+        CSV:    One row of input_dense values per line. (Same rules as the dataset CSV files)
+
+    - Output files: (Default: The input format)
+        Binary: A dataset header (input_dense 0, output_dense) & the output rows.
+        CSV:    One line of output_dense values per row.
+
+    - Pipeline: (SCORE_SLOTS_PER_WORKER chunks in flight per worker)
+        [Reader]  => Cuts the input into chunks of rows. (Mapped rows or whole CSV lines)
+        [Workers] => Parse, run the batched forward pass & format their chunk. (In any order)
+        [Writer]  => Writes the chunks in order while the next ones are computed.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define SCORE_MAX_WORKERS      ((const uint16_t) 64)
+#define SCORE_BATCH            ((const uint16_t) 64)
+#define SCORE_CHUNK_ROWS       ((const uint32_t) 8192)        // Rows per binary chunk.
+#define SCORE_CHUNK_BYTES      ((const uint32_t) (1u << 20))  // Bytes per CSV chunk. (Plus one partial line)
+#define SCORE_SLOTS_PER_WORKER ((const uint16_t) 3)
+#define SCORE_VALUE_CHARS      ((const uint16_t) 26)          // Longest "%.17g," value.
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Enum for the states of a pipeline chunk
+ *
+ */
+typedef enum _Score_Chunk_State_t
+{
+    SCORE_CHUNK_FREE = 0,   // Owned by the reader.
+    SCORE_CHUNK_READ,       // Waiting for a worker.
+    SCORE_CHUNK_SCORING,    // Owned by a worker.
+    SCORE_CHUNK_SCORED      // Waiting for the writer.
+}Score_Chunk_State_t;
+
+/**
+ * @brief Struct for one chunk of rows going through the pipeline
+ *
+ */
+typedef struct _Score_Chunk_t
+{
+    uint64_t sequence;
+    Score_Chunk_State_t state;
+
+    // Binary input: Rows [first_row, first_row + rows) of the mapping.
+    uint64_t first_row;
+    uint32_t rows;
+
+    // CSV input: Whole lines. (NUL terminated)
+    char  *text;
+    size_t text_len;
+    bool   first_lines; // Holds the first line of the file. (May be a header)
+
+    // The formatted predictions.
+    char  *output;
+    size_t output_len;
+    size_t output_capacity;
+    uint64_t output_rows;
+}Score_Chunk_t;
+
+/**
+ * @brief Struct for the pipeline state
+ *
+ */
+typedef struct _Score_Pipeline_t
+{
+    //===> Settings:
+    const char *model_path;
+    const char *input_path;
+    const char *output_path;
+    Dataset_Format_t input_format;
+    Dataset_Format_t output_format;
+    uint16_t workers;
+    uint16_t batch_size;
+
+    uint16_t input_dense;
+    uint16_t output_dense;
+
+    //===> Input:
+    int input_fd;
+    const double *samples;      // Binary: The mapped rows.
+    void  *mapping;
+    size_t mapping_size;
+    uint64_t samples_num;
+    uint16_t row_stride;
+
+    //===> Chunks: (Chunk s lives in slots[s % slots_num])
+    Score_Chunk_t *slots;
+    uint16_t slots_num;
+
+    uint64_t next_claim;        // Next chunk for a worker.
+    uint64_t chunks_num;        // Known when the reader is done. (UINT64_MAX before)
+    bool failed;
+    char failure[128];
+
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+
+    //===> Results:
+    uint64_t rows_scored;
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+}Score_Pipeline_t;
+
+/**
+ * @brief Struct for one worker
+ *
+ */
+typedef struct _Score_Worker_t
+{
+    Score_Pipeline_t *pipeline;
+    DNN_Network *dnn_network;
+}Score_Worker_t;
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+static void score_usage(void)
+{
+    printf("Usage:\n"
+           "  ann_score --model FILE --input FILE --output FILE [--output-format binary|csv]\n"
+           "            [--workers N] [--batch N]\n");
+
+    return;
+}//end score_usage.
+
+/**
+ * @brief Function to get the default workers: One per online CPU, up to SCORE_MAX_WORKERS.
+ *
+ * @return long (At least 1)
+ */
+static long score_default_workers(void)
+{
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if(cpus < 1)
+        return 1;
+
+    return (cpus > SCORE_MAX_WORKERS) ? (SCORE_MAX_WORKERS) : (cpus);
+}//end score_default_workers.
+
+/**
+ * @brief Function to stop the pipeline on an error. (Reported by main)
+ *
+ * @param pipeline
+ * @param failure
+ */
+static void score_fail(Score_Pipeline_t *pipeline, const char *failure)
+{
+    pthread_mutex_lock(&pipeline->lock);
+
+    if(pipeline->failed == false)
+        snprintf(pipeline->failure, sizeof(pipeline->failure), "%s", failure);
+
+    pipeline->failed = true;
+    pthread_cond_broadcast(&pipeline->changed);
+    pthread_mutex_unlock(&pipeline->lock);
+
+    return;
+}//end score_fail.
+
+/**
+ * @brief Function to make room for (size) more output bytes in a chunk.
+ *
+ * @param chunk
+ * @param size
+ */
+static void score_reserve_output(Score_Chunk_t *chunk, size_t size)
+{
+    if(chunk->output_len + size <= chunk->output_capacity)
+        return;
+
+    size_t capacity = (chunk->output_capacity > 0) ? (chunk->output_capacity) : (SCORE_CHUNK_BYTES);
+
+    while(capacity < chunk->output_len + size)
+        capacity *= 2;
+
+    char *output = (char *) realloc(chunk->output, capacity);
+
+    if(output == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    chunk->output = output;
+    chunk->output_capacity = capacity;
+
+    return;
+}//end score_reserve_output.
+
+/**
+ * @brief Function to append the predictions of a batch to a chunk.
+ *
+ * @param pipeline
+ * @param chunk
+ * @param outputs
+ * @param rows
+ */
+static void score_append(Score_Pipeline_t *pipeline, Score_Chunk_t *chunk, Type_t *outputs, uint16_t rows)
+{
+    const uint16_t output_dense = pipeline->output_dense; // Temporary variable for readability.
+
+    if(pipeline->output_format == DATASET_FORMAT_BINARY)
+    {
+        score_reserve_output(chunk, sizeof(double) * output_dense * rows);
+
+        for(uint16_t r = 0; r < rows; r++)
+        {
+            memcpy(chunk->output + chunk->output_len, outputs->Matrix_t.Matrix[r], sizeof(double) * output_dense);
+            chunk->output_len += sizeof(double) * output_dense;
+        }
+    }
+    else
+    {
+        score_reserve_output(chunk, (size_t) SCORE_VALUE_CHARS * output_dense * rows);
+
+        for(uint16_t r = 0; r < rows; r++)
+        {
+            for(uint16_t c = 0; c < output_dense; c++)
+            {
+                chunk->output_len += (size_t) snprintf(chunk->output + chunk->output_len, SCORE_VALUE_CHARS, "%.17g%c",
+                                                       outputs->Matrix_t.Matrix[r][c], (c + 1 < output_dense) ? (',') : ('\n'));
+            }
+        }
+    }
+
+    chunk->output_rows += rows;
+
+    return;
+}//end score_append.
+
+/**
+ * @brief Function to score a binary chunk: The batches are row views into the mapping. (No copy)
+ *
+ * @param worker
+ * @param chunk
+ * @param input_rows [batch_size] Row pointers.
+ * @param outputs
+ * @return bool
+ */
+static bool score_binary_chunk(Score_Worker_t *worker, Score_Chunk_t *chunk, double **input_rows, Type_t *outputs)
+{
+    Score_Pipeline_t *pipeline = worker->pipeline; // (Temporary variable for readbility).
+
+    Type_t inputs = {.Matrix_t = {.row = (uint8_t) pipeline->batch_size, .col = (uint8_t) pipeline->input_dense, .Matrix = input_rows}};
+
+    for(uint32_t done = 0; done < chunk->rows; )
+    {
+        const uint16_t rows = ((chunk->rows - done) < pipeline->batch_size) ? ((uint16_t) (chunk->rows - done)) : (pipeline->batch_size);
+
+        for(uint16_t r = 0; r < rows; r++)
+            input_rows[r] = (double *) (pipeline->samples + ((chunk->first_row + done + r) * pipeline->row_stride));
+
+        if(Predict_Batch_Network(worker->dnn_network, &inputs, outputs, rows) != ANN_OK)
+            return false;
+
+        score_append(pipeline, chunk, outputs, rows);
+        done += rows;
+    }
+
+    return true;
+}//end score_binary_chunk.
+
+/**
+ * @brief Function to score a CSV chunk: Parse its lines by batches.
+ *
+ * @param worker
+ * @param chunk
+ * @param inputs
+ * @param outputs
+ * @return bool
+ */
+static bool score_csv_chunk(Score_Worker_t *worker, Score_Chunk_t *chunk, Type_t *inputs, Type_t *outputs)
+{
+    Score_Pipeline_t *pipeline = worker->pipeline; // (Temporary variable for readbility).
+
+    char *line = chunk->text;
+    char *text_end = chunk->text + chunk->text_len;
+    bool first_line = chunk->first_lines;
+    uint16_t rows = 0;
+
+    while(line < text_end)
+    {
+        char *line_end = memchr(line, '\n', (size_t) (text_end - line));
+
+        if(line_end == NULL)
+            line_end = text_end;
+
+        *line_end = '\0';
+
+        if( (line[0] != '\0') && (line[0] != '\r') && (line[0] != '#') )
+        {
+            if(dataset_parse_csv_line(line, inputs->Matrix_t.Matrix[rows], pipeline->input_dense))
+            {
+                rows++;
+            }
+            else if(first_line == false)
+            {
+                // Only the first line may be a non numeric (header) line.
+                return false;
+            }
+        }
+
+        first_line = false;
+        line = line_end + 1;
+
+        if( (rows == pipeline->batch_size) || ((line >= text_end) && (rows > 0)) )
+        {
+            if(Predict_Batch_Network(worker->dnn_network, inputs, outputs, rows) != ANN_OK)
+                return false;
+
+            score_append(pipeline, chunk, outputs, rows);
+            rows = 0;
+        }
+    }
+
+    return true;
+}//end score_csv_chunk.
+
+/**
+ * @brief A worker: Scores the read chunks in any order. (Thread entry)
+ *
+ * @param arg The Score_Worker_t.
+ * @return void*
+ */
+static void *score_worker(void *arg)
+{
+    Score_Worker_t *worker = (Score_Worker_t *) arg;
+    Score_Pipeline_t *pipeline = worker->pipeline;
+
+    Trace_Thread_Name("score_worker");
+
+    // The batch buffers. (Created once)
+    Type_t *inputs  = create_matrix(pipeline->batch_size, pipeline->input_dense, false);
+    Type_t *outputs = create_matrix(pipeline->batch_size, pipeline->output_dense, false);
+    double *input_rows[MAX_MATRIX_ROW];
+
+    while(true)
+    {
+        pthread_mutex_lock(&pipeline->lock);
+
+        Score_Chunk_t *chunk = NULL;
+
+        while(pipeline->failed == false)
+        {
+            if(pipeline->next_claim >= pipeline->chunks_num)
+                break;
+
+            Score_Chunk_t *candidate = &pipeline->slots[pipeline->next_claim % pipeline->slots_num];
+
+            if( (candidate->state == SCORE_CHUNK_READ) && (candidate->sequence == pipeline->next_claim) )
+            {
+                chunk = candidate;
+                chunk->state = SCORE_CHUNK_SCORING;
+                pipeline->next_claim++;
+                break;
+            }
+
+            pthread_cond_wait(&pipeline->changed, &pipeline->lock);
+        }
+
+        pthread_mutex_unlock(&pipeline->lock);
+
+        if(chunk == NULL)
+            break;
+
+        TRACE_BEGIN("score_chunk", TRACE_CAT_INFERENCE);
+
+        chunk->output_len  = 0;
+        chunk->output_rows = 0;
+
+        const bool scored = (pipeline->input_format == DATASET_FORMAT_BINARY) ?
+                            (score_binary_chunk(worker, chunk, input_rows, outputs)) :
+                            (score_csv_chunk(worker, chunk, inputs, outputs));
+
+        TRACE_END("score_chunk", TRACE_CAT_INFERENCE);
+
+        if(scored == false)
+        {
+            score_fail(pipeline, "INPUT_ROW:INVALID");
+            break;
+        }
+
+        pthread_mutex_lock(&pipeline->lock);
+        chunk->state = SCORE_CHUNK_SCORED;
+        pthread_cond_broadcast(&pipeline->changed);
+        pthread_mutex_unlock(&pipeline->lock);
+    }
+
+    free_matrix(inputs);
+    free_matrix(outputs);
+
+    return NULL;
+}//end score_worker.
+
+/**
+ * @brief The writer: Writes the scored chunks in order. (Thread entry)
+ *
+ * @param arg The Score_Pipeline_t.
+ * @return void*
+ */
+static void *score_writer(void *arg)
+{
+    Score_Pipeline_t *pipeline = (Score_Pipeline_t *) arg;
+
+    Trace_Thread_Name("score_writer");
+
+    FILE *output_file = fopen(pipeline->output_path, "wb");
+
+    if(output_file == NULL)
+    {
+        score_fail(pipeline, "OUTPUT_FILE:OPEN_FAILED");
+        return NULL;
+    }
+
+    // Binary: Placeholder header. (The rows count is patched at the end)
+    Dataset_Header_t header;
+    memset(&header, 0, sizeof(Dataset_Header_t));
+    memcpy(header.magic, DATASET_BINARY_MAGIC, sizeof(header.magic));
+    header.version      = DATASET_BINARY_VERSION;
+    header.output_dense = pipeline->output_dense;
+    header.row_stride   = pipeline->output_dense;
+
+    if(pipeline->output_format == DATASET_FORMAT_BINARY)
+        fwrite(&header, sizeof(Dataset_Header_t), 1, output_file);
+
+    for(uint64_t sequence = 0; ; sequence++)
+    {
+        pthread_mutex_lock(&pipeline->lock);
+
+        Score_Chunk_t *chunk = &pipeline->slots[sequence % pipeline->slots_num];
+
+        while( (pipeline->failed == false) && (sequence < pipeline->chunks_num) &&
+               ((chunk->state != SCORE_CHUNK_SCORED) || (chunk->sequence != sequence)) )
+            pthread_cond_wait(&pipeline->changed, &pipeline->lock);
+
+        const bool done = (pipeline->failed) || (sequence >= pipeline->chunks_num);
+
+        pthread_mutex_unlock(&pipeline->lock);
+
+        if(done)
+            break;
+
+        TRACE_BEGIN("score_write", TRACE_CAT_DATA);
+
+        if(fwrite(chunk->output, 1, chunk->output_len, output_file) != chunk->output_len)
+        {
+            score_fail(pipeline, "OUTPUT_FILE:WRITE_FAILED");
+            break;
+        }
+
+        TRACE_END("score_write", TRACE_CAT_DATA);
+
+        pipeline->bytes_written += chunk->output_len;
+        pipeline->rows_scored   += chunk->output_rows;
+
+        // Give the slot back to the reader.
+        pthread_mutex_lock(&pipeline->lock);
+        chunk->state = SCORE_CHUNK_FREE;
+        pthread_cond_broadcast(&pipeline->changed);
+        pthread_mutex_unlock(&pipeline->lock);
+    }
+
+    if(pipeline->output_format == DATASET_FORMAT_BINARY)
+    {
+        header.samples = pipeline->rows_scored;
+        fseek(output_file, 0, SEEK_SET);
+        fwrite(&header, sizeof(Dataset_Header_t), 1, output_file);
+    }
+
+    if(fclose(output_file) != 0)
+        score_fail(pipeline, "OUTPUT_FILE:WRITE_FAILED");
+
+    return NULL;
+}//end score_writer.
+
+/**
+ * @brief Function to wait for the slot of a chunk to be free. (Reader)
+ *
+ * @param pipeline
+ * @param sequence
+ * @return Score_Chunk_t* (NULL: The pipeline failed)
+ */
+static Score_Chunk_t *score_wait_free_slot(Score_Pipeline_t *pipeline, uint64_t sequence)
+{
+    Score_Chunk_t *chunk = &pipeline->slots[sequence % pipeline->slots_num];
+
+    pthread_mutex_lock(&pipeline->lock);
+
+    while( (pipeline->failed == false) && (chunk->state != SCORE_CHUNK_FREE) )
+        pthread_cond_wait(&pipeline->changed, &pipeline->lock);
+
+    const bool failed = pipeline->failed;
+
+    pthread_mutex_unlock(&pipeline->lock);
+
+    return (failed) ? (NULL) : (chunk);
+}//end score_wait_free_slot.
+
+/**
+ * @brief Function to hand a filled chunk to the workers. (Reader)
+ *
+ * @param pipeline
+ * @param chunk
+ * @param sequence
+ */
+static void score_publish(Score_Pipeline_t *pipeline, Score_Chunk_t *chunk, uint64_t sequence)
+{
+    pthread_mutex_lock(&pipeline->lock);
+    chunk->sequence = sequence;
+    chunk->state = SCORE_CHUNK_READ;
+    pthread_cond_broadcast(&pipeline->changed);
+    pthread_mutex_unlock(&pipeline->lock);
+
+    return;
+}//end score_publish.
+
+/**
+ * @brief The reader, binary input: Cuts the mapping into chunks of rows. (Calling thread)
+ *
+ * @param pipeline
+ * @return uint64_t The number of chunks.
+ */
+static uint64_t score_read_binary(Score_Pipeline_t *pipeline)
+{
+    uint64_t sequence = 0;
+
+    for(uint64_t first_row = 0; first_row < pipeline->samples_num; first_row += SCORE_CHUNK_ROWS, sequence++)
+    {
+        Score_Chunk_t *chunk = score_wait_free_slot(pipeline, sequence);
+
+        if(chunk == NULL)
+            break;
+
+        chunk->first_row = first_row;
+        chunk->rows = ((pipeline->samples_num - first_row) < SCORE_CHUNK_ROWS) ?
+                      ((uint32_t) (pipeline->samples_num - first_row)) : (SCORE_CHUNK_ROWS);
+
+        // Fault the pages in ahead of the workers.
+        const size_t chunk_bytes = sizeof(double) * pipeline->row_stride * chunk->rows;
+        const uintptr_t page_size  = (uintptr_t) sysconf(_SC_PAGESIZE);
+        const uintptr_t page_start = (uintptr_t) (pipeline->samples + (first_row * pipeline->row_stride)) & ~(page_size - 1);
+
+        madvise((void *) page_start, chunk_bytes + page_size, MADV_WILLNEED);
+
+        pipeline->bytes_read += chunk_bytes;
+
+        score_publish(pipeline, chunk, sequence);
+    }
+
+    return sequence;
+}//end score_read_binary.
+
+/**
+ * @brief The reader, CSV input: Reads chunks of whole lines. (Calling thread)
+ *          - The partial last line of a read is moved to the front of the next chunk.
+ *
+ * @param pipeline
+ * @return uint64_t The number of chunks.
+ */
+static uint64_t score_read_csv(Score_Pipeline_t *pipeline)
+{
+    // The partial line carried to the next chunk.
+    char *carry = (char *) malloc(DATASET_LINE_MAX);
+    size_t carry_len = 0;
+
+    if(carry == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    uint64_t sequence = 0;
+    bool eof = false;
+
+    while(eof == false)
+    {
+        Score_Chunk_t *chunk = score_wait_free_slot(pipeline, sequence);
+
+        if(chunk == NULL)
+            break;
+
+        memcpy(chunk->text, carry, carry_len);
+        chunk->text_len = carry_len;
+        carry_len = 0;
+
+        // Fill the chunk.
+        while(chunk->text_len < SCORE_CHUNK_BYTES)
+        {
+            const ssize_t bytes = read(pipeline->input_fd, chunk->text + chunk->text_len, SCORE_CHUNK_BYTES - chunk->text_len);
+
+            if( (bytes < 0) && (errno == EINTR) )
+                continue;
+
+            if(bytes < 0)
+            {
+                score_fail(pipeline, "INPUT_FILE:READ_FAILED");
+                eof = true;
+                break;
+            }
+
+            if(bytes == 0)
+            {
+                eof = true;
+                break;
+            }
+
+            chunk->text_len += (size_t) bytes;
+            pipeline->bytes_read += (uint64_t) bytes;
+        }
+
+        // Cut after the last whole line. (The end of the file ends the last line)
+        if(eof == false)
+        {
+            char *last_newline = NULL;
+
+            for(char *c = chunk->text + chunk->text_len; c > chunk->text; c--)
+            {
+                if(c[-1] == '\n')
+                {
+                    last_newline = c;
+                    break;
+                }
+            }
+
+            carry_len = (last_newline != NULL) ? (size_t) ((chunk->text + chunk->text_len) - last_newline) : (chunk->text_len);
+
+            if(carry_len >= DATASET_LINE_MAX)
+            {
+                score_fail(pipeline, "INPUT_LINE:MAX_LIMIT");
+                break;
+            }
+
+            memcpy(carry, chunk->text + (chunk->text_len - carry_len), carry_len);
+            chunk->text_len -= carry_len;
+        }
+
+        chunk->text[chunk->text_len] = '\0';
+        chunk->first_lines = (sequence == 0);
+
+        if( (chunk->text_len == 0) && (eof) )
+            break;
+
+        score_publish(pipeline, chunk, sequence);
+        sequence++;
+    }
+
+    free(carry);
+
+    return sequence;
+}//end score_read_csv.
+
+/**
+ * @brief Function to open the input file & find its format. (Binary datasets start with their magic)
+ *
+ * @param pipeline
+ * @return bool
+ */
+static bool score_open_input(Score_Pipeline_t *pipeline)
+{
+    pipeline->input_fd = open(pipeline->input_path, O_RDONLY);
+
+    if(pipeline->input_fd < 0)
+        return false;
+
+    Dataset_Header_t header;
+    const bool binary = (read(pipeline->input_fd, &header, sizeof(Dataset_Header_t)) == (ssize_t) sizeof(Dataset_Header_t)) &&
+                        (memcmp(header.magic, DATASET_BINARY_MAGIC, sizeof(header.magic)) == 0);
+
+    if(binary == false)
+    {
+        pipeline->input_format = DATASET_FORMAT_CSV;
+        lseek(pipeline->input_fd, 0, SEEK_SET);
+        return true;
+    }
+
+    pipeline->input_format = DATASET_FORMAT_BINARY;
+
+    if( (header.version != DATASET_BINARY_VERSION) || (header.input_dense != pipeline->input_dense) ||
+        (header.row_stride < header.input_dense + header.output_dense) )
+        error_exit(CURRENT_C, "INPUT_HEADER:INVALID");
+
+    struct stat file_stat;
+
+    if(fstat(pipeline->input_fd, &file_stat) != 0)
+        return false;
+
+    pipeline->row_stride  = header.row_stride;
+    pipeline->samples_num = header.samples;
+
+    const size_t needed_size = sizeof(Dataset_Header_t) + (sizeof(double) * header.row_stride * header.samples);
+
+    if( (size_t) file_stat.st_size < needed_size )
+        error_exit(CURRENT_C, "INPUT_FILE:TRUNCATED");
+
+    pipeline->mapping_size = (size_t) file_stat.st_size;
+    pipeline->mapping = mmap(NULL, pipeline->mapping_size, PROT_READ, MAP_SHARED, pipeline->input_fd, 0);
+
+    if(pipeline->mapping == MAP_FAILED)
+        return false;
+
+    // Read once, front to back.
+    madvise(pipeline->mapping, pipeline->mapping_size, MADV_SEQUENTIAL);
+
+    pipeline->samples = (const double *) ((const uint8_t *) pipeline->mapping + sizeof(Dataset_Header_t));
+
+    return true;
+}//end score_open_input.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTION                         -
+----------------------------------------------------------------
+*/
+
+int main(int argc, char **argv)
+{
+    static Score_Pipeline_t pipeline;
+
+    const char *output_format = NULL;
+    long workers = score_default_workers();   // (--workers: Checked against SCORE_MAX_WORKERS)
+
+    pipeline.batch_size = SCORE_BATCH;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if( (strcmp(argv[i], "--model") == 0) && (i + 1 < argc) )
+            pipeline.model_path = argv[++i];
+        else if( (strcmp(argv[i], "--input") == 0) && (i + 1 < argc) )
+            pipeline.input_path = argv[++i];
+        else if( (strcmp(argv[i], "--output") == 0) && (i + 1 < argc) )
+            pipeline.output_path = argv[++i];
+        else if( (strcmp(argv[i], "--output-format") == 0) && (i + 1 < argc) )
+            output_format = argv[++i];
+        else if( (strcmp(argv[i], "--workers") == 0) && (i + 1 < argc) )
+            workers = strtol(argv[++i], NULL, 10);
+        else if( (strcmp(argv[i], "--batch") == 0) && (i + 1 < argc) )
+            pipeline.batch_size = (uint16_t) strtoul(argv[++i], NULL, 10);
+        else
+        {
+            score_usage();
+            return 2;
+        }
+    }
+
+    if( (pipeline.model_path == NULL) || (pipeline.input_path == NULL) || (pipeline.output_path == NULL) ||
+        (workers <= 0) || (workers > SCORE_MAX_WORKERS) || (pipeline.batch_size == 0) || (pipeline.batch_size > MAX_MATRIX_ROW) ||
+        ((output_format != NULL) && (strcmp(output_format, "binary") != 0) && (strcmp(output_format, "csv") != 0)) )
+    {
+        score_usage();
+        return 2;
+    }
+
+    pipeline.workers = (uint16_t) workers;
+
+    // One model per worker: The passes write the layers of their network.
+    static Score_Worker_t score_workers[SCORE_MAX_WORKERS];
+
+    for(uint16_t w = 0; w < pipeline.workers; w++)
+    {
+        score_workers[w].pipeline = &pipeline;
+
+        const ANN_Status_t status = Load_Network(pipeline.model_path, &score_workers[w].dnn_network);
+
+        if(status != ANN_OK)
+        {
+            fprintf(stderr, "ann_score: %s: %s\n", pipeline.model_path, ANN_Status_Name(status));
+
+            while(w-- > 0)
+                Free_Network(score_workers[w].dnn_network);
+
+            return 1;
+        }
+    }
+
+    pipeline.input_dense  = score_workers[0].dnn_network->network_topology->input_layer_dense;
+    pipeline.output_dense = score_workers[0].dnn_network->network_topology->output_layer_dense;
+
+    if(score_open_input(&pipeline) == false)
+    {
+        fprintf(stderr, "ann_score: %s: %s\n", pipeline.input_path, strerror(errno));
+
+        for(uint16_t w = 0; w < pipeline.workers; w++)
+            Free_Network(score_workers[w].dnn_network);
+
+        return 1;
+    }
+
+    pipeline.output_format = (output_format == NULL) ? (pipeline.input_format) :
+                             ((strcmp(output_format, "binary") == 0) ? (DATASET_FORMAT_BINARY) : (DATASET_FORMAT_CSV));
+
+    // The chunks in flight.
+    pipeline.slots_num = (uint16_t) (pipeline.workers * SCORE_SLOTS_PER_WORKER);
+    pipeline.slots = (Score_Chunk_t *) calloc(pipeline.slots_num, sizeof(Score_Chunk_t));
+
+    if(pipeline.slots == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    for(uint16_t s = 0; (s < pipeline.slots_num) && (pipeline.input_format == DATASET_FORMAT_CSV); s++)
+    {
+        pipeline.slots[s].text = (char *) malloc(SCORE_CHUNK_BYTES + 1);
+
+        if(pipeline.slots[s].text == NULL)
+            error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+    }
+
+    pipeline.chunks_num = UINT64_MAX;
+    pthread_mutex_init(&pipeline.lock, NULL);
+    pthread_cond_init(&pipeline.changed, NULL);
+
+    //===> Run the pipeline.
+    const uint64_t start_ns = Profile_Now_Ns();
+
+    pthread_t writer, workers_threads[SCORE_MAX_WORKERS];
+
+    if(pthread_create(&writer, NULL, score_writer, &pipeline) != 0)
+        error_exit(CURRENT_C, "SCORE_THREAD:CREATE_FAILED");
+
+    for(uint16_t w = 0; w < pipeline.workers; w++)
+    {
+        if(pthread_create(&workers_threads[w], NULL, score_worker, &score_workers[w]) != 0)
+            error_exit(CURRENT_C, "SCORE_THREAD:CREATE_FAILED");
+    }
+
+    Trace_Thread_Name("score_reader");
+
+    const uint64_t chunks_num = (pipeline.input_format == DATASET_FORMAT_BINARY) ?
+                                (score_read_binary(&pipeline)) : (score_read_csv(&pipeline));
+
+    pthread_mutex_lock(&pipeline.lock);
+    pipeline.chunks_num = chunks_num;
+    pthread_cond_broadcast(&pipeline.changed);
+    pthread_mutex_unlock(&pipeline.lock);
+
+    for(uint16_t w = 0; w < pipeline.workers; w++)
+        pthread_join(workers_threads[w], NULL);
+
+    pthread_join(writer, NULL);
+
+    const double seconds = (double) (Profile_Now_Ns() - start_ns) * 1e-9;
+
+    //===> Report.
+    if(pipeline.failed)
+    {
+        fprintf(stderr, "ann_score: %s\n", pipeline.failure);
+    }
+    else
+    {
+        fprintf(stderr, "ann_score: %llu rows in %.3f s: %.1f rows/s, read %.1f MB/s, written %.1f MB/s (%u workers, batch %u)\n",
+                (unsigned long long) pipeline.rows_scored, seconds, pipeline.rows_scored / seconds,
+                (pipeline.bytes_read * 1e-6) / seconds, (pipeline.bytes_written * 1e-6) / seconds,
+                pipeline.workers, pipeline.batch_size);
+    }
+
+    //===> Clean up.
+    for(uint16_t w = 0; w < pipeline.workers; w++)
+        Free_Network(score_workers[w].dnn_network);
+
+    for(uint16_t s = 0; s < pipeline.slots_num; s++)
+    {
+        free(pipeline.slots[s].text);
+        free(pipeline.slots[s].output);
+    }
+
+    free(pipeline.slots);
+
+    if(pipeline.mapping != NULL)
+        munmap(pipeline.mapping, pipeline.mapping_size);
+
+    close(pipeline.input_fd);
+
+    return (pipeline.failed) ? (1) : (0);
+}
+
+//!=============================> .END
@@ -0,0 +1,1067 @@
+/**
+ * @file serve.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Resident inference server with dynamic batching. (ann_serve)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+// accept4 & the SOCK_ flags. (Linux)
+#define _GNU_SOURCE
+
+#include "Global.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#define CURRENT_H "SERVE.H"
+#define CURRENT_C "SERVE.C"
+
+/*
+    - Usage:
+        ann_serve --model FILE (--socket PATH | --port PORT) [--workers N] [--max-batch N]
+                  [--max-delay-us US] [--stats-interval S] [--stats-json FILE] [--cache-entries N]
+                  [--tune-cache FILE]
+            Loads the model (Save_Network) once per worker & answers inference requests
+            until SIGINT/SIGTERM.
+
+    - Framing: (Native byte order, both ways)
+        Request:  [Serve_Request_Header_t (8 bytes)][input_dense doubles]
+        Response: [Serve_Response_Header_t (8 bytes)][output_dense doubles] (None if status != ANN_OK)
+        Many requests may be in flight on one connection, the responses carry their request_id
+        & may come back in another order.
+
+    - Threads:
+        One epoll event loop accepts the connections, cuts the frames & queues the requests.
+        (N) workers take up to (max-batch) queued requests, waiting at most (max-delay-us) after
+        the oldest one for the batch to fill, run them through forward_propagation_batch &
+        write the responses themselves.
+
+    - Overload:
+        A request past a full queue is rejected (ANN_ERROR_LIMIT), the answer is written by a
+        worker: The event loop never waits for a client. Once SERVE_REJECT_SIZE rejections
+        wait too, the connection is dropped.
+
+    - Stats:
+        Every (stats-interval) seconds: requests/s, batches, mean batch size & p50/p99 latency.
+        (From the end of the request read to the end of the response write)
+
+    - Cache: (--cache-entries N)
+        The workers share one results cache: A repeated input is answered without a pass.
+        (The workers models have the same weights, so the same model version) Its hit rate
+        is printed with the stats.
+
+    - Tuning: (--tune-cache FILE)
+        The depth-first tile of the workers is tuned for (max-batch) at startup, or read from
+        the tuning cache file when this machine already tuned this model. (Tune_Network)
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define SERVE_MAX_WORKERS        ((const uint16_t) 64)
+#define SERVE_MAX_BATCH          ((const uint16_t) 32)      // Default batch. (At most MAX_MATRIX_ROW)
+#define SERVE_MAX_DELAY_US       ((const uint32_t) 200)
+#define SERVE_STATS_INTERVAL_S   ((const uint32_t) 5)
+#define SERVE_QUEUE_SIZE         ((const uint32_t) 4096)    // Queued requests. (Power of 2)
+#define SERVE_REJECT_SIZE        ((const uint32_t) 1024)    // Overload rejections waiting for a worker. (Power of 2)
+#define SERVE_READ_BUFFER        ((const uint32_t) 16384)   // Bytes per connection.
+#define SERVE_MAX_EVENTS         ((const uint16_t) 64)
+#define SERVE_LISTEN_BACKLOG     ((const int) 128)
+#define SERVE_WRITE_TIMEOUT_MS   ((const int) 1000)         // A client not reading its responses is dropped.
+
+// Latency histogram: Bucket b holds [1us * GROWTH^(b - 1), 1us * GROWTH^b). (~2.5% wide)
+#define SERVE_HISTOGRAM_BUCKETS  ((const uint16_t) 1024)
+#define SERVE_HISTOGRAM_GROWTH   ((const double) 1.025)
+
+#define SERVE_QUEUE_MASK ((const uint32_t) (SERVE_QUEUE_SIZE - 1))
+#define SERVE_REJECT_MASK ((const uint32_t) (SERVE_REJECT_SIZE - 1))
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Structs for the frames headers
+ *
+ */
+#pragma pack(push, 1)
+typedef struct _Serve_Request_Header_t
+{
+    uint32_t request_id;
+    uint16_t values;    // Input doubles following the header. (input_dense)
+    uint16_t reserved;
+}Serve_Request_Header_t;
+
+typedef struct _Serve_Response_Header_t
+{
+    uint32_t request_id;
+    uint16_t values;    // Output doubles following the header. (0 on errors)
+    uint16_t status;    // ANN_Status_t.
+}Serve_Response_Header_t;
+#pragma pack(pop)
+
+/**
+ * @brief Struct for one client connection
+ *          - The event loop reads it, the workers write it. (write_lock)
+ *          - Closed & freed when its last reference goes: The event loop & every queued request.
+ *
+ */
+typedef struct _Serve_Connection_t
+{
+    int fd;
+
+    atomic_uint refs;
+    atomic_bool closed;
+
+    pthread_mutex_t write_lock;
+
+    // Bytes of incomplete frames. (Event loop only)
+    uint32_t read_len;
+    uint8_t read_buffer[SERVE_READ_BUFFER];
+}Serve_Connection_t;
+
+/**
+ * @brief Struct for one queued request
+ *
+ */
+typedef struct _Serve_Request_t
+{
+    Serve_Connection_t *connection;
+    uint32_t request_id;
+    uint64_t arrival_ns;
+
+    double input[MAX_VECTOR_LEN];
+}Serve_Request_t;
+
+/**
+ * @brief Struct for one overload rejection (Answered by a worker, the event loop never blocks)
+ *
+ */
+typedef struct _Serve_Reject_t
+{
+    Serve_Connection_t *connection;
+    uint32_t request_id;
+}Serve_Reject_t;
+
+/**
+ * @brief Struct for the served counters (Lock free, shared by all the threads)
+ *
+ */
+typedef struct _Serve_Stats_t
+{
+    atomic_uint_fast64_t requests;
+    atomic_uint_fast64_t rejected;
+    atomic_uint_fast64_t batches;
+
+    atomic_uint_fast64_t latency_histogram[SERVE_HISTOGRAM_BUCKETS];
+}Serve_Stats_t;
+
+/**
+ * @brief Struct for a snapshot of the served counters
+ *
+ */
+typedef struct _Serve_Snapshot_t
+{
+    uint64_t ns;
+    uint64_t requests;
+    uint64_t rejected;
+    uint64_t batches;
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+
+    uint64_t latency_histogram[SERVE_HISTOGRAM_BUCKETS];
+}Serve_Snapshot_t;
+
+/**
+ * @brief Struct for the server settings
+ *
+ */
+typedef struct _Serve_Config_t
+{
+    const char *model_path;
+    const char *socket_path;
+    const char *stats_json_path;
+    const char *tune_cache_path;
+    uint16_t port;
+
+    uint16_t workers;
+    uint16_t max_batch;
+    uint32_t max_delay_us;
+    uint32_t stats_interval_s;
+    uint32_t cache_entries;
+
+    // The served shapes. (From the model)
+    uint16_t input_dense;
+    uint16_t output_dense;
+}Serve_Config_t;
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+static Serve_Config_t serve_config;
+static Serve_Stats_t serve_stats;
+
+// The results cache of the workers. (NULL: None)
+static Cache_t *serve_cache = NULL;
+
+// The requests queue. (Ring of SERVE_QUEUE_SIZE, guarded by serve_queue_lock)
+static Serve_Request_t *serve_queue;
+static uint32_t serve_queue_head = 0, serve_queue_count = 0;
+static pthread_mutex_t serve_queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t serve_queue_cond;
+
+// The overload rejections. (Ring of SERVE_REJECT_SIZE, guarded by serve_queue_lock)
+static Serve_Reject_t serve_rejects[SERVE_REJECT_SIZE];
+static uint32_t serve_rejects_head = 0, serve_rejects_count = 0;
+
+static volatile sig_atomic_t serve_stop_signal = 0;
+static atomic_bool serve_stopping = false;
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+static void serve_usage(void)
+{
+    printf("Usage:\n"
+           "  ann_serve --model FILE (--socket PATH | --port PORT) [--workers N] [--max-batch N]\n"
+           "            [--max-delay-us US] [--stats-interval S] [--stats-json FILE] [--cache-entries N]\n"
+           "            [--tune-cache FILE]\n");
+
+    return;
+}//end serve_usage.
+
+/**
+ * @brief Function to get the default workers: One per online CPU, up to SERVE_MAX_WORKERS.
+ *
+ * @return uint16_t (At least 1)
+ */
+static uint16_t serve_default_workers(void)
+{
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if(cpus < 1)
+        return 1;
+
+    return (cpus > SERVE_MAX_WORKERS) ? (SERVE_MAX_WORKERS) : ((uint16_t) cpus);
+}//end serve_default_workers.
+
+static void serve_on_signal(int signal_number)
+{
+    serve_stop_signal = signal_number;
+
+    return;
+}//end serve_on_signal.
+
+/**
+ * @brief Function to get the latency bucket of a duration.
+ *
+ * @param ns
+ * @return uint16_t
+ */
+static inline uint16_t serve_latency_bucket(uint64_t ns)
+{
+    if(ns < 1000)
+        return 0;
+
+    const double bucket = 1.0 + (log((double) ns * 1e-3) / log(SERVE_HISTOGRAM_GROWTH));
+
+    return (bucket >= (double) (SERVE_HISTOGRAM_BUCKETS - 1)) ? (SERVE_HISTOGRAM_BUCKETS - 1) : ((uint16_t) bucket);
+}//end serve_latency_bucket.
+
+/**
+ * @brief Function to get a latency percentile of a histogram. (The upper bound of its bucket)
+ *
+ * @param histogram
+ * @param count The values in the histogram.
+ * @param percentile [0, 100]
+ * @return double Microseconds.
+ */
+static double serve_latency_percentile(const uint64_t *histogram, uint64_t count, double percentile)
+{
+    if(count == 0)
+        return 0.0;
+
+    const uint64_t rank = (uint64_t) ceil(((double) count * percentile) / 100.0);
+    uint64_t seen = 0;
+
+    for(uint16_t b = 0; b < SERVE_HISTOGRAM_BUCKETS; b++)
+    {
+        seen += histogram[b];
+
+        if(seen >= rank)
+            return pow(SERVE_HISTOGRAM_GROWTH, (double) b);
+    }
+
+    return pow(SERVE_HISTOGRAM_GROWTH, (double) (SERVE_HISTOGRAM_BUCKETS - 1));
+}//end serve_latency_percentile.
+
+static void serve_snapshot(Serve_Snapshot_t *snapshot)
+{
+    snapshot->ns       = Profile_Now_Ns();
+    snapshot->requests = atomic_load(&serve_stats.requests);
+    snapshot->rejected = atomic_load(&serve_stats.rejected);
+    snapshot->batches  = atomic_load(&serve_stats.batches);
+
+    for(uint16_t b = 0; b < SERVE_HISTOGRAM_BUCKETS; b++)
+        snapshot->latency_histogram[b] = atomic_load_explicit(&serve_stats.latency_histogram[b], memory_order_relaxed);
+
+    Cache_Report_t cache_report = {0};
+
+    if(serve_cache != NULL)
+        Cache_Get_Report(serve_cache, &cache_report);
+
+    snapshot->cache_hits   = cache_report.hits;
+    snapshot->cache_misses = cache_report.misses;
+
+    return;
+}//end serve_snapshot.
+
+/**
+ * @brief Function to print the stats between two snapshots.
+ *
+ * @param label
+ * @param from
+ * @param to
+ * @param json_file (NULL: Print a line on stderr)
+ */
+static void serve_report(const char *label, const Serve_Snapshot_t *from, const Serve_Snapshot_t *to, FILE *json_file)
+{
+    static uint64_t histogram[SERVE_HISTOGRAM_BUCKETS];
+
+    for(uint16_t b = 0; b < SERVE_HISTOGRAM_BUCKETS; b++)
+        histogram[b] = to->latency_histogram[b] - from->latency_histogram[b];
+
+    const uint64_t requests = to->requests - from->requests;
+    const uint64_t rejected = to->rejected - from->rejected;
+    const uint64_t batches  = to->batches  - from->batches;
+    const double seconds    = (double) (to->ns - from->ns) * 1e-9;
+
+    const double throughput = (seconds > 0.0) ? (requests / seconds) : (0.0);
+    const double mean_batch = (batches > 0) ? ((double) requests / batches) : (0.0);
+    const double p50 = serve_latency_percentile(histogram, requests, 50.0);
+    const double p99 = serve_latency_percentile(histogram, requests, 99.0);
+
+    const uint64_t cache_hits    = to->cache_hits - from->cache_hits;
+    const uint64_t cache_lookups = cache_hits + (to->cache_misses - from->cache_misses);
+    const double cache_hit_rate  = (cache_lookups > 0) ? ((double) cache_hits / cache_lookups) : (0.0);
+
+    if(json_file == NULL)
+    {
+        fprintf(stderr, "[%s] %.1f s: %llu requests (%.1f req/s), %llu rejected, %llu batches (mean %.2f), p50 %.1f us, p99 %.1f us",
+                label, seconds, (unsigned long long) requests, throughput, (unsigned long long) rejected,
+                (unsigned long long) batches, mean_batch, p50, p99);
+
+        if(serve_cache != NULL)
+            fprintf(stderr, ", cache hits %.1f%%", 100.0 * cache_hit_rate);
+
+        fprintf(stderr, "\n");
+    }
+    else
+    {
+        fprintf(json_file, "{\"seconds\":%.3f,\"requests\":%llu,\"requests_per_s\":%.3f,\"rejected\":%llu,"
+                           "\"batches\":%llu,\"mean_batch\":%.3f,\"p50_us\":%.3f,\"p99_us\":%.3f,"
+                           "\"cache_hits\":%llu,\"cache_hit_rate\":%.4f,"
+                           "\"workers\":%u,\"max_batch\":%u,\"max_delay_us\":%u,\"cache_entries\":%u}\n",
+                seconds, (unsigned long long) requests, throughput, (unsigned long long) rejected,
+                (unsigned long long) batches, mean_batch, p50, p99,
+                (unsigned long long) cache_hits, cache_hit_rate,
+                serve_config.workers, serve_config.max_batch, serve_config.max_delay_us, serve_config.cache_entries);
+    }
+
+    return;
+}//end serve_report.
+
+/**
+ * @brief Function to drop a reference to a connection. (The last one closes & frees it)
+ *
+ * @param connection
+ */
+static void serve_connection_release(Serve_Connection_t *connection)
+{
+    if(atomic_fetch_sub(&connection->refs, 1) != 1)
+        return;
+
+    close(connection->fd);
+    pthread_mutex_destroy(&connection->write_lock);
+    free(connection);
+
+    return;
+}//end serve_connection_release.
+
+/**
+ * @brief Function to write a whole buffer to a non blocking socket.
+ *
+ * @param connection
+ * @param data
+ * @param size
+ * @return bool False if the connection is (now) closed.
+ */
+static bool serve_write_all(Serve_Connection_t *connection, const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+
+    while(size > 0)
+    {
+        const ssize_t written = send(connection->fd, bytes, size, MSG_NOSIGNAL);
+
+        if(written > 0)
+        {
+            bytes += written;
+            size  -= (size_t) written;
+            continue;
+        }
+
+        if( (written < 0) && (errno == EINTR) )
+            continue;
+
+        // Full socket buffer: Wait for the client to read.
+        if( (written < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)) )
+        {
+            struct pollfd write_poll = {.fd = connection->fd, .events = POLLOUT};
+
+            if(poll(&write_poll, 1, SERVE_WRITE_TIMEOUT_MS) > 0)
+                continue;
+        }
+
+        atomic_store(&connection->closed, true);
+        shutdown(connection->fd, SHUT_RDWR);
+        return false;
+    }
+
+    return true;
+}//end serve_write_all.
+
+/**
+ * @brief Function to send one response.
+ *
+ * @param connection
+ * @param request_id
+ * @param status
+ * @param output (NULL: No values)
+ * @param values
+ */
+static void serve_respond(Serve_Connection_t *connection, uint32_t request_id, ANN_Status_t status, const double *output, uint16_t values)
+{
+    if(atomic_load(&connection->closed))
+        return;
+
+    const Serve_Response_Header_t header = {.request_id = request_id, .values = (output != NULL) ? (values) : (0), .status = (uint16_t) status};
+
+    pthread_mutex_lock(&connection->write_lock);
+
+    if( serve_write_all(connection, &header, sizeof(Serve_Response_Header_t)) && (header.values > 0) )
+        serve_write_all(connection, output, sizeof(double) * header.values);
+
+    pthread_mutex_unlock(&connection->write_lock);
+
+    return;
+}//end serve_respond.
+
+/**
+ * @brief Function to try to send a response without values, never waiting. (Event loop)
+ *          - Before closing a connection: Nothing is sent if a worker is writing to it or if
+ *            its socket buffer is full.
+ *
+ * @param connection
+ * @param request_id
+ * @param status
+ */
+static void serve_try_respond(Serve_Connection_t *connection, uint32_t request_id, ANN_Status_t status)
+{
+    if( atomic_load(&connection->closed) || (pthread_mutex_trylock(&connection->write_lock) != 0) )
+        return;
+
+    const Serve_Response_Header_t header = {.request_id = request_id, .values = 0, .status = (uint16_t) status};
+
+    send(connection->fd, &header, sizeof(Serve_Response_Header_t), MSG_NOSIGNAL | MSG_DONTWAIT);
+
+    pthread_mutex_unlock(&connection->write_lock);
+
+    return;
+}//end serve_try_respond.
+
+/**
+ * @brief Function to take the waiting overload rejections. (serve_queue_lock held)
+ *
+ * @param rejects [MAX_MATRIX_ROW]
+ * @return uint16_t The number taken.
+ */
+static uint16_t serve_take_rejects(Serve_Reject_t *rejects)
+{
+    const uint16_t rejects_num = (serve_rejects_count < MAX_MATRIX_ROW) ? ((uint16_t) serve_rejects_count) : (MAX_MATRIX_ROW);
+
+    for(uint16_t r = 0; r < rejects_num; r++)
+        rejects[r] = serve_rejects[(serve_rejects_head + r) & SERVE_REJECT_MASK];
+
+    serve_rejects_head   = (serve_rejects_head + rejects_num) & SERVE_REJECT_MASK;
+    serve_rejects_count -= rejects_num;
+
+    return rejects_num;
+}//end serve_take_rejects.
+
+/**
+ * @brief Function to answer the taken overload rejections. (Worker, no lock held)
+ *
+ * @param rejects
+ * @param rejects_num
+ */
+static void serve_answer_rejects(const Serve_Reject_t *rejects, uint16_t rejects_num)
+{
+    for(uint16_t r = 0; r < rejects_num; r++)
+    {
+        serve_respond(rejects[r].connection, rejects[r].request_id, ANN_ERROR_LIMIT, NULL, 0);
+        serve_connection_release(rejects[r].connection);
+    }
+
+    return;
+}//end serve_answer_rejects.
+
+/**
+ * @brief Function to queue the complete frames of a connection buffer. (Event loop)
+ *
+ * @param connection
+ * @return bool False on a malformed frame. (The connection is closed)
+ */
+static bool serve_parse_frames(Serve_Connection_t *connection)
+{
+    const size_t request_size = sizeof(Serve_Request_Header_t) + sizeof(double) * serve_config.input_dense;
+    uint32_t offset = 0;
+
+    while( (connection->read_len - offset) >= sizeof(Serve_Request_Header_t) )
+    {
+        Serve_Request_Header_t header;
+        memcpy(&header, connection->read_buffer + offset, sizeof(Serve_Request_Header_t));
+
+        // A frame for another model: The stream can't be cut anymore.
+        if(header.values != serve_config.input_dense)
+        {
+            serve_try_respond(connection, header.request_id, ANN_ERROR_SHAPE);
+            return false;
+        }
+
+        if( (connection->read_len - offset) < request_size )
+            break;
+
+        const double *input = (const double *) (connection->read_buffer + offset + sizeof(Serve_Request_Header_t));
+        offset += (uint32_t) request_size;
+
+        pthread_mutex_lock(&serve_queue_lock);
+
+        if(serve_queue_count == SERVE_QUEUE_SIZE)
+        {
+            // Overloaded: Reject now rather than growing the latency of all the others. (A worker
+            // writes the answer, a slow client can't stall the event loop)
+            atomic_fetch_add_explicit(&serve_stats.rejected, 1, memory_order_relaxed);
+
+            if(serve_rejects_count == SERVE_REJECT_SIZE)
+            {
+                // Even the rejections pile up: Drop the connection.
+                pthread_mutex_unlock(&serve_queue_lock);
+                atomic_store(&connection->closed, true);
+                shutdown(connection->fd, SHUT_RDWR);
+                return false;
+            }
+
+            atomic_fetch_add(&connection->refs, 1);
+            serve_rejects[(serve_rejects_head + serve_rejects_count) & SERVE_REJECT_MASK] =
+                (Serve_Reject_t) {.connection = connection, .request_id = header.request_id};
+            serve_rejects_count++;
+
+            pthread_cond_signal(&serve_queue_cond);
+            pthread_mutex_unlock(&serve_queue_lock);
+            continue;
+        }
+
+        Serve_Request_t *request = &serve_queue[(serve_queue_head + serve_queue_count) & SERVE_QUEUE_MASK];
+
+        atomic_fetch_add(&connection->refs, 1);
+        request->connection = connection;
+        request->request_id = header.request_id;
+        request->arrival_ns = Profile_Now_Ns();
+        memcpy(request->input, input, sizeof(double) * serve_config.input_dense);
+
+        serve_queue_count++;
+
+        pthread_cond_signal(&serve_queue_cond);
+        pthread_mutex_unlock(&serve_queue_lock);
+    }
+
+    // Keep the incomplete frame.
+    connection->read_len -= offset;
+    memmove(connection->read_buffer, connection->read_buffer + offset, connection->read_len);
+
+    return true;
+}//end serve_parse_frames.
+
+/**
+ * @brief Function to read everything a connection sent. (Event loop)
+ *
+ * @param connection
+ * @return bool False if the connection is done.
+ */
+static bool serve_read(Serve_Connection_t *connection)
+{
+    while(true)
+    {
+        const ssize_t received = recv(connection->fd, connection->read_buffer + connection->read_len,
+                                      SERVE_READ_BUFFER - connection->read_len, 0);
+
+        if(received > 0)
+        {
+            connection->read_len += (uint32_t) received;
+
+            if(serve_parse_frames(connection) == false)
+                return false;
+
+            continue;
+        }
+
+        if( (received < 0) && (errno == EINTR) )
+            continue;
+
+        if( (received < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)) )
+            return (atomic_load(&connection->closed) == false);
+
+        // End of stream or error.
+        return false;
+    }
+}//end serve_read.
+
+/**
+ * @brief A worker: Takes the queued requests by batches & answers them. (Thread entry)
+ *
+ * @param arg The model of this worker. (DNN_Network)
+ * @return void*
+ */
+static void *serve_worker(void *arg)
+{
+    DNN_Network *dnn_network = (DNN_Network *) arg;
+
+    Trace_Thread_Name("serve_worker");
+
+    // The batch buffers. (Created once)
+    Type_t *inputs  = create_matrix(serve_config.max_batch, serve_config.input_dense, false);
+    Type_t *outputs = create_matrix(serve_config.max_batch, serve_config.output_dense, false);
+
+    Serve_Connection_t *connections[MAX_MATRIX_ROW];
+    uint32_t request_ids[MAX_MATRIX_ROW];
+    uint64_t arrivals_ns[MAX_MATRIX_ROW];
+    Serve_Reject_t rejects[MAX_MATRIX_ROW];
+
+    const uint64_t max_delay_ns = (uint64_t) serve_config.max_delay_us * 1000ull;
+
+    while(true)
+    {
+        pthread_mutex_lock(&serve_queue_lock);
+
+        while( (serve_queue_count == 0) && (serve_rejects_count == 0) && (atomic_load(&serve_stopping) == false) )
+            pthread_cond_wait(&serve_queue_cond, &serve_queue_lock);
+
+        // The overload rejections first. (Answered with the batch, outside the lock)
+        const uint16_t rejects_num = serve_take_rejects(rejects);
+
+        if(serve_queue_count == 0)
+        {
+            pthread_mutex_unlock(&serve_queue_lock);
+            serve_answer_rejects(rejects, rejects_num);
+
+            // Stopping, nothing left.
+            if(rejects_num == 0)
+                break;
+
+            continue;
+        }
+
+        // Dynamic batching: Wait for a full batch, until the oldest request is (max_delay) old.
+        const uint64_t deadline_ns = serve_queue[serve_queue_head].arrival_ns + max_delay_ns;
+
+        while( (serve_queue_count < serve_config.max_batch) && (atomic_load(&serve_stopping) == false) )
+        {
+            const uint64_t now_ns = Profile_Now_Ns();
+
+            if(now_ns >= deadline_ns)
+                break;
+
+            const struct timespec deadline = {.tv_sec = (time_t) (deadline_ns / 1000000000ull), .tv_nsec = (long) (deadline_ns % 1000000000ull)};
+            pthread_cond_timedwait(&serve_queue_cond, &serve_queue_lock, &deadline);
+
+            // Another worker took them.
+            if(serve_queue_count == 0)
+                break;
+        }
+
+        const uint16_t batch_size = (serve_queue_count < serve_config.max_batch) ? ((uint16_t) serve_queue_count) : (serve_config.max_batch);
+
+        for(uint16_t r = 0; r < batch_size; r++)
+        {
+            Serve_Request_t *request = &serve_queue[(serve_queue_head + r) & SERVE_QUEUE_MASK];
+
+            memcpy(inputs->Matrix_t.Matrix[r], request->input, sizeof(double) * serve_config.input_dense);
+            connections[r] = request->connection;
+            request_ids[r] = request->request_id;
+            arrivals_ns[r] = request->arrival_ns;
+        }
+
+        serve_queue_head   = (serve_queue_head + batch_size) & SERVE_QUEUE_MASK;
+        serve_queue_count -= batch_size;
+
+        // Wake a worker for the leftovers.
+        if( (serve_queue_count > 0) || (serve_rejects_count > 0) )
+            pthread_cond_signal(&serve_queue_cond);
+
+        pthread_mutex_unlock(&serve_queue_lock);
+
+        serve_answer_rejects(rejects, rejects_num);
+
+        if(batch_size == 0)
+            continue;
+
+        TRACE_BEGIN("serve_batch", TRACE_CAT_INFERENCE);
+        const ANN_Status_t status = Predict_Batch_Network(dnn_network, inputs, outputs, batch_size);
+        TRACE_END("serve_batch", TRACE_CAT_INFERENCE);
+
+        for(uint16_t r = 0; r < batch_size; r++)
+        {
+            serve_respond(connections[r], request_ids[r], status,
+                          (status == ANN_OK) ? (outputs->Matrix_t.Matrix[r]) : (NULL), serve_config.output_dense);
+
+            const uint64_t latency_ns = Profile_Now_Ns() - arrivals_ns[r];
+            atomic_fetch_add_explicit(&serve_stats.latency_histogram[serve_latency_bucket(latency_ns)], 1, memory_order_relaxed);
+
+            serve_connection_release(connections[r]);
+        }
+
+        atomic_fetch_add_explicit(&serve_stats.requests, batch_size, memory_order_relaxed);
+        atomic_fetch_add_explicit(&serve_stats.batches, 1, memory_order_relaxed);
+    }
+
+    free_matrix(inputs);
+    free_matrix(outputs);
+
+    return NULL;
+}//end serve_worker.
+
+/**
+ * @brief Function to open the listening socket. (UNIX socket path or localhost TCP port)
+ *
+ * @return int
+ */
+static int serve_listen(void)
+{
+    int listen_fd;
+
+    if(serve_config.socket_path != NULL)
+    {
+        struct sockaddr_un address = {.sun_family = AF_UNIX};
+
+        if(strlen(serve_config.socket_path) >= sizeof(address.sun_path))
+            error_exit(CURRENT_C, "SOCKET_PATH:MAX_LIMIT");
+
+        strcpy(address.sun_path, serve_config.socket_path);
+        unlink(serve_config.socket_path);
+
+        listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        if( (listen_fd < 0) || (bind(listen_fd, (struct sockaddr *) &address, sizeof(address)) != 0) )
+            error_exit(CURRENT_C, "SOCKET:BIND_FAILED");
+    }
+    else
+    {
+        struct sockaddr_in address = {.sin_family = AF_INET, .sin_port = htons(serve_config.port)};
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        listen_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        const int reuse = 1;
+
+        if( (listen_fd < 0) || (setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) != 0) ||
+            (bind(listen_fd, (struct sockaddr *) &address, sizeof(address)) != 0) )
+            error_exit(CURRENT_C, "SOCKET:BIND_FAILED");
+    }
+
+    if(listen(listen_fd, SERVE_LISTEN_BACKLOG) != 0)
+        error_exit(CURRENT_C, "SOCKET:LISTEN_FAILED");
+
+    return listen_fd;
+}//end serve_listen.
+
+/**
+ * @brief Function to accept all the pending connections. (Event loop)
+ *
+ * @param listen_fd
+ * @param epoll_fd
+ */
+static void serve_accept(int listen_fd, int epoll_fd)
+{
+    while(true)
+    {
+        const int fd = accept4(listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if(fd < 0)
+            return;
+
+        // Small frames: Don't wait to coalesce them. (TCP only)
+        if(serve_config.socket_path == NULL)
+        {
+            const int no_delay = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+        }
+
+        Serve_Connection_t *connection = (Serve_Connection_t *) calloc(1, sizeof(Serve_Connection_t));
+
+        if(connection == NULL)
+        {
+            close(fd);
+            continue;
+        }
+
+        connection->fd = fd;
+        atomic_init(&connection->refs, 1);
+        atomic_init(&connection->closed, false);
+        pthread_mutex_init(&connection->write_lock, NULL);
+
+        struct epoll_event event = {.events = EPOLLIN | EPOLLRDHUP, .data.ptr = connection};
+
+        if(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0)
+            serve_connection_release(connection);
+    }
+}//end serve_accept.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN FUNCTION                         -
+----------------------------------------------------------------
+*/
+
+int main(int argc, char **argv)
+{
+    serve_config = (Serve_Config_t) {.workers          = serve_default_workers(),
+                                     .max_batch        = SERVE_MAX_BATCH,
+                                     .max_delay_us     = SERVE_MAX_DELAY_US,
+                                     .stats_interval_s = SERVE_STATS_INTERVAL_S};
+
+    for(int i = 1; i < argc; i++)
+    {
+        if( (strcmp(argv[i], "--model") == 0) && (i + 1 < argc) )
+            serve_config.model_path = argv[++i];
+        else if( (strcmp(argv[i], "--socket") == 0) && (i + 1 < argc) )
+            serve_config.socket_path = argv[++i];
+        else if( (strcmp(argv[i], "--port") == 0) && (i + 1 < argc) )
+            serve_config.port = (uint16_t) strtoul(argv[++i], NULL, 10);
+        else if( (strcmp(argv[i], "--workers") == 0) && (i + 1 < argc) )
+            serve_config.workers = (uint16_t) strtoul(argv[++i], NULL, 10);
+        else if( (strcmp(argv[i], "--max-batch") == 0) && (i + 1 < argc) )
+            serve_config.max_batch = (uint16_t) strtoul(argv[++i], NULL, 10);
+        else if( (strcmp(argv[i], "--max-delay-us") == 0) && (i + 1 < argc) )
+            serve_config.max_delay_us = (uint32_t) strtoul(argv[++i], NULL, 10);
+        else if( (strcmp(argv[i], "--stats-interval") == 0) && (i + 1 < argc) )
+            serve_config.stats_interval_s = (uint32_t) strtoul(argv[++i], NULL, 10);
+        else if( (strcmp(argv[i], "--stats-json") == 0) && (i + 1 < argc) )
+            serve_config.stats_json_path = argv[++i];
+        else if( (strcmp(argv[i], "--cache-entries") == 0) && (i + 1 < argc) )
+            serve_config.cache_entries = (uint32_t) strtoul(argv[++i], NULL, 10);
+        else if( (strcmp(argv[i], "--tune-cache") == 0) && (i + 1 < argc) )
+            serve_config.tune_cache_path = argv[++i];
+        else
+        {
+            serve_usage();
+            return 2;
+        }
+    }
+
+    if( (serve_config.model_path == NULL) || ((serve_config.socket_path == NULL) && (serve_config.port == 0)) ||
+        (serve_config.workers == 0) || (serve_config.workers > SERVE_MAX_WORKERS) ||
+        (serve_config.max_batch == 0) || (serve_config.max_batch > MAX_MATRIX_ROW) )
+    {
+        serve_usage();
+        return 2;
+    }
+
+    // One model per worker: The passes write the layers of their network.
+    DNN_Network *networks[SERVE_MAX_WORKERS];
+
+    for(uint16_t w = 0; w < serve_config.workers; w++)
+    {
+        const ANN_Status_t status = Load_Network(serve_config.model_path, &networks[w]);
+
+        if(status != ANN_OK)
+        {
+            fprintf(stderr, "ann_serve: %s: %s\n", serve_config.model_path, ANN_Status_Name(status));
+            return 1;
+        }
+    }
+
+    serve_config.input_dense  = networks[0]->network_topology->input_layer_dense;
+    serve_config.output_dense = networks[0]->network_topology->output_layer_dense;
+
+    // Tune the tile once: The workers run the same model. (Before the cache, its hits aren't passes)
+    if(serve_config.tune_cache_path != NULL)
+    {
+        Tune_Result_t tuned;
+        const ANN_Status_t status = Tune_Network(networks[0], serve_config.max_batch, serve_config.tune_cache_path, &tuned);
+
+        for(uint16_t w = 1; w < serve_config.workers; w++)
+            Set_Batch_Tile(networks[w], tuned.batch_tile);
+
+        fprintf(stderr, "ann_serve: Tile %u for batch %u%s%s\n", tuned.batch_tile, serve_config.max_batch,
+                (tuned.cached) ? (", from the tuning cache") : (""),
+                (status != ANN_OK) ? (", the tuning cache couldn't be written") : (""));
+    }
+
+    // One cache for all the workers.
+    if(serve_config.cache_entries > 0)
+    {
+        serve_cache = Cache_Create(serve_config.cache_entries, serve_config.input_dense, serve_config.output_dense);
+
+        for(uint16_t w = 0; w < serve_config.workers; w++)
+            Attach_Cache(networks[w], serve_cache);
+    }
+
+    serve_queue = (Serve_Request_t *) calloc(SERVE_QUEUE_SIZE, sizeof(Serve_Request_t));
+
+    if(serve_queue == NULL)
+        error_exit(CURRENT_C, "MALLOC_FAILED:NULL");
+
+    // The batching deadlines are on the monotonic clock. (Profile_Now_Ns)
+    pthread_condattr_t cond_attributes;
+    pthread_condattr_init(&cond_attributes);
+    pthread_condattr_setclock(&cond_attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&serve_queue_cond, &cond_attributes);
+    pthread_condattr_destroy(&cond_attributes);
+
+    // Stop on SIGINT/SIGTERM. (No SA_RESTART: epoll_wait returns)
+    struct sigaction stop_action = {.sa_handler = serve_on_signal};
+    sigemptyset(&stop_action.sa_mask);
+    sigaction(SIGINT, &stop_action, NULL);
+    sigaction(SIGTERM, &stop_action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    const int listen_fd = serve_listen();
+    const int epoll_fd  = epoll_create1(EPOLL_CLOEXEC);
+
+    struct epoll_event listen_event = {.events = EPOLLIN, .data.ptr = NULL};
+
+    if( (epoll_fd < 0) || (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_fd, &listen_event) != 0) )
+        error_exit(CURRENT_C, "EPOLL:CREATE_FAILED");
+
+    pthread_t workers[SERVE_MAX_WORKERS];
+
+    for(uint16_t w = 0; w < serve_config.workers; w++)
+    {
+        if(pthread_create(&workers[w], NULL, serve_worker, networks[w]) != 0)
+            error_exit(CURRENT_C, "SERVE_THREAD:CREATE_FAILED");
+    }
+
+    Trace_Thread_Name("serve_loop");
+
+    char listen_name[128];
+
+    if(serve_config.socket_path != NULL)
+        snprintf(listen_name, sizeof(listen_name), "%s", serve_config.socket_path);
+    else
+        snprintf(listen_name, sizeof(listen_name), "127.0.0.1:%u", serve_config.port);
+
+    fprintf(stderr, "ann_serve: %s (%u -> %u) on %s, %u workers, batch %u, delay %u us\n",
+            serve_config.model_path, serve_config.input_dense, serve_config.output_dense, listen_name,
+            serve_config.workers, serve_config.max_batch, serve_config.max_delay_us);
+
+    // Snapshots: At the start & at the last report.
+    static Serve_Snapshot_t start_snapshot, last_snapshot, now_snapshot;
+    serve_snapshot(&start_snapshot);
+    last_snapshot = start_snapshot;
+
+    const uint64_t stats_interval_ns = (uint64_t) serve_config.stats_interval_s * 1000000000ull;
+    struct epoll_event events[SERVE_MAX_EVENTS];
+
+    //===> Event loop.
+    while(serve_stop_signal == 0)
+    {
+        const int events_num = epoll_wait(epoll_fd, events, SERVE_MAX_EVENTS, (stats_interval_ns > 0) ? (250) : (-1));
+
+        for(int e = 0; e < events_num; e++)
+        {
+            Serve_Connection_t *connection = (Serve_Connection_t *) events[e].data.ptr;
+
+            if(connection == NULL)
+            {
+                serve_accept(listen_fd, epoll_fd);
+                continue;
+            }
+
+            if(serve_read(connection) == false)
+            {
+                epoll_ctl(epoll_fd, EPOLL_CTL_DEL, connection->fd, NULL);
+                atomic_store(&connection->closed, true);
+                serve_connection_release(connection);
+            }
+        }
+
+        if( (stats_interval_ns > 0) && ((Profile_Now_Ns() - last_snapshot.ns) >= stats_interval_ns) )
+        {
+            serve_snapshot(&now_snapshot);
+            serve_report("interval", &last_snapshot, &now_snapshot, NULL);
+            last_snapshot = now_snapshot;
+        }
+    }
+
+    //===> Shutdown: Answer the queued requests, then stop the workers.
+    close(listen_fd);
+
+    if(serve_config.socket_path != NULL)
+        unlink(serve_config.socket_path);
+
+    pthread_mutex_lock(&serve_queue_lock);
+    atomic_store(&serve_stopping, true);
+    pthread_cond_broadcast(&serve_queue_cond);
+    pthread_mutex_unlock(&serve_queue_lock);
+
+    for(uint16_t w = 0; w < serve_config.workers; w++)
+    {
+        pthread_join(workers[w], NULL);
+        Free_Network(networks[w]);
+    }
+
+    serve_snapshot(&now_snapshot);
+    serve_report("total", &start_snapshot, &now_snapshot, NULL);
+
+    if(serve_config.stats_json_path != NULL)
+    {
+        FILE *json_file = fopen(serve_config.stats_json_path, "w");
+
+        if(json_file != NULL)
+        {
+            serve_report("total", &start_snapshot, &now_snapshot, json_file);
+            fclose(json_file);
+        }
+    }
+
+    close(epoll_fd);
+    free(serve_queue);
+    Cache_Free(serve_cache);
+
+    return 0;
+}
+
+//!=============================> .END
@@ -0,0 +1,2335 @@
+/**
+ * @file test.c
+ * @author Mohamed Wx (gtlyco205@gmail.com)
+ * @brief Known answer, exhaustive & equivalence tests of the library. (ann_test, ctest)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright Mohamed Wx (c) 2022
+ *
+ */
+//!=============================> .START
+#include "Global.h"
+
+#include <stdarg.h>
+#include <float.h>
+
+#define CURRENT_H "TEST.H"
+#define CURRENT_C "TEST.C"
+
+/*
+    - Usage:
+        ann_test [--filter TEXT]
+            Runs every test whose name contains TEXT (Default: All), prints one line per test &
+            exits with the number of failed tests. (ctest runs them all)
+
+    - Tests:
+        dataset/stream: The CSV & binary streams read back the rows of the in memory dataset, in
+                        order & after a rewind.
+        dataset/errors: A malformed CSV line & a truncated binary row end the streams with their
+                        error, after the batches before them, on every epoch.
+        dataset/map:    The mapped binary files read back the rows of the in memory dataset, in order,
+                        shuffled (Every row once) & rewound.
+        loss/fused:    BCE_Batch & MCCE_Batch equal the unfused losses & their gradients equal the
+                       finite differences of their losses, for any targets.
+        random/philox: The Philox4x32-10 known answers of the Random123 library.
+        random/fill:   The vectorized fills equal the scalar blocks, in one call or in chunks.
+        dropout/gradients: The gradients of a step with dropout equal the finite differences of its
+                           loss. (back_propagation regenerates the masks of the forward pass)
+        init/streams:  The same seed & stream draw the same values on any thread, whatever the
+                       draws before, and the same seed creates the same network.
+        memory/steady: The warmed up passes (Single sample & batched) allocate nothing.
+        network/training:      Check_Network_Training rejects what has no derivative.
+        checkpoint/gradients:  The checkpointed gradients & weights equal the dense ones.
+        train/accumulate:      K accumulated micro-batches of B samples equal one K x B batch.
+        cache/version:     The cached results miss after an optimizer step changes the model version.
+        predict/incremental: Predict_Incremental equals Predict_Network of the updated input.
+        predict/sparse:    The sparse & the strided borrowed inputs equal Predict_Network.
+        prune/kernels:     The CSR & BSR products & the pruned networks equal the dense ones.
+        matrix/svd:    The reconstruction, the orthonormal singular vectors & the decreasing
+                       singular values of full rank, rank deficient & zero matrices, row > col
+                       & row <= col, with the known singular values of the built ones.
+        half/fp16: Every one of the 65536 patterns is widened & rounded back, and every rounding
+                   midpoint (& its float neighbours) is rounded, against the compiler _Float16.
+                   (Skipped without _Float16)
+        half/bf16: Every pattern is widened & rounded back, the midpoints round to the even one.
+        batch/tiles:   The depth-first tiles equal the layer by layer batched pass.
+        tune/cache:    Tune_Network reads back the tile it wrote to its tuning cache.
+*/
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED VARIABLES                     -
+----------------------------------------------------------------
+*/
+
+#define TEST_MAX_REPORTS ((const uint8_t) 8)   // Mismatches printed per test.
+#define TEST_NETWORK_SEED ((const uint64_t) 42)
+
+#define TEST_DATASET_SAMPLES ((const uint16_t) 37)   // (Not a multiple of TEST_DATASET_BATCH)
+#define TEST_DATASET_INPUTS  ((const uint16_t) 3)
+#define TEST_DATASET_OUTPUTS ((const uint16_t) 2)
+#define TEST_DATASET_COLS    ((const uint16_t) 5)    // TEST_DATASET_INPUTS + TEST_DATASET_OUTPUTS.
+#define TEST_DATASET_STRIDE  ((const uint16_t) 8)    // The padded binary rows.
+#define TEST_DATASET_BATCH   ((const uint16_t) 8)
+#define TEST_DATASET_CSV     "ann_test_dataset.csv"
+#define TEST_DATASET_BINARY  "ann_test_dataset.bin"
+#define TEST_DATASET_ALIGNED "ann_test_dataset_aligned.bin"
+#define TEST_DATASET_SEED    ((const uint64_t) 9)    // The shuffle.
+#define TEST_DATASET_BROKEN  ((const uint16_t) 20)   // The malformed CSV line & the truncated binary row.
+
+#define TEST_LOSS_ROWS      ((const uint16_t) 3)
+#define TEST_LOSS_CLASSES   ((const uint16_t) 5)
+#define TEST_LOSS_STEP      ((const double) 1e-5)     // Central differences step.
+#define TEST_LOSS_TOLERANCE ((const double) 1e-8)
+
+#define TEST_FILL_COUNT  ((const uint32_t) 1000)   // Numbers per checked fill.
+#define TEST_GRADIENT_STEP      ((const double) 1e-6)     // Central differences step.
+#define TEST_GRADIENT_TOLERANCE ((const double) 1e-7)
+
+#define TEST_INIT_SEED   ((const uint64_t) 1234)
+#define TEST_INIT_STREAM ((const uint64_t) 77)
+#define TEST_INIT_LEN    ((const uint16_t) 64)
+
+#define TEST_MEMORY_BATCH ((const uint16_t) 16)
+#define TEST_MEMORY_CALLS ((const uint16_t) 100)
+
+#define TEST_ACCUMULATE_STEPS     ((const uint16_t) 4)     // K micro-batches,
+#define TEST_ACCUMULATE_BATCH     ((const uint16_t) 3)     // of B samples.
+#define TEST_ACCUMULATE_TOLERANCE ((const double) 1e-12)
+
+#define TEST_CACHE_ENTRIES ((const uint32_t) 64)
+
+#define TEST_INCREMENTAL_UPDATES   ((const uint16_t) 200)
+#define TEST_INCREMENTAL_TOLERANCE ((const double) 1e-9)
+
+#define TEST_SPARSE_TOLERANCE ((const double) 1e-12)   // (Other summation orders)
+#define TEST_PRUNE_BATCH      ((const uint16_t) 7)
+#define TEST_PRUNE_SPARSITY   ((const double) 0.7)
+
+#define TEST_SVD_EPSILON ((const double) 1e-12)    // Reconstruction & orthogonality, relative to the largest value.
+#define TEST_SVD_RANK    ((const double) 1e-10)    // Singular values below it (relative to the largest) are zero.
+
+#define TEST_TILE_BATCH ((const uint16_t) 37)
+
+#define TEST_TUNE_CACHE "ann_test_tune.cache"
+#define TEST_TUNE_BATCH ((const uint16_t) 32)
+
+/*
+----------------------------------------------------------------
+!-                       DEFINED STRUCTS                       -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Struct for one test
+ *
+ */
+typedef struct _Test_Case_t
+{
+    const char *name;
+    uint32_t (*function) (void);   // Returns the failed checks.
+}Test_Case_t;
+
+/**
+ * @brief Struct for the vector_init draw of one thread
+ *
+ */
+typedef struct _Test_Init_Job_t
+{
+    uint16_t skipped;   // Streams drawn before.
+    double values[TEST_INIT_LEN];
+}Test_Init_Job_t;
+
+/*
+----------------------------------------------------------------
+!-                       STATIC FUNCTIONS                      -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Function to count a failed check & to print the first ones of a test.
+ *
+ * @param failures The failed checks of the test so far.
+ * @param format printf format.
+ * @param ...
+ */
+static void test_fail(uint32_t *failures, const char *format, ...)
+{
+    if(*failures < TEST_MAX_REPORTS)
+    {
+        va_list args;
+        va_start(args, format);
+
+        printf("    ");
+        vprintf(format, args);
+        printf("\n");
+
+        va_end(args);
+    }
+
+    (*failures)++;
+
+    return;
+}//end test_fail.
+
+/**
+ * @brief Function to fill values with a smooth & reproducible pattern. (Another seed, other values)
+ *
+ * @param values
+ * @param len
+ * @param seed
+ */
+static void test_values(double *values, uint32_t len, double seed)
+{
+    for(uint32_t i = 0; i < len; i++)
+        values[i] = sin((0.7 * i) + (1.3 * seed) + 0.1);
+
+    return;
+}//end test_values.
+
+/**
+ * @brief Function to check values against the expected ones.
+ *
+ * @param name
+ * @param actual
+ * @param expected
+ * @param len
+ * @param tolerance The largest absolute difference. (0: Equal)
+ * @param failures
+ */
+static void test_compare(const char *name, const double *actual, const double *expected, uint32_t len, double tolerance, uint32_t *failures)
+{
+    for(uint32_t i = 0; i < len; i++)
+    {
+        if(!(fabs(actual[i] - expected[i]) <= tolerance))
+            test_fail(failures, "%s: [%u] = %.17g, expected %.17g", name, i, actual[i], expected[i]);
+    }
+
+    return;
+}//end test_compare.
+
+/**
+ * @brief Function to fill the in memory dataset. (The first input of a sample is its index)
+ *
+ * @param rows
+ */
+static void test_dataset_rows(double rows[][TEST_DATASET_COLS])
+{
+    for(uint16_t s = 0; s < TEST_DATASET_SAMPLES; s++)
+    {
+        test_values(rows[s], TEST_DATASET_COLS, s);
+        rows[s][0] = s;
+    }
+
+    return;
+}//end test_dataset_rows.
+
+/**
+ * @brief Function to write the in memory dataset as a CSV file (With a header line) & as a binary
+ *        file. (Padded rows of TEST_DATASET_STRIDE)
+ *
+ * @param rows
+ * @return bool (false: A file couldn't be written)
+ */
+static bool test_dataset_write(double rows[][TEST_DATASET_COLS])
+{
+    FILE *csv_file    = fopen(TEST_DATASET_CSV, "w");
+    FILE *binary_file = fopen(TEST_DATASET_BINARY, "wb");
+
+    if( (csv_file == NULL) || (binary_file == NULL) )
+    {
+        if(csv_file != NULL)
+            fclose(csv_file);
+
+        if(binary_file != NULL)
+            fclose(binary_file);
+
+        return false;
+    }
+
+    Dataset_Header_t header = {.version = DATASET_BINARY_VERSION,
+                               .input_dense = TEST_DATASET_INPUTS,
+                               .output_dense = TEST_DATASET_OUTPUTS,
+                               .row_stride = TEST_DATASET_STRIDE,
+                               .samples = TEST_DATASET_SAMPLES};
+    memcpy(header.magic, DATASET_BINARY_MAGIC, sizeof(header.magic));
+
+    bool written = (fprintf(csv_file, "index,x1,x2,y0,y1\n") > 0) &&
+                   (fwrite(&header, sizeof(Dataset_Header_t), 1, binary_file) == 1);
+
+    for(uint16_t s = 0; (written) && (s < TEST_DATASET_SAMPLES); s++)
+    {
+        double padded[TEST_DATASET_STRIDE] = {0.0};
+        memcpy(padded, rows[s], sizeof(double) * TEST_DATASET_COLS);
+
+        for(uint16_t c = 0; c < TEST_DATASET_COLS; c++)
+            written &= (fprintf(csv_file, (c + 1 < TEST_DATASET_COLS) ? ("%.17g,") : ("%.17g\n"), rows[s][c]) > 0);
+
+        written &= (fwrite(padded, sizeof(padded), 1, binary_file) == 1);
+    }
+
+    written &= (fclose(csv_file) == 0);
+    written &= (fclose(binary_file) == 0);
+
+    return written;
+}//end test_dataset_write.
+
+/**
+ * @brief Function to write the in memory dataset as broken files: The CSV file with a malformed
+ *        line & the binary file cut in the middle of a row, at sample TEST_DATASET_BROKEN.
+ *
+ * @param rows
+ * @return bool False if a file couldn't be written.
+ */
+static bool test_dataset_write_broken(double rows[][TEST_DATASET_COLS])
+{
+    FILE *csv_file    = fopen(TEST_DATASET_CSV, "w");
+    FILE *binary_file = fopen(TEST_DATASET_BINARY, "wb");
+
+    if( (csv_file == NULL) || (binary_file == NULL) )
+    {
+        if(csv_file != NULL)
+            fclose(csv_file);
+
+        if(binary_file != NULL)
+            fclose(binary_file);
+
+        return false;
+    }
+
+    // The header still counts every sample.
+    Dataset_Header_t header = {.version = DATASET_BINARY_VERSION,
+                               .input_dense = TEST_DATASET_INPUTS,
+                               .output_dense = TEST_DATASET_OUTPUTS,
+                               .row_stride = TEST_DATASET_STRIDE,
+                               .samples = TEST_DATASET_SAMPLES};
+    memcpy(header.magic, DATASET_BINARY_MAGIC, sizeof(header.magic));
+
+    bool written = (fprintf(csv_file, "index,x1,x2,y0,y1\n") > 0) &&
+                   (fwrite(&header, sizeof(Dataset_Header_t), 1, binary_file) == 1);
+
+    for(uint16_t s = 0; (written) && (s < TEST_DATASET_SAMPLES); s++)
+    {
+        double padded[TEST_DATASET_STRIDE] = {0.0};
+        memcpy(padded, rows[s], sizeof(double) * TEST_DATASET_COLS);
+
+        if(s == TEST_DATASET_BROKEN)
+            written &= (fprintf(csv_file, "%.17g,%.17g,broken,%.17g,%.17g\n", rows[s][0], rows[s][1], rows[s][3], rows[s][4]) > 0);
+        else
+            for(uint16_t c = 0; c < TEST_DATASET_COLS; c++)
+                written &= (fprintf(csv_file, (c + 1 < TEST_DATASET_COLS) ? ("%.17g,") : ("%.17g\n"), rows[s][c]) > 0);
+
+        // The binary file ends in the middle of the broken row.
+        if(s < TEST_DATASET_BROKEN)
+            written &= (fwrite(padded, sizeof(padded), 1, binary_file) == 1);
+        else if(s == TEST_DATASET_BROKEN)
+            written &= (fwrite(padded, sizeof(padded) / 2, 1, binary_file) == 1);
+    }
+
+    written &= (fclose(csv_file) == 0);
+    written &= (fclose(binary_file) == 0);
+
+    return written;
+}//end test_dataset_write_broken.
+
+/**
+ * @brief Function to check the rows of a batch against the in memory dataset.
+ *
+ * @param name
+ * @param batch
+ * @param rows
+ * @param samples The index of the sample of each batch row.
+ * @param failures
+ */
+static void test_dataset_check(const char *name, Dataset_Batch_t *batch, double rows[][TEST_DATASET_COLS],
+                               const uint16_t *samples, uint32_t *failures)
+{
+    for(uint16_t r = 0; r < batch->size; r++)
+    {
+        char row_name[96];
+        snprintf(row_name, sizeof(row_name), "%s sample %u inputs", name, samples[r]);
+        test_compare(row_name, batch->inputs->Matrix_t.Matrix[r], rows[samples[r]], TEST_DATASET_INPUTS, 0.0, failures);
+
+        snprintf(row_name, sizeof(row_name), "%s sample %u outputs", name, samples[r]);
+        test_compare(row_name, batch->outputs->Matrix_t.Matrix[r], &rows[samples[r]][TEST_DATASET_INPUTS], TEST_DATASET_OUTPUTS, 0.0, failures);
+    }
+
+    return;
+}//end test_dataset_check.
+
+/**
+ * @brief Function to check a fused loss kernel against the central differences of its loss.
+ *
+ * @param name
+ * @param loss_function BCE_Batch or MCCE_Batch.
+ * @param logits  [TEST_LOSS_ROWS x TEST_LOSS_CLASSES]
+ * @param desired [TEST_LOSS_ROWS x TEST_LOSS_CLASSES]
+ * @param failures
+ */
+static void test_loss_check(const char *name, double (*loss_function) (Type_t *, Type_t *, Type_t *, uint16_t),
+                            Type_t *logits, Type_t *desired, uint32_t *failures)
+{
+    Type_t *gradient = create_matrix(TEST_LOSS_ROWS, TEST_LOSS_CLASSES, false);
+
+    const double loss = loss_function(logits, desired, gradient, TEST_LOSS_ROWS);
+
+    if(loss_function(logits, desired, NULL, TEST_LOSS_ROWS) != loss)
+        test_fail(failures, "%s: the loss depends on the gradient", name);
+
+    for(uint16_t r = 0; r < TEST_LOSS_ROWS; r++)
+    {
+        for(uint16_t i = 0; i < TEST_LOSS_CLASSES; i++)
+        {
+            double *z = &logits->Matrix_t.Matrix[r][i];
+            const double saved = *z;
+
+            *z = saved + TEST_LOSS_STEP;
+            const double loss_up = loss_function(logits, desired, NULL, TEST_LOSS_ROWS);
+
+            *z = saved - TEST_LOSS_STEP;
+            const double loss_down = loss_function(logits, desired, NULL, TEST_LOSS_ROWS);
+
+            *z = saved;
+
+            const double numeric = (loss_up - loss_down) / (2.0 * TEST_LOSS_STEP);
+
+            if(fabs(numeric - gradient->Matrix_t.Matrix[r][i]) > TEST_LOSS_TOLERANCE)
+                test_fail(failures, "%s: gradient[%u][%u] = %.9f, finite differences %.9f", name, r, i,
+                          gradient->Matrix_t.Matrix[r][i], numeric);
+        }
+    }
+
+    free_matrix(gradient);
+
+    return;
+}//end test_loss_check.
+
+/**
+ * @brief Function to set a copy of some values as the input of a network. (Set_Input keeps it)
+ *
+ * @param network
+ * @param values [input_layer_dense]
+ */
+static void test_set_input(DNN_Network *network, const double *values)
+{
+    Type_t *input = create_vector(network->network_topology->input_layer_dense, false);
+    memcpy(input->Vector_t.Vector, values, sizeof(double) * input->Vector_t.len);
+
+    Set_Input(network, input);
+
+    return;
+}//end test_set_input.
+
+/**
+ * @brief Function to check the weights & the biases of a network (Or their accumulated gradients)
+ *        against the ones of a reference network of the same topology.
+ *
+ * @param name
+ * @param network
+ * @param reference
+ * @param gradients Compare the gradients instead of the weights.
+ * @param tolerance
+ * @param failures
+ */
+static void test_network_compare(const char *name, DNN_Network *network, DNN_Network *reference, bool gradients,
+                                 double tolerance, uint32_t *failures)
+{
+    const uint16_t number_of_matrices = network->network_topology->hidden_layer_num + 1;
+    char layer_name[96];
+
+    if( (gradients) && ( (network->network_layers->Layer_gradients == NULL) || (reference->network_layers->Layer_gradients == NULL) ) )
+    {
+        test_fail(failures, "%s: no gradients", name);
+        return;
+    }
+
+    for(uint16_t layer = 0; layer < number_of_matrices; layer++)
+    {
+        Type_t *weights = (gradients) ? (network->network_layers->Layer_gradients->weights_gradients[layer].layer_weights) :
+                                        (network->network_layers->Layer_weights[layer].layer_weights);
+        Type_t *expected = (gradients) ? (reference->network_layers->Layer_gradients->weights_gradients[layer].layer_weights) :
+                                         (reference->network_layers->Layer_weights[layer].layer_weights);
+
+        for(uint16_t i = 0; i < weights->Matrix_t.row; i++)
+        {
+            snprintf(layer_name, sizeof(layer_name), "%s %s[%u] row %u", name, (gradients) ? ("gradients") : ("weights"), layer, i);
+            test_compare(layer_name, weights->Matrix_t.Matrix[i], expected->Matrix_t.Matrix[i], weights->Matrix_t.col, tolerance, failures);
+        }
+    }
+
+    snprintf(layer_name, sizeof(layer_name), "%s %s", name, (gradients) ? ("biases gradients") : ("biases"));
+
+    if(gradients)
+        test_compare(layer_name, network->network_layers->Layer_gradients->biases_gradients->Vector_t.Vector,
+                     reference->network_layers->Layer_gradients->biases_gradients->Vector_t.Vector, number_of_matrices, tolerance, failures);
+    else
+        test_compare(layer_name, network->network_layers->Layers_biases->layers_biases->Vector_t.Vector,
+                     reference->network_layers->Layers_biases->layers_biases->Vector_t.Vector, number_of_matrices, tolerance, failures);
+
+    return;
+}//end test_network_compare.
+
+/**
+ * @brief Function to draw a vector_init vector on its own thread, after other draws.
+ *
+ * @param arg (Test_Init_Job_t *)
+ * @return void*
+ */
+static void *test_init_worker(void *arg)
+{
+    Test_Init_Job_t *job = (Test_Init_Job_t *) arg;
+
+    Init_Set_Seed(TEST_INIT_SEED);
+
+    for(uint16_t i = 0; i < job->skipped; i++)
+        Init_Next_Stream();
+
+    Init_Set_Stream(TEST_INIT_STREAM);
+
+    Type_t *vector = create_vector(TEST_INIT_LEN, true);
+    memcpy(job->values, vector->Vector_t.Vector, sizeof(job->values));
+    free_vector(vector);
+
+    return NULL;
+}//end test_init_worker.
+
+/**
+ * @brief Function to use as a custom activation. (No derivative)
+ *
+ * @param vector
+ * @return double*
+ */
+static double *test_identity(Type_t *vector)
+{
+    return vector->Vector_t.Vector;
+}//end test_identity.
+
+/**
+ * @brief Function to train a network one step on one sample. (GradientDescent, not Train_Network)
+ *
+ * @param network
+ * @param input [input_layer_dense]
+ * @param desired [output_layer_dense]
+ */
+static void test_train_step(DNN_Network *network, const double *input, double *desired)
+{
+    Type_t desired_vector = {.Vector_t = {.len = network->network_topology->output_layer_dense, .Vector = desired}};
+
+    test_set_input(network, input);
+    forward_propagation_train(network);
+    back_propagation(network, &desired_vector);
+    GradientDescent(network);
+
+    return;
+}//end test_train_step.
+
+/**
+ * @brief Function to check the decomposition of one matrix.
+ *  - Matrix = Sum(p) Singular[p] * Left[p] (outer) Right[p], decreasing singular values, and the
+ *    singular vectors of the non zero singular values are orthonormal.
+ *
+ * @param name
+ * @param matrix
+ * @param rank The expected rank.
+ * @param expected The expected leading singular values. (NULL: Not known)
+ * @param failures
+ */
+static void test_svd_check(const char *name, Type_t *matrix, uint16_t rank, const double *expected, uint32_t *failures)
+{
+    const uint16_t row = matrix->Matrix_t.row; // Temporary variable for readability.
+    const uint16_t col = matrix->Matrix_t.col; // Temporary variable for readability.
+    const uint16_t k = (row < col) ? (row) : (col);
+
+    Type_t *left  = create_matrix(k, row, false);
+    Type_t *right = create_matrix(k, col, false);
+    double singular[MAX_MATRIX_ROW];
+
+    const ANN_Status_t status = Matrix_SVD(matrix, left, singular, right);
+
+    if(status != ANN_OK)
+    {
+        test_fail(failures, "%s: status %d", name, status);
+        free_matrix(left);
+        free_matrix(right);
+        return;
+    }
+
+    double largest = 0.0;
+
+    for(uint16_t i = 0; i < row; i++)
+    {
+        for(uint16_t j = 0; j < col; j++)
+            largest = fmax(largest, fabs(matrix->Matrix_t.Matrix[i][j]));
+    }
+
+    // Reconstruction.
+    double error = 0.0;
+
+    for(uint16_t i = 0; i < row; i++)
+    {
+        for(uint16_t j = 0; j < col; j++)
+        {
+            double sum = 0.0;
+
+            for(uint16_t p = 0; p < k; p++)
+                sum += singular[p] * left->Matrix_t.Matrix[p][i] * right->Matrix_t.Matrix[p][j];
+
+            error = fmax(error, fabs(sum - matrix->Matrix_t.Matrix[i][j]));
+        }
+    }
+
+    if(error > (TEST_SVD_EPSILON * fmax(largest, 1.0)))
+        test_fail(failures, "%s: reconstruction error %.3e", name, error);
+
+    // Decreasing, non negative & the rank.
+    uint16_t found_rank = 0;
+
+    for(uint16_t p = 0; p < k; p++)
+    {
+        if( (singular[p] < 0.0) || ( (p > 0) && (singular[p] > singular[p - 1]) ) )
+            test_fail(failures, "%s: singular[%u] = %.17g after %.17g", name, p, singular[p], (p > 0) ? (singular[p - 1]) : (0.0));
+
+        found_rank += (singular[p] > (TEST_SVD_RANK * singular[0]));
+    }
+
+    if(found_rank != rank)
+        test_fail(failures, "%s: rank %u, expected %u", name, found_rank, rank);
+
+    for(uint16_t p = 0; (expected != NULL) && (p < rank); p++)
+    {
+        if(fabs(singular[p] - expected[p]) > (TEST_SVD_EPSILON * expected[0]))
+            test_fail(failures, "%s: singular[%u] = %.17g, expected %.17g", name, p, singular[p], expected[p]);
+    }
+
+    // Orthonormal singular vectors. (The ones of the non zero singular values)
+    for(uint16_t p = 0; p < found_rank; p++)
+    {
+        for(uint16_t q = p; q < found_rank; q++)
+        {
+            double left_dot = 0.0, right_dot = 0.0;
+
+            for(uint16_t i = 0; i < row; i++)
+                left_dot += left->Matrix_t.Matrix[p][i] * left->Matrix_t.Matrix[q][i];
+
+            for(uint16_t j = 0; j < col; j++)
+                right_dot += right->Matrix_t.Matrix[p][j] * right->Matrix_t.Matrix[q][j];
+
+            const double identity = (p == q) ? (1.0) : (0.0);
+
+            if( (fabs(left_dot - identity) > TEST_SVD_EPSILON) || (fabs(right_dot - identity) > TEST_SVD_EPSILON) )
+                test_fail(failures, "%s: <left %u, left %u> = %.3e, <right %u, right %u> = %.3e", name, p, q, left_dot, p, q, right_dot);
+        }
+    }
+
+    free_matrix(left);
+    free_matrix(right);
+
+    return;
+}//end test_svd_check.
+
+/**
+ * @brief Function to fill a matrix with the transposed of another one.
+ *
+ * @param matrix [col x row]
+ * @param transposed [row x col]
+ */
+static void test_transpose(Type_t *matrix, Type_t *transposed)
+{
+    for(uint16_t i = 0; i < matrix->Matrix_t.row; i++)
+    {
+        for(uint16_t j = 0; j < matrix->Matrix_t.col; j++)
+            transposed->Matrix_t.Matrix[j][i] = matrix->Matrix_t.Matrix[i][j];
+    }
+
+    return;
+}//end test_transpose.
+
+/**
+ * @brief Function to get the bits of a float.
+ *
+ * @param value
+ * @return uint32_t
+ */
+static inline uint32_t test_float_bits(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    return bits;
+}//end test_float_bits.
+
+/**
+ * @brief Function to get the float of some bits.
+ *
+ * @param bits
+ * @return float
+ */
+static inline float test_bits_float(uint32_t bits)
+{
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+
+    return value;
+}//end test_bits_float.
+
+#ifdef __FLT16_MANT_DIG__
+
+/**
+ * @brief Function to round a float to an IEEE half with the compiler. (The reference)
+ *
+ * @param value
+ * @return uint16_t
+ */
+static inline uint16_t test_reference_fp16(float value)
+{
+    const _Float16 half = (_Float16) value;
+    uint16_t bits;
+
+    memcpy(&bits, &half, sizeof(bits));
+
+    return bits;
+}//end test_reference_fp16.
+
+/**
+ * @brief Function to check the rounding of one value against the compiler.
+ *
+ * @param value
+ * @param failures
+ */
+static void test_fp16_round(float value, uint32_t *failures)
+{
+    const uint16_t expected = test_reference_fp16(value);
+    const uint16_t half = Half_Encode(value, HALF_FORMAT_FP16);
+
+    if(isnan(value))
+    {
+        if(!isnan(Half_Decode(half, HALF_FORMAT_FP16)))
+            test_fail(failures, "fp16 round(NaN 0x%08x) = 0x%04x, not a NaN", test_float_bits(value), half);
+    }
+    else if(half != expected)
+    {
+        test_fail(failures, "fp16 round(%.9g) = 0x%04x, expected 0x%04x", value, half, expected);
+    }
+
+    return;
+}//end test_fp16_round.
+
+#endif
+
+/*
+----------------------------------------------------------------
+!-                       TESTS                                 -
+----------------------------------------------------------------
+*/
+
+/**
+ * @brief Test: The CSV & the binary streams read back the rows of the in memory dataset, in order,
+ *        in batches of TEST_DATASET_BATCH (The last one short), again after a rewind.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_dataset_stream(void)
+{
+    static const Dataset_Format_t formats[] = {DATASET_FORMAT_CSV, DATASET_FORMAT_BINARY};
+    static const char *paths[] = {TEST_DATASET_CSV, TEST_DATASET_BINARY};
+
+    double rows[TEST_DATASET_SAMPLES][TEST_DATASET_COLS];
+    uint32_t failures = 0;
+
+    test_dataset_rows(rows);
+
+    if(test_dataset_write(rows) == false)
+    {
+        test_fail(&failures, "can't write %s & %s", TEST_DATASET_CSV, TEST_DATASET_BINARY);
+        return failures;
+    }
+
+    for(uint8_t f = 0; f < (sizeof(formats) / sizeof(formats[0])); f++)
+    {
+        Dataset_Stream_t *stream = Dataset_Open_Stream(paths[f], formats[f], TEST_DATASET_INPUTS, TEST_DATASET_OUTPUTS, TEST_DATASET_BATCH);
+
+        for(uint8_t epoch = 0; epoch < 2; epoch++)
+        {
+            Dataset_Batch_t *batch;
+            uint16_t sample = 0;
+
+            while( (batch = Dataset_Next_Batch(stream)) != NULL )
+            {
+                if( (batch->size == 0) || (batch->size > TEST_DATASET_BATCH) || (sample + batch->size > TEST_DATASET_SAMPLES) )
+                {
+                    test_fail(&failures, "%s epoch %u: batch of %u rows after %u samples", paths[f], epoch, batch->size, sample);
+                    break;
+                }
+
+                uint16_t samples[TEST_DATASET_BATCH];
+
+                for(uint16_t r = 0; r < batch->size; r++)
+                    samples[r] = sample + r;
+
+                test_dataset_check(paths[f], batch, rows, samples, &failures);
+                sample += batch->size;
+            }
+
+            if(sample != TEST_DATASET_SAMPLES)
+                test_fail(&failures, "%s epoch %u: %u samples, expected %u", paths[f], epoch, sample, TEST_DATASET_SAMPLES);
+
+            Dataset_Rewind(stream);
+        }
+
+        Dataset_Close_Stream(stream);
+    }
+
+    remove(TEST_DATASET_CSV);
+    remove(TEST_DATASET_BINARY);
+
+    return failures;
+}//end test_dataset_stream.
+
+/**
+ * @brief Test: A malformed CSV line & a truncated binary row end the streams with ANN_ERROR_INVALID
+ *        & ANN_ERROR_IO, after the batches before the one they are in, on every epoch. (Not exiting
+ *        from the I/O thread)
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_dataset_errors(void)
+{
+    static const Dataset_Format_t formats[] = {DATASET_FORMAT_CSV, DATASET_FORMAT_BINARY};
+    static const char *paths[] = {TEST_DATASET_CSV, TEST_DATASET_BINARY};
+    static const ANN_Status_t expected[] = {ANN_ERROR_INVALID, ANN_ERROR_IO};
+
+    // The batch of the broken sample is dropped.
+    const uint16_t expected_samples = TEST_DATASET_BROKEN - (TEST_DATASET_BROKEN % TEST_DATASET_BATCH);
+
+    double rows[TEST_DATASET_SAMPLES][TEST_DATASET_COLS];
+    uint32_t failures = 0;
+
+    test_dataset_rows(rows);
+
+    if(test_dataset_write_broken(rows) == false)
+    {
+        test_fail(&failures, "can't write %s & %s", TEST_DATASET_CSV, TEST_DATASET_BINARY);
+        return failures;
+    }
+
+    for(uint8_t f = 0; f < (sizeof(formats) / sizeof(formats[0])); f++)
+    {
+        Dataset_Stream_t *stream = Dataset_Open_Stream(paths[f], formats[f], TEST_DATASET_INPUTS, TEST_DATASET_OUTPUTS, TEST_DATASET_BATCH);
+
+        for(uint8_t epoch = 0; epoch < 2; epoch++)
+        {
+            Dataset_Batch_t *batch;
+            ANN_Status_t status;
+            uint16_t sample = 0;
+
+            while( ((status = Dataset_Next_Batch_Checked(stream, &batch)) == ANN_OK) && (batch != NULL) )
+            {
+                if( (batch->size != TEST_DATASET_BATCH) || (sample + batch->size > expected_samples) )
+                {
+                    test_fail(&failures, "%s epoch %u: batch of %u rows after %u samples", paths[f], epoch, batch->size, sample);
+                    break;
+                }
+
+                uint16_t samples[TEST_DATASET_BATCH];
+
+                for(uint16_t r = 0; r < batch->size; r++)
+                    samples[r] = sample + r;
+
+                test_dataset_check(paths[f], batch, rows, samples, &failures);
+                sample += batch->size;
+            }
+
+            if( (status != expected[f]) || (sample != expected_samples) )
+                test_fail(&failures, "%s epoch %u: %s after %u samples, expected %s after %u", paths[f], epoch,
+                          ANN_Status_Name(status), sample, ANN_Status_Name(expected[f]), expected_samples);
+
+            Dataset_Rewind(stream);
+        }
+
+        Dataset_Close_Stream(stream);
+    }
+
+    remove(TEST_DATASET_CSV);
+    remove(TEST_DATASET_BINARY);
+
+    return failures;
+}//end test_dataset_errors.
+
+/**
+ * @brief Test: The mapped binary files (Padded & converted aligned) read back the rows of the in
+ *        memory dataset in order, then every row once after a shuffle, in the same order after a rewind.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_dataset_map(void)
+{
+    static const char *paths[] = {TEST_DATASET_BINARY, TEST_DATASET_ALIGNED};
+
+    double rows[TEST_DATASET_SAMPLES][TEST_DATASET_COLS];
+    uint32_t failures = 0;
+
+    test_dataset_rows(rows);
+
+    if(test_dataset_write(rows) == false)
+    {
+        test_fail(&failures, "can't write %s & %s", TEST_DATASET_CSV, TEST_DATASET_BINARY);
+        return failures;
+    }
+
+    Dataset_CSV_To_Binary(TEST_DATASET_CSV, TEST_DATASET_ALIGNED, TEST_DATASET_INPUTS, TEST_DATASET_OUTPUTS, true);
+
+    for(uint8_t f = 0; f < (sizeof(paths) / sizeof(paths[0])); f++)
+    {
+        Dataset_Map_t *map = Dataset_Open_Map(paths[f], TEST_DATASET_BATCH);
+
+        if(map->samples_num != TEST_DATASET_SAMPLES)
+            test_fail(&failures, "%s: %llu samples, expected %u", paths[f], (unsigned long long) map->samples_num, TEST_DATASET_SAMPLES);
+
+        // In order, shuffled, then rewound. (The shuffled order again)
+        uint16_t shuffled_order[TEST_DATASET_SAMPLES];
+
+        for(uint8_t pass = 0; pass < 3; pass++)
+        {
+            if(pass == 1)
+                Dataset_Shuffle(map, TEST_DATASET_SEED);
+            else if(pass == 2)
+                Dataset_Map_Rewind(map);
+
+            bool visited[TEST_DATASET_SAMPLES] = {false};
+            Dataset_Batch_t *batch;
+            uint16_t sample = 0;
+
+            while( (batch = Dataset_Map_Next_Batch(map)) != NULL )
+            {
+                if( (batch->size == 0) || (batch->size > TEST_DATASET_BATCH) || (sample + batch->size > TEST_DATASET_SAMPLES) )
+                {
+                    test_fail(&failures, "%s pass %u: batch of %u rows after %u samples", paths[f], pass, batch->size, sample);
+                    break;
+                }
+
+                uint16_t samples[TEST_DATASET_BATCH];
+
+                for(uint16_t r = 0; r < batch->size; r++, sample++)
+                {
+                    // The index of the sample. (Any valid one: Checked below)
+                    const double index = batch->inputs->Matrix_t.Matrix[r][0];
+                    samples[r] = ( (index >= 0.0) && (index < TEST_DATASET_SAMPLES) ) ? ((uint16_t) index) : (0);
+
+                    if( (pass == 0) && (samples[r] != sample) )
+                        test_fail(&failures, "%s: row %u is sample %g", paths[f], sample, index);
+
+                    if( (pass == 2) && (samples[r] != shuffled_order[sample]) )
+                        test_fail(&failures, "%s rewound: row %u is sample %g, shuffled %u", paths[f], sample, index, shuffled_order[sample]);
+
+                    if(visited[samples[r]] == true)
+                        test_fail(&failures, "%s pass %u: sample %u visited twice", paths[f], pass, samples[r]);
+
+                    visited[samples[r]] = true;
+                    shuffled_order[sample] = (pass == 1) ? (samples[r]) : (shuffled_order[sample]);
+                }
+
+                test_dataset_check(paths[f], batch, rows, samples, &failures);
+            }
+
+            if(sample != TEST_DATASET_SAMPLES)
+                test_fail(&failures, "%s pass %u: %u samples, expected %u", paths[f], pass, sample, TEST_DATASET_SAMPLES);
+        }
+
+        Dataset_Close_Map(map);
+    }
+
+    remove(TEST_DATASET_CSV);
+    remove(TEST_DATASET_BINARY);
+    remove(TEST_DATASET_ALIGNED);
+
+    return failures;
+}//end test_dataset_map.
+
+/**
+ * @brief Test: BCE_Batch & MCCE_Batch, their losses against the unfused ones & their gradients
+ *        against the finite differences, for one hot, soft, multi hot & unnormalized targets.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_loss_fused(void)
+{
+    static const char *target_names[] = {"one hot", "soft", "multi hot", "unnormalized"};
+
+    Type_t *logits  = create_matrix(TEST_LOSS_ROWS, TEST_LOSS_CLASSES, false);
+    Type_t *desired = create_matrix(TEST_LOSS_ROWS, TEST_LOSS_CLASSES, false);
+
+    uint32_t failures = 0;
+    char name[64];
+
+    for(uint16_t r = 0; r < TEST_LOSS_ROWS; r++)
+    {
+        for(uint16_t i = 0; i < TEST_LOSS_CLASSES; i++)
+            logits->Matrix_t.Matrix[r][i] = 3.0 * sin((1.7 * r) + (0.9 * i) + 0.3);
+    }
+
+    for(uint8_t kind = 0; kind < (sizeof(target_names) / sizeof(target_names[0])); kind++)
+    {
+        for(uint16_t r = 0; r < TEST_LOSS_ROWS; r++)
+        {
+            for(uint16_t i = 0; i < TEST_LOSS_CLASSES; i++)
+            {
+                double *t = &desired->Matrix_t.Matrix[r][i];
+
+                switch(kind)
+                {
+                    case 0:  *t = (i == (r % TEST_LOSS_CLASSES)) ? (1.0) : (0.0);   break;
+                    case 1:  *t = (i + 1.0) / ((TEST_LOSS_CLASSES * (TEST_LOSS_CLASSES + 1.0)) / 2.0); break;
+                    case 2:  *t = ((i + r) % 2 == 0) ? (1.0) : (0.0);               break;
+                    default: *t = 0.25 + (0.5 * i);                                  break;
+                }
+            }
+        }
+
+        // The unfused losses of the activated outputs. (Mean over the rows)
+        double bce = 0.0, mcce = 0.0;
+
+        for(uint16_t r = 0; r < TEST_LOSS_ROWS; r++)
+        {
+            double sigmoid[TEST_LOSS_CLASSES], softmax[TEST_LOSS_CLASSES];
+            Type_t sigmoid_vector = {.Vector_t = {.len = TEST_LOSS_CLASSES, .Vector = sigmoid}};
+            Type_t softmax_vector = {.Vector_t = {.len = TEST_LOSS_CLASSES, .Vector = softmax}};
+            Type_t desired_vector = {.Vector_t = {.len = TEST_LOSS_CLASSES, .Vector = desired->Matrix_t.Matrix[r]}};
+
+            memcpy(sigmoid, logits->Matrix_t.Matrix[r], sizeof(sigmoid));
+            memcpy(softmax, logits->Matrix_t.Matrix[r], sizeof(softmax));
+            Sigmoid(&sigmoid_vector);
+            SoftMax(&softmax_vector);
+
+            bce  += BCE(&desired_vector, &sigmoid_vector) / TEST_LOSS_ROWS;
+            mcce += MCCE(&desired_vector, &softmax_vector) / TEST_LOSS_ROWS;
+        }
+
+        snprintf(name, sizeof(name), "BCE_Batch %s", target_names[kind]);
+
+        if(fabs(BCE_Batch(logits, desired, NULL, TEST_LOSS_ROWS) - bce) > TEST_LOSS_TOLERANCE)
+            test_fail(&failures, "%s: loss %.12f, BCE %.12f", name, BCE_Batch(logits, desired, NULL, TEST_LOSS_ROWS), bce);
+
+        test_loss_check(name, BCE_Batch, logits, desired, &failures);
+
+        snprintf(name, sizeof(name), "MCCE_Batch %s", target_names[kind]);
+
+        if(fabs(MCCE_Batch(logits, desired, NULL, TEST_LOSS_ROWS) - mcce) > TEST_LOSS_TOLERANCE)
+            test_fail(&failures, "%s: loss %.12f, MCCE %.12f", name, MCCE_Batch(logits, desired, NULL, TEST_LOSS_ROWS), mcce);
+
+        test_loss_check(name, MCCE_Batch, logits, desired, &failures);
+    }
+
+    free_matrix(logits);
+    free_matrix(desired);
+
+    return failures;
+}//end test_loss_fused.
+
+/**
+ * @brief Test: The Philox4x32-10 known answer vectors. (Random123 kat_vectors)
+ *  - Counter (c0, c1, c2, c3) = (counter_lo, counter_lo >> 32, counter_hi, counter_hi >> 32),
+ *    key (k0, k1) = (key, key >> 32).
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_random_philox(void)
+{
+    static const struct
+    {
+        uint32_t counter[4];
+        uint32_t key[2];
+        uint32_t expected[4];
+    }vectors[] =
+    {
+        {{0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u}, {0x00000000u, 0x00000000u},
+         {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}},
+        {{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}, {0xffffffffu, 0xffffffffu},
+         {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}},
+        {{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}, {0xa4093822u, 0x299f31d0u},
+         {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}},
+    };
+
+    uint32_t failures = 0;
+
+    for(uint8_t v = 0; v < (sizeof(vectors) / sizeof(vectors[0])); v++)
+    {
+        const uint64_t counter_lo = ((uint64_t) vectors[v].counter[1] << 32) | vectors[v].counter[0];
+        const uint64_t counter_hi = ((uint64_t) vectors[v].counter[3] << 32) | vectors[v].counter[2];
+        const uint64_t key        = ((uint64_t) vectors[v].key[1] << 32) | vectors[v].key[0];
+
+        const Random_Block_t block = Random_Philox(counter_lo, counter_hi, key);
+
+        if(memcmp(block.value, vectors[v].expected, sizeof(block.value)) != 0)
+            test_fail(&failures, "philox vector %u = %08x %08x %08x %08x, expected %08x %08x %08x %08x", v,
+                      block.value[0], block.value[1], block.value[2], block.value[3],
+                      vectors[v].expected[0], vectors[v].expected[1], vectors[v].expected[2], vectors[v].expected[3]);
+    }
+
+    return failures;
+}//end test_random_philox.
+
+/**
+ * @brief Test: Number i of a stream is word (i % 4) of the block (i / 4, stream), whatever the
+ *        fill offsets & chunks. (The 32 bits carry of the block counter included)
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_random_fill(void)
+{
+    static const uint64_t offsets[] = {0, 1, 3, 4, 37, (4ull << 32) - 513};
+    static const uint32_t chunks[]  = {1, 2, 3, 5, 7, 64, 129};
+
+    const uint64_t key    = Random_Key(42, 7);
+    const uint64_t stream = 0x0123456789ABCDEFull;
+
+    uint32_t whole[TEST_FILL_COUNT], chunked[TEST_FILL_COUNT];
+    uint32_t failures = 0;
+
+    for(uint8_t o = 0; o < (sizeof(offsets) / sizeof(offsets[0])); o++)
+    {
+        const uint64_t offset = offsets[o];
+
+        Random_Fill_U32(key, stream, offset, whole, TEST_FILL_COUNT);
+
+        for(uint32_t i = 0; i < TEST_FILL_COUNT; i++)
+        {
+            const uint64_t index = offset + i;
+            const Random_Block_t block = Random_Philox(index / 4, stream, key);
+
+            if(whole[i] != block.value[index % 4])
+                test_fail(&failures, "fill(offset %llu)[%u] = %08x, expected %08x", (unsigned long long) offset, i, whole[i], block.value[index % 4]);
+        }
+
+        for(uint8_t c = 0; c < (sizeof(chunks) / sizeof(chunks[0])); c++)
+        {
+            for(uint32_t filled = 0; filled < TEST_FILL_COUNT; filled += chunks[c])
+            {
+                const uint32_t count = (TEST_FILL_COUNT - filled < chunks[c]) ? (TEST_FILL_COUNT - filled) : (chunks[c]);
+                Random_Fill_U32(key, stream, offset + filled, &chunked[filled], count);
+            }
+
+            if(memcmp(whole, chunked, sizeof(whole)) != 0)
+                test_fail(&failures, "fill(offset %llu) in chunks of %u differs", (unsigned long long) offset, chunks[c]);
+        }
+    }
+
+    return failures;
+}//end test_random_fill.
+
+/**
+ * @brief Test: The gradients of a training step with dropout equal the finite differences of its
+ *        loss. (The forward passes of the same step drop the same neurons: back_propagation must
+ *        regenerate the masks of the forward pass)
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_dropout_gradients(void)
+{
+    Network_Topology_t topology = {.input_layer_dense  = 5,
+                                   .hidden_layer_dense = 12,
+                                   .hidden_layer_num   = 3,
+                                   .output_layer_dense = 3,
+                                   .activation_function        = &Tanh,
+                                   .output_activation_function = &SoftMax,
+                                   .loss_function              = &MCCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.1,
+                               .dropout = true,
+                               .dropout_rate = 0.5,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED};
+
+    DNN_Network *network = Create_Network(&topology, &config);
+
+    double input[5];
+    double desired_values[3] = {0.2, 0.5, 0.3};
+    Type_t desired = {.Vector_t = {.len = 3, .Vector = desired_values}};
+    Type_t *output = network->network_layers->Output_layer->output_layer;
+
+    test_values(input, 5, 1.0);
+    test_set_input(network, input);
+
+    uint32_t failures = 0;
+
+    // The masks of the step drop some neurons & keep others. (A kept Tanh neuron isn't 0)
+    forward_propagation_train(network);
+
+    uint16_t dropped = 0;
+
+    for(uint16_t layer = 0; layer < topology.hidden_layer_num; layer++)
+    {
+        for(uint16_t i = 0; i < topology.hidden_layer_dense; i++)
+            dropped += (network->network_layers->Hidden_layer[layer].hidden_layer->Vector_t.Vector[i] == 0.0);
+    }
+
+    if( (dropped == 0) || (dropped == (topology.hidden_layer_num * topology.hidden_layer_dense)) )
+        test_fail(&failures, "%u of %u hidden neurons dropped", dropped, topology.hidden_layer_num * topology.hidden_layer_dense);
+
+    // The finite differences of the loss, at the same step. (Before back_propagation moves it)
+    const uint16_t number_of_matrices = topology.hidden_layer_num + 1;
+    double *numeric[MAX_HIDDEN_LAYER_NUM + 1];
+    double numeric_biases[MAX_HIDDEN_LAYER_NUM + 1];
+
+    for(uint16_t layer = 0; layer <= number_of_matrices; layer++)
+    {
+        const bool bias = (layer == number_of_matrices);   // (The biases, after the weights)
+        Type_t *weights = (bias) ? (network->network_layers->Layers_biases->layers_biases) :
+                                   (network->network_layers->Layer_weights[layer].layer_weights);
+        const uint16_t rows = (bias) ? (1) : (weights->Matrix_t.row);
+        const uint16_t cols = (bias) ? (number_of_matrices) : (weights->Matrix_t.col);
+
+        if(bias == false)
+            numeric[layer] = (double *) malloc(sizeof(double) * rows * cols);
+
+        for(uint16_t i = 0; i < rows; i++)
+        {
+            for(uint16_t j = 0; j < cols; j++)
+            {
+                double *value = (bias) ? (&weights->Vector_t.Vector[j]) : (&weights->Matrix_t.Matrix[i][j]);
+                const double saved = *value;
+
+                *value = saved + TEST_GRADIENT_STEP;
+                forward_propagation_train(network);
+                const double loss_up = topology.loss_function(&desired, output);
+
+                *value = saved - TEST_GRADIENT_STEP;
+                forward_propagation_train(network);
+                const double loss_down = topology.loss_function(&desired, output);
+
+                *value = saved;
+
+                const double gradient = (loss_up - loss_down) / (2.0 * TEST_GRADIENT_STEP);
+
+                if(bias)
+                    numeric_biases[j] = gradient;
+                else
+                    numeric[layer][(i * cols) + j] = gradient;
+            }
+        }
+    }
+
+    // The gradients of the step.
+    forward_propagation_train(network);
+    back_propagation(network, &desired);
+
+    Layer_Gradients *gradients = network->network_layers->Layer_gradients; // (Temporary variable for readbility).
+    char name[64];
+
+    for(uint16_t layer = 0; layer < number_of_matrices; layer++)
+    {
+        Type_t *weights_gradients = gradients->weights_gradients[layer].layer_weights;
+
+        for(uint16_t i = 0; i < weights_gradients->Matrix_t.row; i++)
+        {
+            snprintf(name, sizeof(name), "gradients[%u] row %u", layer, i);
+            test_compare(name, weights_gradients->Matrix_t.Matrix[i], &numeric[layer][i * weights_gradients->Matrix_t.col],
+                         weights_gradients->Matrix_t.col, TEST_GRADIENT_TOLERANCE, &failures);
+        }
+
+        free(numeric[layer]);
+    }
+
+    test_compare("biases gradients", gradients->biases_gradients->Vector_t.Vector, numeric_biases, number_of_matrices,
+                 TEST_GRADIENT_TOLERANCE, &failures);
+
+    Free_Network(network);
+
+    return failures;
+}//end test_dropout_gradients.
+
+/**
+ * @brief Test: vector_init draws the same values from the same seed & stream, whatever the draws
+ *        of the thread before & of the other threads, and the networks of one seed are equal.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_init_streams(void)
+{
+    Test_Init_Job_t jobs[2] = {{.skipped = 0}, {.skipped = 50}};
+    pthread_t threads[2];
+    uint32_t failures = 0;
+
+    for(uint8_t t = 0; t < 2; t++)
+    {
+        if(pthread_create(&threads[t], NULL, test_init_worker, &jobs[t]) != 0)
+            error_exit(CURRENT_C, "THREAD:CREATE_FAILED");
+    }
+
+    // Meanwhile, other draws of the same seed on this thread.
+    Test_Init_Job_t main_job = {.skipped = 7};
+    test_init_worker(&main_job);
+
+    for(uint8_t t = 0; t < 2; t++)
+    {
+        pthread_join(threads[t], NULL);
+        test_compare((t == 0) ? ("thread 0") : ("thread 1"), jobs[t].values, main_job.values, TEST_INIT_LEN, 0.0, &failures);
+    }
+
+    Network_Topology_t topology = {.input_layer_dense  = 9,
+                                   .hidden_layer_dense = 14,
+                                   .hidden_layer_num   = 2,
+                                   .output_layer_dense = 4,
+                                   .activation_function        = &ReLU,
+                                   .output_activation_function = &Sigmoid,
+                                   .loss_function              = &MSE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.1,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL,
+                               .output_weight_init = INIT_XAVIER_UNIFORM};
+
+    DNN_Network *network   = Create_Network(&topology, &config);
+    DNN_Network *reference = Create_Network(&topology, &config);
+
+    test_network_compare("network", network, reference, false, 0.0, &failures);
+
+    Free_Network(network);
+    Free_Network(reference);
+
+    return failures;
+}//end test_init_streams.
+
+/**
+ * @brief Test: Once warmed up, the single sample & the batched passes allocate nothing.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_memory_steady(void)
+{
+    Network_Topology_t topology = {.input_layer_dense  = 10,
+                                   .hidden_layer_dense = 16,
+                                   .hidden_layer_num   = 3,
+                                   .output_layer_dense = 4,
+                                   .activation_function        = &ELU,
+                                   .output_activation_function = &SoftMax,
+                                   .loss_function              = &MCCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.1,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+
+    DNN_Network *network = Create_Network(&topology, &config);
+
+    Type_t *inputs  = create_matrix(TEST_MEMORY_BATCH, topology.input_layer_dense, false);
+    Type_t *outputs = create_matrix(TEST_MEMORY_BATCH, topology.output_layer_dense, false);
+    double output[4];
+    uint32_t failures = 0;
+
+    for(uint16_t r = 0; r < TEST_MEMORY_BATCH; r++)
+        test_values(inputs->Matrix_t.Matrix[r], topology.input_layer_dense, r);
+
+    test_set_input(network, inputs->Matrix_t.Matrix[0]);
+
+    // Warm up. (The workspaces & the pools)
+    forward_propagation(network);
+    forward_propagation_batch(network, inputs, outputs, TEST_MEMORY_BATCH);
+    Predict_Network(network, inputs->Matrix_t.Matrix[1], topology.input_layer_dense, output, topology.output_layer_dense);
+    Predict_Batch_Network(network, inputs, outputs, TEST_MEMORY_BATCH);
+
+    const uint64_t allocations = Memory_Allocations();
+
+    for(uint16_t call = 0; call < TEST_MEMORY_CALLS; call++)
+    {
+        forward_propagation(network);
+        forward_propagation_batch(network, inputs, outputs, TEST_MEMORY_BATCH);
+        Predict_Network(network, inputs->Matrix_t.Matrix[call % TEST_MEMORY_BATCH], topology.input_layer_dense, output, topology.output_layer_dense);
+        Predict_Batch_Network(network, inputs, outputs, TEST_MEMORY_BATCH);
+    }
+
+    if(Memory_Allocations() != allocations)
+        test_fail(&failures, "%llu allocations in %u calls", (unsigned long long) (Memory_Allocations() - allocations), TEST_MEMORY_CALLS);
+
+    free_matrix(inputs);
+    free_matrix(outputs);
+    Free_Network(network);
+
+    return failures;
+}//end test_memory_steady.
+
+/**
+ * @brief Test: Check_Network_Training rejects the activations & the losses without a derivative.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_network_training(void)
+{
+    static const struct
+    {
+        const char *name;
+        double * (*activation_function) (Type_t *);
+        double * (*output_activation_function) (Type_t *);
+        double (*loss_function) (Type_t *, Type_t *);
+        ANN_Status_t expected;
+    }cases[] =
+    {
+        {"tanh, softmax, mcce",   &Tanh,          &SoftMax,       &MCCE, ANN_OK},
+        {"relu, sigmoid, bce",    &ReLU,          &Sigmoid,       &BCE,  ANN_OK},
+        {"custom hidden",         &test_identity, &Sigmoid,       &MSE,  ANN_ERROR_INVALID},
+        {"custom output",         &ELU,           &test_identity, &MAE,  ANN_ERROR_INVALID},
+        {"loss without derivative", &Tanh,        &Sigmoid,       &BC,   ANN_ERROR_INVALID},
+    };
+
+    uint32_t failures = 0;
+
+    if(Check_Network_Training(NULL) != ANN_ERROR_NULL)
+        test_fail(&failures, "NULL network: %s", ANN_Status_Name(Check_Network_Training(NULL)));
+
+    for(uint8_t c = 0; c < (sizeof(cases) / sizeof(cases[0])); c++)
+    {
+        Network_Topology_t topology = {.input_layer_dense  = 3,
+                                       .hidden_layer_dense = 4,
+                                       .hidden_layer_num   = 2,
+                                       .output_layer_dense = 2,
+                                       .activation_function        = cases[c].activation_function,
+                                       .output_activation_function = cases[c].output_activation_function,
+                                       .loss_function              = cases[c].loss_function,
+                                       .optimizer_function         = &GradientDescent};
+
+        Network_Config_t config = {.learning_rate = 0.1,
+                                   .epochs = 1,
+                                   .seed = TEST_NETWORK_SEED,
+                                   .weight_init = INIT_HE_NORMAL};
+
+        DNN_Network *network = Create_Network(&topology, &config);
+
+        const ANN_Status_t status = Check_Network_Training(network);
+
+        if(status != cases[c].expected)
+            test_fail(&failures, "%s: %s, expected %s", cases[c].name, ANN_Status_Name(status), ANN_Status_Name(cases[c].expected));
+
+        Free_Network(network);
+    }
+
+    return failures;
+}//end test_network_training.
+
+/**
+ * @brief Test: The gradients & the trained weights of checkpointed networks equal the ones of the
+ *        network keeping every hidden layer. (Dropout on: The recomputed segments drop the same neurons)
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_checkpoint_gradients(void)
+{
+    static const uint16_t intervals[] = {2, 3, 5};
+
+    Network_Topology_t topology = {.input_layer_dense  = 6,
+                                   .hidden_layer_dense = 10,
+                                   .hidden_layer_num   = 7,
+                                   .output_layer_dense = 3,
+                                   .activation_function        = &ELU,
+                                   .output_activation_function = &SoftMax,
+                                   .loss_function              = &MCCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.1,
+                               .dropout = true,
+                               .dropout_rate = 0.2,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+
+    double desired_values[3] = {0.0, 1.0, 0.0};
+    Type_t desired = {.Vector_t = {.len = 3, .Vector = desired_values}};
+    uint32_t failures = 0;
+    char name[64];
+
+    for(uint8_t k = 0; k < (sizeof(intervals) / sizeof(intervals[0])); k++)
+    {
+        Network_Config_t checkpoint_config = {.learning_rate = 0.1,
+                                              .dropout = true,
+                                              .dropout_rate = 0.2,
+                                              .epochs = 1,
+                                              .seed = TEST_NETWORK_SEED,
+                                              .weight_init = INIT_HE_NORMAL,
+                                              .checkpoint_interval = intervals[k]};
+
+        DNN_Network *reference = Create_Network(&topology, &config);
+        DNN_Network *network   = Create_Network(&topology, &checkpoint_config);
+
+        if(network->network_layers->Checkpoint_interval != intervals[k])
+            test_fail(&failures, "interval %u: checkpoints every %u layers", intervals[k], network->network_layers->Checkpoint_interval);
+
+        // Two steps of three samples.
+        for(uint16_t step = 0; step < 2; step++)
+        {
+            for(uint16_t s = 0; s < 3; s++)
+            {
+                double input[6];
+                test_values(input, 6, (3 * step) + s);
+
+                test_set_input(reference, input);
+                test_set_input(network, input);
+
+                forward_propagation_train(reference);
+                forward_propagation_train(network);
+
+                const double reference_loss = back_propagation(reference, &desired);
+                const double loss = back_propagation(network, &desired);
+
+                if(loss != reference_loss)
+                    test_fail(&failures, "interval %u step %u sample %u: loss %.17g, expected %.17g", intervals[k], step, s, loss, reference_loss);
+            }
+
+            snprintf(name, sizeof(name), "interval %u step %u", intervals[k], step);
+            test_network_compare(name, network, reference, true, 0.0, &failures);
+
+            GradientDescent(reference);
+            GradientDescent(network);
+
+            test_network_compare(name, network, reference, false, 0.0, &failures);
+        }
+
+        Free_Network(reference);
+        Free_Network(network);
+    }
+
+    return failures;
+}//end test_checkpoint_gradients.
+
+/**
+ * @brief Test: K micro-batches of B samples accumulated before one step train the weights of one
+ *        batch of K x B samples, and a batch of one repeated sample trains the weights of that sample.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_train_accumulate(void)
+{
+    const uint16_t samples_num = TEST_ACCUMULATE_STEPS * TEST_ACCUMULATE_BATCH;
+
+    Network_Topology_t topology = {.input_layer_dense  = 4,
+                                   .hidden_layer_dense = 8,
+                                   .hidden_layer_num   = 2,
+                                   .output_layer_dense = 2,
+                                   .activation_function        = &Sigmoid,
+                                   .output_activation_function = &Sigmoid,
+                                   .loss_function              = &MSE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.5,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+    Network_Config_t batch_config = {.learning_rate = 0.5,
+                                     .epochs = 1,
+                                     .batch_size = samples_num,
+                                     .seed = TEST_NETWORK_SEED,
+                                     .weight_init = INIT_HE_NORMAL};
+
+    Type_t *inputs   = create_matrix(samples_num, topology.input_layer_dense, false);
+    Type_t *desired  = create_matrix(samples_num, topology.output_layer_dense, false);
+    Type_t *repeated = create_matrix(samples_num, topology.input_layer_dense, false);
+    Type_t *repeated_desired = create_matrix(samples_num, topology.output_layer_dense, false);
+    uint32_t failures = 0;
+
+    for(uint16_t s = 0; s < samples_num; s++)
+    {
+        test_values(inputs->Matrix_t.Matrix[s], topology.input_layer_dense, s);
+        test_values(desired->Matrix_t.Matrix[s], topology.output_layer_dense, -s);
+
+        for(uint16_t i = 0; i < topology.output_layer_dense; i++)
+            desired->Matrix_t.Matrix[s][i] = fabs(desired->Matrix_t.Matrix[s][i]);
+
+        memcpy(repeated->Matrix_t.Matrix[s], inputs->Matrix_t.Matrix[0], sizeof(double) * topology.input_layer_dense);
+        memcpy(repeated_desired->Matrix_t.Matrix[s], desired->Matrix_t.Matrix[0], sizeof(double) * topology.output_layer_dense);
+    }
+
+    // One batch of K x B samples.
+    DNN_Network *batch = Create_Network(&topology, &batch_config);
+    Train_Network(batch, inputs, desired, samples_num);
+
+    // K micro-batches of B samples, then one step.
+    DNN_Network *micro = Create_Network(&topology, &config);
+
+    for(uint16_t m = 0; m < TEST_ACCUMULATE_STEPS; m++)
+    {
+        for(uint16_t s = m * TEST_ACCUMULATE_BATCH; s < (m + 1) * TEST_ACCUMULATE_BATCH; s++)
+        {
+            Type_t desired_row = {.Vector_t = {.len = topology.output_layer_dense, .Vector = desired->Matrix_t.Matrix[s]}};
+
+            test_set_input(micro, inputs->Matrix_t.Matrix[s]);
+            forward_propagation_train(micro);
+            back_propagation(micro, &desired_row);
+        }
+    }
+
+    GradientDescent(micro);
+
+    test_network_compare("micro-batches", micro, batch, false, TEST_ACCUMULATE_TOLERANCE, &failures);
+
+    // The mean: K x B copies of one sample step like the sample alone.
+    DNN_Network *single   = Create_Network(&topology, &config);
+    DNN_Network *repeats  = Create_Network(&topology, &batch_config);
+
+    Train_Network(single, inputs, desired, 1);
+    Train_Network(repeats, repeated, repeated_desired, samples_num);
+
+    test_network_compare("repeated sample", repeats, single, false, TEST_ACCUMULATE_TOLERANCE, &failures);
+
+    Free_Network(batch);
+    Free_Network(micro);
+    Free_Network(single);
+    Free_Network(repeats);
+    free_matrix(inputs);
+    free_matrix(desired);
+    free_matrix(repeated);
+    free_matrix(repeated_desired);
+
+    return failures;
+}//end test_train_accumulate.
+
+/**
+ * @brief Test: A cached input hits until an optimizer step changes the model version, then misses
+ *        & returns the output of the new weights.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_cache_version(void)
+{
+    Network_Topology_t topology = {.input_layer_dense  = 6,
+                                   .hidden_layer_dense = 10,
+                                   .hidden_layer_num   = 2,
+                                   .output_layer_dense = 3,
+                                   .activation_function        = &Tanh,
+                                   .output_activation_function = &SoftMax,
+                                   .loss_function              = &MCCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.5,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+
+    DNN_Network *network = Create_Network(&topology, &config);
+    Cache_t *cache = Cache_Create(TEST_CACHE_ENTRIES, topology.input_layer_dense, topology.output_layer_dense);
+    Cache_Report_t report;
+
+    double input[6], first[3], second[3], trained[3], uncached[3];
+    double desired[3] = {1.0, 0.0, 0.0};
+    uint32_t failures = 0;
+
+    test_values(input, 6, 2.0);
+
+    Attach_Cache(network, cache);
+
+    Predict_Network(network, input, 6, first, 3);
+    Predict_Network(network, input, 6, second, 3);
+
+    Cache_Get_Report(cache, &report);
+
+    if( (report.misses != 1) || (report.hits != 1) )
+        test_fail(&failures, "before the step: %llu misses & %llu hits, expected 1 & 1",
+                  (unsigned long long) report.misses, (unsigned long long) report.hits);
+
+    test_compare("cached output", second, first, 3, 0.0, &failures);
+
+    // One optimizer step.
+    const uint64_t version = Model_Version(network);
+
+    test_train_step(network, input, desired);
+
+    if(Model_Version(network) == version)
+        test_fail(&failures, "the model version didn't change: %016llx", (unsigned long long) version);
+
+    Predict_Network(network, input, 6, trained, 3);
+
+    Cache_Get_Report(cache, &report);
+
+    if( (report.misses != 2) || (report.hits != 1) )
+        test_fail(&failures, "after the step: %llu misses & %llu hits, expected 2 & 1",
+                  (unsigned long long) report.misses, (unsigned long long) report.hits);
+
+    Attach_Cache(network, NULL);
+    Predict_Network(network, input, 6, uncached, 3);
+
+    test_compare("output after the step", trained, uncached, 3, 0.0, &failures);
+
+    if(memcmp(trained, first, sizeof(first)) == 0)
+        test_fail(&failures, "the step didn't change the output");
+
+    Cache_Free(cache);
+    Free_Network(network);
+
+    return failures;
+}//end test_cache_version.
+
+/**
+ * @brief Test: Predict_Incremental follows Predict_Network of the updated input, across an
+ *        optimizer step.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_predict_incremental(void)
+{
+    Network_Topology_t topology = {.input_layer_dense  = 16,
+                                   .hidden_layer_dense = 12,
+                                   .hidden_layer_num   = 2,
+                                   .output_layer_dense = 3,
+                                   .activation_function        = &ReLU,
+                                   .output_activation_function = &SoftMax,
+                                   .loss_function              = &MCCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.5,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+
+    DNN_Network *network = Create_Network(&topology, &config);
+
+    double input[16], output[3], expected[3];
+    double desired[3] = {0.0, 0.0, 1.0};
+    uint32_t failures = 0;
+    char name[64];
+
+    test_values(input, 16, 3.0);
+
+    Predict_Incremental_Reset(network, input, 16, output, 3);
+    Predict_Network(network, input, 16, expected, 3);
+    test_compare("reset", output, expected, 3, TEST_INCREMENTAL_TOLERANCE, &failures);
+
+    for(uint16_t update = 0; update < TEST_INCREMENTAL_UPDATES; update++)
+    {
+        // Two different inputs change. (6 * update + 3 is odd: Never a multiple of 16)
+        const uint16_t indices[2] = {update % 16, ((update * 7) + 3) % 16};
+        const double deltas[2] = {0.25 * sin(update), -0.5 * cos(update)};
+
+        // Half way: New weights. (The accumulator is computed again)
+        if(update == (TEST_INCREMENTAL_UPDATES / 2))
+            test_train_step(network, input, desired);
+
+        input[indices[0]] += deltas[0];
+        input[indices[1]] += deltas[1];
+
+        if(Predict_Incremental(network, indices, deltas, 2, output, 3) != ANN_OK)
+            test_fail(&failures, "update %u: Predict_Incremental failed", update);
+
+        Predict_Network(network, input, 16, expected, 3);
+
+        snprintf(name, sizeof(name), "update %u", update);
+        test_compare(name, output, expected, 3, TEST_INCREMENTAL_TOLERANCE, &failures);
+    }
+
+    Free_Network(network);
+
+    return failures;
+}//end test_predict_incremental.
+
+/**
+ * @brief Test: The sparse inputs (Predict_Sparse_Network & Bind_Sparse_Input) & the strided borrowed
+ *        inputs (Bind_Input) give the outputs of Predict_Network on the dense input.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_predict_sparse(void)
+{
+    Network_Topology_t topology = {.input_layer_dense  = 16,
+                                   .hidden_layer_dense = 12,
+                                   .hidden_layer_num   = 2,
+                                   .output_layer_dense = 3,
+                                   .activation_function        = &ELU,
+                                   .output_activation_function = &Sigmoid,
+                                   .loss_function              = &BCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.1,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+
+    DNN_Network *network = Create_Network(&topology, &config);
+    Type_t *output_layer = network->network_layers->Output_layer->output_layer;
+
+    // Unordered with a repeated index, then one-hot. (values NULL: 1.0)
+    static const uint16_t indices[2][4] = {{3, 11, 0, 3}, {5, 9}};
+    static const double values[4] = {0.5, -1.25, 2.0, 0.25};
+    static const uint16_t nnz[2] = {4, 2};
+
+    double output[3], expected[3];
+    uint32_t failures = 0;
+
+    for(uint8_t v = 0; v < 2; v++)
+    {
+        const double *vector_values = (v == 0) ? (values) : (NULL);
+        const Sparse_Vector_t sparse = Sparse_Vector(indices[v], vector_values, nnz[v], 16);
+        double dense[16] = {0.0};
+
+        for(uint16_t k = 0; k < nnz[v]; k++)
+            dense[indices[v][k]] += (vector_values != NULL) ? (vector_values[k]) : (1.0);
+
+        Predict_Network(network, dense, 16, expected, 3);
+
+        Predict_Sparse_Network(network, &sparse, output, 3);
+        test_compare((v == 0) ? ("Predict_Sparse_Network") : ("Predict_Sparse_Network one-hot"), output, expected, 3, TEST_SPARSE_TOLERANCE, &failures);
+
+        Bind_Sparse_Input(network, &sparse);
+        forward_propagation(network);
+        test_compare((v == 0) ? ("Bind_Sparse_Input") : ("Bind_Sparse_Input one-hot"), output_layer->Vector_t.Vector, expected, 3, TEST_SPARSE_TOLERANCE, &failures);
+
+        Bind_Sparse_Input(network, NULL);
+    }
+
+    // Every third element of a buffer.
+    double strided[16 * 3], dense[16];
+
+    test_values(strided, 16 * 3, 4.0);
+
+    for(uint16_t j = 0; j < 16; j++)
+        dense[j] = strided[j * 3];
+
+    const Tensor_View_t view = Tensor_View(strided, 16, 3);
+
+    Predict_Network(network, dense, 16, expected, 3);
+
+    Bind_Input(network, &view);
+    forward_propagation(network);
+    test_compare("Bind_Input strided", output_layer->Vector_t.Vector, expected, 3, TEST_SPARSE_TOLERANCE, &failures);
+
+    Bind_Input(network, NULL);
+    Free_Network(network);
+
+    return failures;
+}//end test_predict_sparse.
+
+/**
+ * @brief Test: The CSR & BSR products equal the dense ones, and the pruned networks give the outputs
+ *        of their dense (pruned) weights.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_prune_kernels(void)
+{
+    static const Sparse_Format_t formats[] = {SPARSE_FORMAT_CSR, SPARSE_FORMAT_BSR};
+    static const Prune_Method_t methods[] = {PRUNE_MAGNITUDE, PRUNE_BLOCK};
+
+    const uint16_t row = 13, col = 29;   // (Not multiples of SPARSE_BLOCK_COLS)
+
+    Type_t *weights = create_matrix(row, col, false);
+    Type_t *vector  = create_vector(col, false);
+    Type_t *inputs  = create_matrix(TEST_PRUNE_BATCH, col, false);
+    Type_t *dense_outputs  = create_matrix(TEST_PRUNE_BATCH, row, false);
+    Type_t *sparse_outputs = create_matrix(TEST_PRUNE_BATCH, row, false);
+    double dense[13], sparse[13];
+    uint32_t failures = 0;
+    char name[64];
+
+    // Scattered zeros, a zero row & a zero block.
+    for(uint16_t i = 0; i < row; i++)
+    {
+        test_values(weights->Matrix_t.Matrix[i], col, i);
+
+        for(uint16_t j = 0; j < col; j++)
+        {
+            if( (((i * 31) + (j * 17)) % 10 < 7) || (i == 5) || ( (i == 8) && (j >= 8) && (j < 12) ) )
+                weights->Matrix_t.Matrix[i][j] = 0.0;
+        }
+    }
+
+    test_values(vector->Vector_t.Vector, col, 5.0);
+
+    for(uint16_t r = 0; r < TEST_PRUNE_BATCH; r++)
+        test_values(inputs->Matrix_t.Matrix[r], col, -r);
+
+    VxM_DotProduct_Unchecked(vector, weights, dense);
+    BxM_DotProduct_Unchecked(inputs, weights, dense_outputs, TEST_PRUNE_BATCH);
+
+    for(uint8_t f = 0; f < (sizeof(formats) / sizeof(formats[0])); f++)
+    {
+        Sparse_Matrix_t *sparse_weights = Sparse_Matrix_Create(weights, formats[f]);
+
+        VxSM_DotProduct_Unchecked(vector->Vector_t.Vector, sparse_weights, sparse);
+        test_compare((f == 0) ? ("CSR product") : ("BSR product"), sparse, dense, row, TEST_SPARSE_TOLERANCE, &failures);
+
+        BxSM_DotProduct_Unchecked(inputs, sparse_weights, sparse_outputs, TEST_PRUNE_BATCH);
+
+        for(uint16_t r = 0; r < TEST_PRUNE_BATCH; r++)
+        {
+            snprintf(name, sizeof(name), "%s batch row %u", (f == 0) ? ("CSR") : ("BSR"), r);
+            test_compare(name, sparse_outputs->Matrix_t.Matrix[r], dense_outputs->Matrix_t.Matrix[r], row, TEST_SPARSE_TOLERANCE, &failures);
+        }
+
+        Sparse_Matrix_Free(sparse_weights);
+    }
+
+    free_matrix(weights);
+    free_vector(vector);
+    free_matrix(dense_outputs);
+    free_matrix(sparse_outputs);
+    free_matrix(inputs);
+
+    // The pruned networks: Their sparse kernels, then their dense weights. (Weights_Changed: Another version)
+    Network_Topology_t topology = {.input_layer_dense  = 24,
+                                   .hidden_layer_dense = 32,
+                                   .hidden_layer_num   = 2,
+                                   .output_layer_dense = 5,
+                                   .activation_function        = &ReLU,
+                                   .output_activation_function = &SoftMax,
+                                   .loss_function              = &MCCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.1,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+
+    inputs         = create_matrix(TEST_PRUNE_BATCH, topology.input_layer_dense, false);
+    dense_outputs  = create_matrix(TEST_PRUNE_BATCH, topology.output_layer_dense, false);
+    sparse_outputs = create_matrix(TEST_PRUNE_BATCH, topology.output_layer_dense, false);
+
+    for(uint16_t r = 0; r < TEST_PRUNE_BATCH; r++)
+        test_values(inputs->Matrix_t.Matrix[r], topology.input_layer_dense, r + 0.5);
+
+    for(uint8_t m = 0; m < (sizeof(methods) / sizeof(methods[0])); m++)
+    {
+        DNN_Network *network = Create_Network(&topology, &config);
+
+        if(Prune_Network(network, TEST_PRUNE_SPARSITY, methods[m]) != ANN_OK)
+            test_fail(&failures, "%s: Prune_Network failed", (m == 0) ? ("magnitude") : ("block"));
+
+        Predict_Network(network, inputs->Matrix_t.Matrix[0], topology.input_layer_dense, sparse, topology.output_layer_dense);
+        Predict_Batch_Network(network, inputs, sparse_outputs, TEST_PRUNE_BATCH);
+
+        Weights_Changed(network);
+
+        Predict_Network(network, inputs->Matrix_t.Matrix[0], topology.input_layer_dense, dense, topology.output_layer_dense);
+        Predict_Batch_Network(network, inputs, dense_outputs, TEST_PRUNE_BATCH);
+
+        snprintf(name, sizeof(name), "%s pruned network", (m == 0) ? ("magnitude") : ("block"));
+        test_compare(name, sparse, dense, topology.output_layer_dense, TEST_SPARSE_TOLERANCE, &failures);
+
+        for(uint16_t r = 0; r < TEST_PRUNE_BATCH; r++)
+        {
+            snprintf(name, sizeof(name), "%s pruned network batch row %u", (m == 0) ? ("magnitude") : ("block"), r);
+            test_compare(name, sparse_outputs->Matrix_t.Matrix[r], dense_outputs->Matrix_t.Matrix[r], topology.output_layer_dense,
+                         TEST_SPARSE_TOLERANCE, &failures);
+        }
+
+        Free_Network(network);
+    }
+
+    free_matrix(inputs);
+    free_matrix(dense_outputs);
+    free_matrix(sparse_outputs);
+
+    return failures;
+}//end test_prune_kernels.
+
+/**
+ * @brief Test: Matrix_SVD of full rank, rank deficient & zero matrices, in both orientations.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_matrix_svd(void)
+{
+    static const uint16_t shapes[][2] = {{7, 4}, {4, 7}, {6, 6}, {1, 5}, {5, 1}, {60, 25}, {25, 60}};
+
+    uint32_t failures = 0;
+    char name[64];
+
+    // Full rank.
+    for(uint8_t s = 0; s < (sizeof(shapes) / sizeof(shapes[0])); s++)
+    {
+        const uint16_t row = shapes[s][0], col = shapes[s][1];
+        Type_t *matrix = create_matrix(row, col, false);
+
+        for(uint16_t i = 0; i < row; i++)
+        {
+            for(uint16_t j = 0; j < col; j++)
+                matrix->Matrix_t.Matrix[i][j] = sin((1.3 * i) + (0.7 * j * j) + 0.1) + ((i == j) ? (2.0) : (0.0));
+        }
+
+        snprintf(name, sizeof(name), "full %ux%u", row, col);
+        test_svd_check(name, matrix, (row < col) ? (row) : (col), NULL, &failures);
+
+        free_matrix(matrix);
+    }
+
+    // Rank 2, known singular values: 3 * u1 (outer) v1 + 1 * u2 (outer) v2. (Orthonormal u & v)
+    {
+        const double expected[] = {3.0, 1.0};
+        Type_t *matrix = create_matrix(6, 5, false);
+        Type_t *transposed = create_matrix(5, 6, false);
+
+        for(uint16_t i = 0; i < 6; i++)
+        {
+            const double u1 = 1.0 / sqrt(6.0);
+            const double u2 = ((i & 1) ? (-1.0) : (1.0)) / sqrt(6.0);
+
+            for(uint16_t j = 0; j < 5; j++)
+            {
+                const double v1 = 1.0 / sqrt(5.0);
+                const double v2 = (j == 0) ? (1.0 / sqrt(2.0)) : ((j == 1) ? (-1.0 / sqrt(2.0)) : (0.0));
+
+                matrix->Matrix_t.Matrix[i][j] = (3.0 * u1 * v1) + (1.0 * u2 * v2);
+            }
+        }
+
+        test_transpose(matrix, transposed);
+
+        test_svd_check("rank 2 6x5", matrix, 2, expected, &failures);
+        test_svd_check("rank 2 5x6", transposed, 2, expected, &failures);
+
+        free_matrix(matrix);
+        free_matrix(transposed);
+    }
+
+    // Rank deficient: Repeated rows & repeated columns.
+    {
+        Type_t *matrix = create_matrix(8, 5, false);
+        Type_t *transposed = create_matrix(5, 8, false);
+
+        for(uint16_t i = 0; i < 8; i++)
+        {
+            for(uint16_t j = 0; j < 5; j++)
+                matrix->Matrix_t.Matrix[i][j] = 1.0 / (1.0 + (i % 3) + j);
+        }
+
+        test_transpose(matrix, transposed);
+
+        test_svd_check("repeated rows 8x5", matrix, 3, NULL, &failures);
+        test_svd_check("repeated columns 5x8", transposed, 3, NULL, &failures);
+
+        free_matrix(matrix);
+        free_matrix(transposed);
+    }
+
+    // Zero.
+    {
+        Type_t *matrix = create_matrix(4, 3, false);
+
+        for(uint16_t i = 0; i < 4; i++)
+            memset(matrix->Matrix_t.Matrix[i], 0, sizeof(double) * 3);
+
+        test_svd_check("zero 4x3", matrix, 0, NULL, &failures);
+
+        // The shapes of the results.
+        Type_t *left  = create_matrix(4, 4, false);
+        Type_t *right = create_matrix(3, 3, false);
+        double singular[4];
+
+        if(Matrix_SVD(matrix, left, singular, right) != ANN_ERROR_SHAPE)
+            test_fail(&failures, "shape 4x3: [4 x 4] left accepted");
+
+        free_matrix(left);
+        free_matrix(right);
+        free_matrix(matrix);
+    }
+
+    return failures;
+}//end test_matrix_svd.
+
+/**
+ * @brief Test: Every IEEE half pattern & every rounding midpoint against _Float16.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_half_fp16(void)
+{
+    uint32_t failures = 0;
+
+#ifdef __FLT16_MANT_DIG__
+    for(uint32_t pattern = 0; pattern <= UINT16_MAX; pattern++)
+    {
+        const uint16_t bits = (uint16_t) pattern;
+        _Float16 reference;
+        memcpy(&reference, &bits, sizeof(reference));
+
+        // Widen: Exact, the sign of the zeros included.
+        const double value = Half_Decode(bits, HALF_FORMAT_FP16);
+
+        if(isnan((double) reference))
+        {
+            if(!isnan(value))
+                test_fail(&failures, "fp16 decode(0x%04x) = %.17g, expected NaN", bits, value);
+
+            test_fp16_round((float) reference, &failures);
+            continue;
+        }
+
+        if( (value != (double) reference) || (!signbit(value) != !signbit((double) reference)) )
+            test_fail(&failures, "fp16 decode(0x%04x) = %.17g, expected %.17g", bits, value, (double) reference);
+
+        // Round back: The same pattern.
+        const uint16_t back = Half_Encode(value, HALF_FORMAT_FP16);
+
+        if(back != bits)
+            test_fail(&failures, "fp16 encode(decode(0x%04x)) = 0x%04x", bits, back);
+
+        // The midpoint to the next larger magnitude & its float neighbours. (Ties to even, the
+        // overflow to Inf past 65504 included)
+        if( ((bits & 0x7FFFu) < 0x7C00u) )
+        {
+            const float current = (float) reference;
+            const float next = ((bits & 0x7FFFu) == 0x7BFFu) ? (copysignf(65536.0f, current))
+                                                              : ((float) Half_Decode((uint16_t) (bits + 1), HALF_FORMAT_FP16));
+            const float midpoint = (current + next) / 2.0f;   // Exact: 12 significant bits.
+
+            test_fp16_round(midpoint, &failures);
+            test_fp16_round(nextafterf(midpoint, 0.0f), &failures);
+            test_fp16_round(nextafterf(midpoint, copysignf(INFINITY, midpoint)), &failures);
+        }
+    }
+
+    // Past the range, the float specials & the smallest values.
+    const float specials[] = {65519.0f, 65520.0f, 1e6f, FLT_MAX, INFINITY, -INFINITY, NAN, FLT_MIN, FLT_TRUE_MIN,
+                              2.98023224e-8f, 2.98023259e-8f, 5.96046448e-8f, 8.94069672e-8f};
+
+    for(uint8_t i = 0; i < (sizeof(specials) / sizeof(specials[0])); i++)
+    {
+        test_fp16_round(specials[i], &failures);
+        test_fp16_round(-specials[i], &failures);
+    }
+#else
+    printf("    Skipped: The compiler has no _Float16.\n");
+#endif
+
+    return failures;
+}//end test_half_fp16.
+
+/**
+ * @brief Test: Every bfloat16 pattern & every rounding midpoint. (A bfloat16 is the upper half of a float)
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_half_bf16(void)
+{
+    uint32_t failures = 0;
+
+    for(uint32_t pattern = 0; pattern <= UINT16_MAX; pattern++)
+    {
+        const uint16_t bits = (uint16_t) pattern;
+        const float reference = test_bits_float(pattern << 16);
+        const double value = Half_Decode(bits, HALF_FORMAT_BF16);
+
+        if(isnan(reference))
+        {
+            if( !isnan(value) || !isnan(Half_Decode(Half_Encode(reference, HALF_FORMAT_BF16), HALF_FORMAT_BF16)) )
+                test_fail(&failures, "bf16 NaN 0x%04x not kept", bits);
+
+            continue;
+        }
+
+        if( (value != (double) reference) || (!signbit(value) != !signbit(reference)) )
+            test_fail(&failures, "bf16 decode(0x%04x) = %.17g, expected %.17g", bits, value, (double) reference);
+
+        const uint16_t back = Half_Encode(value, HALF_FORMAT_BF16);
+
+        if(back != bits)
+            test_fail(&failures, "bf16 encode(decode(0x%04x)) = 0x%04x", bits, back);
+
+        // The midpoint to the next larger magnitude (The float between both): To the even
+        // pattern, its neighbours to the nearest.
+        if((bits & 0x7FFFu) < 0x7F80u)
+        {
+            const uint32_t midpoint = (pattern << 16) | 0x8000u;
+            const uint16_t even = (bits & 1u) ? ((uint16_t) (bits + 1)) : (bits);
+
+            const uint16_t tie   = Half_Encode(test_bits_float(midpoint), HALF_FORMAT_BF16);
+            const uint16_t below = Half_Encode(test_bits_float(midpoint - 1), HALF_FORMAT_BF16);
+            const uint16_t above = Half_Encode(test_bits_float(midpoint + 1), HALF_FORMAT_BF16);
+
+            if( (tie != even) || (below != bits) || (above != (uint16_t) (bits + 1)) )
+                test_fail(&failures, "bf16 round(midpoint after 0x%04x) = 0x%04x 0x%04x 0x%04x, expected 0x%04x 0x%04x 0x%04x",
+                          bits, below, tie, above, bits, even, (uint16_t) (bits + 1));
+        }
+    }
+
+    return failures;
+}//end test_half_bf16.
+
+/**
+ * @brief Test: The depth-first tiles give the outputs of the layer by layer batched pass.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_batch_tiles(void)
+{
+    static const uint16_t tiles[] = {BATCH_TILE_MIN_ROWS, 5, 8, 16, TEST_TILE_BATCH - 1, 0};
+
+    Network_Topology_t topology = {.input_layer_dense  = 12,
+                                   .hidden_layer_dense = 24,
+                                   .hidden_layer_num   = 3,
+                                   .output_layer_dense = 4,
+                                   .activation_function        = &ELU,
+                                   .output_activation_function = &SoftMax,
+                                   .loss_function              = &MCCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.1,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+
+    DNN_Network *network = Create_Network(&topology, &config);
+
+    Type_t *inputs    = create_matrix(TEST_TILE_BATCH, topology.input_layer_dense, false);
+    Type_t *expected  = create_matrix(TEST_TILE_BATCH, topology.output_layer_dense, false);
+    Type_t *outputs   = create_matrix(TEST_TILE_BATCH, topology.output_layer_dense, false);
+    uint32_t failures = 0;
+    char name[64];
+
+    for(uint16_t r = 0; r < TEST_TILE_BATCH; r++)
+        test_values(inputs->Matrix_t.Matrix[r], topology.input_layer_dense, r);
+
+    // Layer by layer.
+    Set_Batch_Tile(network, MAX_MATRIX_ROW);
+    Predict_Batch_Network(network, inputs, expected, TEST_TILE_BATCH);
+
+    for(uint8_t t = 0; t < (sizeof(tiles) / sizeof(tiles[0])); t++)
+    {
+        Set_Batch_Tile(network, tiles[t]);
+        Predict_Batch_Network(network, inputs, outputs, TEST_TILE_BATCH);
+
+        for(uint16_t r = 0; r < TEST_TILE_BATCH; r++)
+        {
+            snprintf(name, sizeof(name), "tile %u row %u", tiles[t], r);
+            test_compare(name, outputs->Matrix_t.Matrix[r], expected->Matrix_t.Matrix[r], topology.output_layer_dense, 0.0, &failures);
+        }
+    }
+
+    free_matrix(inputs);
+    free_matrix(expected);
+    free_matrix(outputs);
+    Free_Network(network);
+
+    return failures;
+}//end test_batch_tiles.
+
+/**
+ * @brief Test: Tune_Network times & writes its tile to the tuning cache, then reads it back for a
+ *        network of the same topology.
+ *
+ * @return uint32_t The failed checks.
+ */
+static uint32_t test_tune_cache(void)
+{
+    Network_Topology_t topology = {.input_layer_dense  = 16,
+                                   .hidden_layer_dense = 32,
+                                   .hidden_layer_num   = 2,
+                                   .output_layer_dense = 4,
+                                   .activation_function        = &ReLU,
+                                   .output_activation_function = &SoftMax,
+                                   .loss_function              = &MCCE,
+                                   .optimizer_function         = &GradientDescent};
+
+    Network_Config_t config = {.learning_rate = 0.1,
+                               .epochs = 1,
+                               .seed = TEST_NETWORK_SEED,
+                               .weight_init = INIT_HE_NORMAL};
+
+    DNN_Network *network = Create_Network(&topology, &config);
+    DNN_Network *reader  = Create_Network(&topology, &config);
+    Tune_Result_t timed, cached;
+    uint32_t failures = 0;
+
+    remove(TEST_TUNE_CACHE);
+
+    if(Tune_Network(network, TEST_TUNE_BATCH, TEST_TUNE_CACHE, &timed) != ANN_OK)
+        test_fail(&failures, "timed: Tune_Network failed");
+
+    if( (timed.cached == true) || (timed.tiles_num == 0) )
+        test_fail(&failures, "timed: cached %d, %u tiles timed", timed.cached, timed.tiles_num);
+
+    if(Tune_Network(reader, TEST_TUNE_BATCH, TEST_TUNE_CACHE, &cached) != ANN_OK)
+        test_fail(&failures, "cached: Tune_Network failed");
+
+    if(cached.cached == false)
+        test_fail(&failures, "cached: the tile was timed again");
+
+    if( (cached.batch_tile != timed.batch_tile) || (reader->network_layers->Batch_tile != timed.batch_tile) )
+        test_fail(&failures, "cached: tile %u (network %u), timed %u", cached.batch_tile, reader->network_layers->Batch_tile, timed.batch_tile);
+
+    remove(TEST_TUNE_CACHE);
+
+    Free_Network(network);
+    Free_Network(reader);
+
+    return failures;
+}//end test_tune_cache.
+
+/*
+----------------------------------------------------------------
+!-                       MAIN                                  -
+----------------------------------------------------------------
+*/
+
+static const Test_Case_t test_cases[] =
+{
+    {"dataset/stream", test_dataset_stream},
+    {"dataset/errors", test_dataset_errors},
+    {"dataset/map", test_dataset_map},
+    {"loss/fused", test_loss_fused},
+    {"random/philox", test_random_philox},
+    {"random/fill", test_random_fill},
+    {"dropout/gradients", test_dropout_gradients},
+    {"init/streams", test_init_streams},
+    {"memory/steady", test_memory_steady},
+    {"network/training", test_network_training},
+    {"checkpoint/gradients", test_checkpoint_gradients},
+    {"train/accumulate", test_train_accumulate},
+    {"cache/version", test_cache_version},
+    {"predict/incremental", test_predict_incremental},
+    {"predict/sparse", test_predict_sparse},
+    {"prune/kernels", test_prune_kernels},
+    {"matrix/svd", test_matrix_svd},
+    {"half/fp16", test_half_fp16},
+    {"half/bf16", test_half_bf16},
+    {"batch/tiles", test_batch_tiles},
+    {"tune/cache", test_tune_cache},
+};
+
+/**
+ * @brief Function to print the usage.
+ *
+ */
+static void test_usage(void)
+{
+    printf("usage: ann_test [--filter TEXT]\n");
+
+    return;
+}//end test_usage.
+
+int main(int argc, char **argv)
+{
+    const char *filter = NULL;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if( (strcmp(argv[i], "--filter") == 0) && (i + 1 < argc) )
+            filter = argv[++i];
+        else
+        {
+            test_usage();
+            return 2;
+        }
+    }
+
+    uint32_t failed = 0, ran = 0;
+
+    for(uint16_t t = 0; t < (sizeof(test_cases) / sizeof(test_cases[0])); t++)
+    {
+        if( (filter != NULL) && (strstr(test_cases[t].name, filter) == NULL) )
+            continue;
+
+        printf("%s\n", test_cases[t].name);
+
+        const uint32_t failures = test_cases[t].function();
+
+        printf("%-6s %s (%u failed checks)\n", (failures == 0) ? ("PASS") : ("FAIL"), test_cases[t].name, failures);
+
+        failed += (failures != 0);
+        ran++;
+    }
+
+    printf("\n%u/%u tests passed\n", ran - failed, ran);
+
+    return (int) failed;
+}//end main.
+
+//!=============================> .END